@@ -20,7 +20,8 @@ namespace engine::audio
 
     int AudioPlayer::playSound(entt::id_type sound_id, int channel)
     {
-
+        if (muted_)
+            return -1;
         Mix_Chunk *chunk = resource_manager_->getSound(sound_id); // 通过 ResourceManager 获取资源
         if (!chunk)
         {
@@ -42,6 +43,8 @@ namespace engine::audio
 
     int AudioPlayer::playSound(entt::hashed_string hashed_path, int channel)
     {
+        if (muted_)
+            return -1;
         Mix_Chunk *chunk = resource_manager_->getSound(hashed_path, hashed_path.data()); // 通过 ResourceManager 获取资源
         if (!chunk)
         {
@@ -63,6 +66,8 @@ namespace engine::audio
 
     bool AudioPlayer::playMusic(entt::id_type music_id, int loops, int fade_in_ms)
     {
+        if (muted_)
+            return false;
         if (music_id == current_music_id_)
             return true; // 如果当前音乐已经在播放，则不重复播放
         current_music_id_ = music_id;
@@ -98,6 +103,8 @@ namespace engine::audio
 
     bool AudioPlayer::playMusic(entt::hashed_string hashed_path, int loops, int fade_in_ms)
     {
+        if (muted_)
+            return false;
         if (hashed_path.value() == current_music_id_)
             return true; // 如果当前音乐已经在播放，则不重复播放
         current_music_id_ = hashed_path;
@@ -183,4 +190,15 @@ namespace engine::audio
         return static_cast<float>(Mix_Volume(channel, -1)) / static_cast<float>(MIX_MAX_VOLUME);
     }
 
+    void AudioPlayer::setMuted(bool muted)
+    {
+        muted_ = muted;
+        if (muted_)
+        {
+            Mix_HaltChannel(-1);
+            stopMusic();
+        }
+        spdlog::trace("AudioPlayer: 静音设置为 {}", muted_);
+    }
+
 } // namespace engine::audio
\ No newline at end of file
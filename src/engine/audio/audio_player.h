@@ -24,6 +24,7 @@ namespace engine::audio
     private:
         engine::resource::ResourceManager *resource_manager_; ///< @brief 指向 ResourceManager 的非拥有指针，用于加载和管理音频资源。
         entt::id_type current_music_id_;                      ///< @brief 当前正在播放的音乐路径，用于避免重复播放同一音乐。
+        bool muted_{false};                                   ///< @brief 是否静音（静音时不播放任何音效和音乐，也不加载音频资源）
 
     public:
         /**
@@ -118,6 +119,13 @@ namespace engine::audio
          * @return 音量级别（0.0-1.0）。
          */
         float getSoundVolume(int channel = -1);
+
+        /**
+         * @brief 设置静音。静音时 playSound/playMusic 直接返回（无头模式使用）。
+         * @param muted 是否静音
+         */
+        void setMuted(bool muted);
+        bool isMuted() const { return muted_; } ///< @brief 是否静音
     };
 
 } // namespace engine::audio
\ No newline at end of file
@@ -2,6 +2,10 @@
 #include "../../engine/utils/math.h"
 #include <entt/core/hashed_string.hpp>
 #include <entt/entity/entity.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
 #include <unordered_map>
 #include <vector>
 
@@ -24,18 +28,25 @@ namespace engine::component
     /**
      * @brief 动画数据结构
      *
-     * 包含动画名称、帧列表、总时长、当前播放时间、是否循环等属性。
+     * 包含帧列表、动画事件、总时长与默认是否循环。动画数据只读，由 AnimationLibrary 统一存储。
+     * 构造时预先计算播放用的查找表，之后不应再修改帧与事件：
+     * - frame_end_ms_：各帧结束时间的前缀和，按动画内时间二分查找当前帧（帧时长相同时直接相除）；
+     * - event_bits_：带事件的帧索引位集，一次推进跨越多帧时只需按位扫描，不做哈希查找。
+     *
+     * 事件在播放进入对应帧时触发，帧索引的有效范围为 [1, 帧数]，帧数表示播放到结尾。
      */
     struct Animation
     {
         std::vector<AnimationFrame> frames_;            ///< @brief 动画帧
         std::unordered_map<int, entt::id_type> events_; ///< @brief 动画事件，键为帧索引，值为事件ID
         float total_duration_ms_{};                     ///< @brief 动画总时长（毫秒）
-        bool loop_{true};                               ///< @brief 是否循环
+        bool loop_{true};                               ///< @brief 默认是否循环
+        std::vector<float> frame_end_ms_;               ///< @brief 各帧结束时间（从动画开头算起，毫秒）
+        float uniform_frame_ms_{};                      ///< @brief 所有帧时长相同时的帧时长，否则为0
+        std::vector<std::uint64_t> event_bits_;         ///< @brief 带事件的帧索引位集（共 帧数+1 位）
 
         /**
          * @brief 构造函数
-         * @param name 动画名称
          * @param frames 动画帧
          * @param events 动画事件，默认为空
          * @param loop 是否循环，默认true
@@ -46,11 +57,71 @@ namespace engine::component
                                       events_(std::move(events)),
                                       loop_(loop)
         {
-            // 计算动画总时长 (总时长 = 所有帧时长之和)
+            // 计算动画总时长 (总时长 = 所有帧时长之和)，同时记录每帧的结束时间
             total_duration_ms_ = 0.0f;
+            frame_end_ms_.reserve(frames_.size());
+            uniform_frame_ms_ = frames_.empty() ? 0.0f : frames_.front().duration_ms_;
             for (const auto &frame : frames_)
             {
                 total_duration_ms_ += frame.duration_ms_;
+                frame_end_ms_.push_back(total_duration_ms_);
+                if (frame.duration_ms_ != uniform_frame_ms_)
+                {
+                    uniform_frame_ms_ = 0.0f;
+                }
+            }
+            // 事件帧位集
+            event_bits_.assign(frames_.size() / 64 + 1, 0);
+            for (const auto &[frame_index, event_id] : events_)
+            {
+                if (frame_index >= 0 && static_cast<std::size_t>(frame_index) <= frames_.size())
+                {
+                    event_bits_[frame_index / 64] |= std::uint64_t{1} << (frame_index % 64);
+                }
+            }
+        }
+
+        /// @brief 动画内时间（毫秒，0 <= time_ms < 总时长）所在的帧索引
+        [[nodiscard]] std::size_t frameAt(float time_ms) const
+        {
+            const auto last = frames_.size() - 1;
+            if (uniform_frame_ms_ > 0.0f)
+            {
+                return std::min(static_cast<std::size_t>(std::max(time_ms, 0.0f) / uniform_frame_ms_), last);
+            }
+            // 第一个结束时间大于 time_ms 的帧
+            auto it = std::upper_bound(frame_end_ms_.begin(), frame_end_ms_.end(), time_ms);
+            return std::min(static_cast<std::size_t>(it - frame_end_ms_.begin()), last);
+        }
+
+        /**
+         * @brief 按帧索引顺序遍历 [first, last] 范围内带事件的帧
+         * @param func 回调 void(std::size_t frame_index)，事件ID通过 events_.at(frame_index) 获取
+         */
+        template <typename Func>
+        void forEachEvent(std::size_t first, std::size_t last, Func &&func) const
+        {
+            last = std::min(last, event_bits_.size() * 64 - 1);
+            if (first > last)
+            {
+                return;
+            }
+            for (std::size_t word = first / 64; word <= last / 64; ++word)
+            {
+                std::uint64_t bits = event_bits_[word];
+                if (word == first / 64)
+                {
+                    bits &= ~std::uint64_t{0} << (first % 64);
+                }
+                if (word == last / 64 && last % 64 != 63)
+                {
+                    bits &= (std::uint64_t{1} << (last % 64 + 1)) - 1;
+                }
+                while (bits != 0)
+                {
+                    func(word * 64 + static_cast<std::size_t>(std::countr_zero(bits)));
+                    bits &= bits - 1;
+                }
             }
         }
     };
@@ -58,33 +129,37 @@ namespace engine::component
     /**
      * @brief 动画组件
      *
-     * 包含动画名称、帧列表、总时长、当前播放时间、是否循环等属性。
+     * 动画数据（帧列表、事件）存放在共享的 engine::resource::AnimationLibrary 中，只存储一份；
+     * 组件只保存所属的动画集合、当前片段的索引与播放状态。
+     * 切换动画时（PlayAnimationEvent）在集合中解析一次片段索引，逐帧更新时直接按索引访问。
      */
     struct AnimationComponent
     {
-        std::unordered_map<entt::id_type, Animation> animations_; ///< @brief 动画集合
-        entt::id_type current_animation_id_{entt::null};          ///< @brief 当前播放的动画名称
-        size_t current_frame_index_{};                            ///< @brief 当前播放的帧索引
-        float current_time_ms_{};                                 ///< @brief 当前播放时间（毫秒）
-        float speed_{1.0f};                                       ///< @brief 播放速度
+        std::uint32_t set_id_;                           ///< @brief 动画集合（AnimationLibrary 中的索引）
+        entt::id_type current_animation_id_{entt::null}; ///< @brief 当前播放的动画ID
+        std::uint32_t current_clip_;                     ///< @brief 当前动画片段（AnimationLibrary 中的索引）
+        std::uint32_t current_frame_index_{};            ///< @brief 当前播放的帧索引
+        float current_time_ms_{};                        ///< @brief 当前播放时间（毫秒，从动画开头算起）
+        float speed_{1.0f};                              ///< @brief 播放速度
+        bool loop_{true};                                ///< @brief 当前动画是否循环（播放时可覆盖片段的默认值）
 
         /**
          * @brief 构造函数
-         * @param animations 动画集合
-         * @param current_animation_name 当前播放的动画名称
-         * @param current_frame_index 当前播放的帧索引
-         * @param current_time_ms 当前播放时间（毫秒）
+         * @param set_id 动画集合索引
+         * @param current_animation_id 当前播放的动画ID
+         * @param current_clip 当前动画片段索引
+         * @param loop 是否循环
          * @param speed 播放速度
          */
-        AnimationComponent(std::unordered_map<entt::id_type, Animation> animations,
+        AnimationComponent(std::uint32_t set_id,
                            entt::id_type current_animation_id,
-                           size_t current_frame_index = 0,
-                           float current_time_ms = 0.0f,
-                           float speed = 1.0f) : animations_(std::move(animations)),
+                           std::uint32_t current_clip,
+                           bool loop = true,
+                           float speed = 1.0f) : set_id_(set_id),
                                                  current_animation_id_(current_animation_id),
-                                                 current_frame_index_(current_frame_index),
-                                                 current_time_ms_(current_time_ms),
-                                                 speed_(speed) {}
+                                                 current_clip_(current_clip),
+                                                 speed_(speed),
+                                                 loop_(loop) {}
     };
 
 }
\ No newline at end of file
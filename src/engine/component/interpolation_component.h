@@ -0,0 +1,19 @@
+#pragma once
+#include <glm/vec2.hpp>
+
+namespace engine::component {
+
+/**
+ * @brief 渲染插值组件，记录上一个模拟tick开始时的位置。
+ *
+ * 固定步长模拟时，渲染帧通常落在两个tick之间。渲染系统会在 previous_position_ 与
+ * TransformComponent::position_ 之间按插值系数混合，使移动的实体在高刷新率下依然平滑。
+ * 只有会持续移动的实体（如敌人、投射物）才需要此组件。
+ */
+struct InterpolationComponent {
+    glm::vec2 previous_position_{};    ///< @brief 上一个tick开始时的位置
+
+    explicit InterpolationComponent(glm::vec2 previous_position) : previous_position_(previous_position) {}
+};
+
+}   // namespace engine::component
@@ -0,0 +1,17 @@
+#pragma once
+#include <entt/core/fwd.hpp>
+
+namespace engine::component
+{
+
+    /**
+     * @brief 池化组件，标记实体由 engine::core::EntityPool 管理。
+     *
+     * 带有该组件的实体“死亡”时应通过 EntityPool::release 停用并归还，而不是直接销毁（见 RemoveDeadSystem）。
+     */
+    struct PooledComponent
+    {
+        entt::id_type pool_key_{}; ///< @brief 所属池的键（通常由蓝图ID得到）
+    };
+
+} // namespace engine::component
@@ -38,4 +38,13 @@ namespace engine::component
         }
     };
 
+    /**
+     * @brief 静态渲染标签，表示实体的图层和深度在创建后不会再改变（如瓦片、图片图层）。
+     * 渲染队列会将其放入静态桶，不再检查和排序。
+     * @note 需要在添加 RenderComponent 之前添加
+     */
+    struct StaticRenderTag
+    {
+    };
+
 } // namespace engine::component
\ No newline at end of file
@@ -1,12 +1,13 @@
 #pragma once
 #include "../utils/math.h"
+#include "../resource/texture_handle.h"
 #include <SDL3/SDL_rect.h>
 #include <entt/core/hashed_string.hpp>
 #include <entt/entity/entity.hpp>
 #include <glm/vec2.hpp>
 #include <glm/common.hpp>
 #include <utility>
-#include <string>
+#include <string_view>
 
 namespace engine::component
 {
@@ -14,38 +15,39 @@ namespace engine::component
     /**
      * @brief 精灵数据结构
      *
-     * 包含纹理名称、源矩形和是否翻转。
+     * 包含纹理ID、纹理句柄、源矩形和是否翻转。
+     * 纹理句柄在创建实体时解析（ResourceManager::resolveTexture），绘制时直接使用，不再需要纹理路径。
      */
     struct Sprite
     {
-        entt::id_type texture_id_{entt::null}; ///< @brief 纹理ID
-        std::string texture_path_;             ///< @brief 纹理路径
-        engine::utils::Rect src_rect_{};       ///< @brief 源矩形(为了保证效率，不再使用std::optional，构造时必须提供)
-        bool is_flipped_{false};               ///< @brief 是否翻转
+        entt::id_type texture_id_{entt::null};             ///< @brief 纹理ID（句柄失效时用于重新查找）
+        engine::resource::TextureHandle texture_handle_{}; ///< @brief 纹理句柄
+        engine::utils::Rect src_rect_{};                   ///< @brief 源矩形(为了保证效率，不再使用std::optional，构造时必须提供)
+        bool is_flipped_{false};                           ///< @brief 是否翻转
 
         Sprite() = default; ///< @brief 空的构造函数
 
         /**
-         * @brief 构造函数 (通过纹理路径构造)
+         * @brief 构造函数 (通过纹理路径构造，只保存路径的哈希值)
          * @param texture_path 纹理路径
          * @param source_rect 源矩形
          * @param is_flipped 是否翻转，默认false
+         * @note 句柄需要之后再解析，纹理也需要由调用者确保加载
          */
-        Sprite(std::string texture_path, engine::utils::Rect source_rect, bool is_flipped = false)
-            : texture_path_(std::move(texture_path)), src_rect_(std::move(source_rect)), is_flipped_(is_flipped)
-        {
-            texture_id_ = entt::hashed_string(texture_path_.c_str());
-        }
+        Sprite(std::string_view texture_path, engine::utils::Rect source_rect, bool is_flipped = false)
+            : texture_id_(entt::hashed_string(texture_path.data(), texture_path.size())), src_rect_(std::move(source_rect)), is_flipped_(is_flipped) {}
 
         /**
          * @brief 构造函数 (通过纹理ID构造)
          * @param texture_id 纹理ID
          * @param source_rect 源矩形
          * @param is_flipped 是否翻转，默认false
+         * @param texture_handle 纹理句柄，默认为空（需要之后再解析）
          * @note 用此方法，需确保对应ID的纹理已经加载到ResourceManager中，因此不需要再提供纹理路径。
          */
-        Sprite(entt::id_type texture_id, engine::utils::Rect source_rect, bool is_flipped = false)
-            : texture_id_(texture_id), src_rect_(std::move(source_rect)), is_flipped_(is_flipped) {}
+        Sprite(entt::id_type texture_id, engine::utils::Rect source_rect, bool is_flipped = false,
+               engine::resource::TextureHandle texture_handle = {})
+            : texture_id_(texture_id), texture_handle_(texture_handle), src_rect_(std::move(source_rect)), is_flipped_(is_flipped) {}
     };
 
     /**
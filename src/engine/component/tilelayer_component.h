@@ -4,6 +4,7 @@
 #include <entt/entity/entity.hpp>
 #include <glm/vec2.hpp>
 #include <vector>
+#include <string>
 #include <utility>
 #include <optional>
 #include <SDL3/SDL_rect.h>
@@ -29,17 +30,21 @@ namespace engine::component {
  */
 struct TileInfo {
     engine::component::Sprite sprite_;                      ///< @brief 精灵
+    std::string texture_path_;                              ///< @brief 纹理路径（生成实体时用于加载纹理并解析句柄）
     engine::component::TileType type_;                      ///< @brief 类型
     std::optional<engine::component::Animation> animation_; ///< @brief 动画（支持Tiled动画图块）
+    entt::id_type animation_key_{};                        ///< @brief 动画在 AnimationLibrary 中的集合键（图块集路径 + 局部ID，同一图块共享一份动画）
     std::optional<nlohmann::json> properties_;              ///< @brief 属性（存放自定义属性，方便LevelLoader解析）
 
     TileInfo() = default;
 
     TileInfo(engine::component::Sprite sprite, 
+             std::string texture_path,
              engine::component::TileType type, 
              std::optional<engine::component::Animation> animation = std::nullopt, 
              std::optional<nlohmann::json> properties = std::nullopt) : 
              sprite_(std::move(sprite)), 
+             texture_path_(std::move(texture_path)), 
              type_(type), 
              animation_(std::move(animation)), 
              properties_(std::move(properties)) {}
@@ -48,24 +53,29 @@ struct TileInfo {
 /**
  * @brief 瓦片层组件，包含瓦片大小、地图大小和瓦片实体列表。
  * @note 现在瓦片层更像一个容器，只是存储所有的“瓦片”，而每个瓦片就是一个实体。
+ *       开启烘焙时，静态瓦片会被合并绘制到区块纹理中，只有无法烘焙的瓦片（如动画瓦片）才会保留为独立实体。
  */
 struct TileLayerComponent {
     glm::ivec2 tile_size_;              ///< @brief 瓦片大小
     glm::ivec2 map_size_;               ///< @brief 地图大小
     std::vector<entt::entity> tiles_;   ///< @brief 瓦片实体列表，每个瓦片对应一个实体，按顺序排列
+    std::vector<entt::entity> chunks_;  ///< @brief 烘焙区块实体列表（未烘焙时为空）
 
     /**
      * @brief 构造函数
      * @param tile_size 瓦片大小
      * @param map_size 地图大小
      * @param tiles 瓦片实体列表
+     * @param chunks 烘焙区块实体列表
      */
     TileLayerComponent(glm::ivec2 tile_size, 
                        glm::ivec2 map_size, 
-                       std::vector<entt::entity> tiles) : 
+                       std::vector<entt::entity> tiles,
+                       std::vector<entt::entity> chunks = {}) : 
                        tile_size_(std::move(tile_size)), 
                        map_size_(std::move(map_size)),
-                       tiles_(std::move(tiles)) {}
+                       tiles_(std::move(tiles)),
+                       chunks_(std::move(chunks)) {}
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,108 @@
+#include "command_buffer.h"
+#include <algorithm>
+#include <atomic>
+#include <spdlog/spdlog.h>
+
+namespace engine::core
+{
+
+    CommandBuffer::CommandBuffer(JobSystem &job_system)
+        : job_system_(job_system), slots_(job_system.getThreadSlotCount())
+    {
+        spdlog::trace("CommandBuffer 初始化完成，线程槽位数: {}", slots_.size());
+    }
+
+    CommandBuffer::Stats CommandBuffer::apply(entt::registry &registry)
+    {
+        Stats stats;
+
+        // 收集所有非空队列，按组件类型分组（类型编号按首次使用的顺序分配，可能因线程而异，因此按类型哈希排序）
+        pending_.clear();
+        for (auto &slot : slots_)
+        {
+            for (auto &queue : slot.queues_)
+            {
+                if (queue && !queue->empty())
+                    pending_.push_back(queue.get());
+            }
+        }
+        std::stable_sort(pending_.begin(), pending_.end(), [](const ComponentQueueBase *a, const ComponentQueueBase *b)
+                         { return a->type_hash_ < b->type_hash_; });
+        for (std::size_t first = 0; first < pending_.size();)
+        {
+            std::size_t last = first + 1;
+            while (last < pending_.size() && pending_[last]->type_hash_ == pending_[first]->type_hash_)
+                ++last;
+            applyComponentGroup(registry, stats, first, last);
+            first = last;
+        }
+
+        // 最后销毁实体（之前的组件命令已经执行完毕）
+        applyDestroys(registry, stats);
+
+        stats_.emplaces_ += stats.emplaces_;
+        stats_.removes_ += stats.removes_;
+        stats_.destroys_ += stats.destroys_;
+        return stats;
+    }
+
+    void CommandBuffer::applyComponentGroup(entt::registry &registry, Stats &stats, std::size_t first, std::size_t last)
+    {
+        // 常见情况：只有一个线程记录了这类命令，且顺序键已经有序，直接按记录顺序执行
+        auto *front = pending_[first];
+        if (last - first == 1 && std::is_sorted(front->keys_.begin(), front->keys_.end()))
+        {
+            front->applyAll(registry, stats);
+            return;
+        }
+
+        // 按 (顺序键, 来源, 记录顺序) 排序；同一顺序键的工作只在一个线程上执行，因此来源只区分未指定顺序键的命令
+        merge_.clear();
+        for (std::size_t source = first; source < last; ++source)
+        {
+            const auto &keys = pending_[source]->keys_;
+            for (std::size_t i = 0; i < keys.size(); ++i)
+                merge_.push_back({keys[i], static_cast<std::uint32_t>(source), static_cast<std::uint32_t>(i)});
+        }
+        std::sort(merge_.begin(), merge_.end());
+        for (const auto &entry : merge_)
+            pending_[entry.source_]->applyOne(registry, stats, entry.index_);
+        for (std::size_t source = first; source < last; ++source)
+            pending_[source]->clear();
+    }
+
+    void CommandBuffer::applyDestroys(entt::registry &registry, Stats &stats)
+    {
+        // 销毁顺序决定实体ID的回收顺序，同样按顺序键排列，保证之后创建的实体ID确定
+        merge_.clear();
+        for (std::size_t slot_index = 0; slot_index < slots_.size(); ++slot_index)
+        {
+            const auto &keys = slots_[slot_index].destroy_keys_;
+            for (std::size_t i = 0; i < keys.size(); ++i)
+                merge_.push_back({keys[i], static_cast<std::uint32_t>(slot_index), static_cast<std::uint32_t>(i)});
+        }
+        if (merge_.empty())
+            return;
+        std::sort(merge_.begin(), merge_.end());
+        for (const auto &entry : merge_)
+        {
+            const auto entity = slots_[entry.source_].destroys_[entry.index_];
+            if (!registry.valid(entity))
+                continue;
+            registry.destroy(entity);
+            ++stats.destroys_;
+        }
+        for (auto &slot : slots_)
+        {
+            slot.destroys_.clear();
+            slot.destroy_keys_.clear();
+        }
+    }
+
+    std::size_t CommandBuffer::nextTypeIndex()
+    {
+        static std::atomic<std::size_t> next{0};
+        return next.fetch_add(1, std::memory_order_relaxed);
+    }
+
+} // namespace engine::core
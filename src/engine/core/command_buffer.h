@@ -0,0 +1,202 @@
+#pragma once
+#include "job_system.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <entt/core/type_info.hpp>
+#include <entt/entity/registry.hpp>
+
+namespace engine::core
+{
+
+    /**
+     * @brief ECS 命令缓冲：延迟执行结构性修改（添加/移除组件、销毁实体）。
+     *
+     * 系统在遍历 view 时记录命令而不是直接修改注册表，既避免遍历过程中改动存储，
+     * 也让只做结构性修改的系统可以与其它系统并行（命令可以从任意线程无锁记录，每个线程写自己的缓冲区）。
+     * 命令在同步点由 apply() 批量执行：按组件类型分组（同一存储连续处理），
+     * 同一类型内按记录时线程的顺序键（JobSystem::OrderKey，见 EventStager）、再按记录顺序执行；
+     * 销毁实体在所有组件命令之后执行，同样按顺序键排列。由哪个线程执行哪个系统或分块不影响执行顺序，
+     * 因此每次运行的结果（包括实体ID的回收顺序）都相同。
+     *
+     * - emplace 在执行时使用 emplace_or_replace 语义（组件已存在时替换）；
+     * - 执行时实体已经无效的命令会被忽略。
+     *
+     * 记录命令只能在主线程或所属 JobSystem 的工作线程中进行；apply() 只能在主线程、且没有任务运行时调用。
+     */
+    class CommandBuffer final
+    {
+    public:
+        /// @brief 命令数量统计
+        struct Stats
+        {
+            std::size_t emplaces_{0}; ///< @brief 添加/替换组件
+            std::size_t removes_{0};  ///< @brief 移除组件
+            std::size_t destroys_{0}; ///< @brief 销毁实体
+        };
+
+    private:
+        /// @brief 类型擦除的单类组件命令队列
+        struct ComponentQueueBase
+        {
+            entt::id_type type_hash_{0};      ///< @brief 组件类型哈希（apply 时按它排序）
+            std::vector<std::uint64_t> keys_; ///< @brief 各命令的顺序键（与命令一一对应）
+
+            virtual ~ComponentQueueBase() = default;
+            virtual void applyAll(entt::registry &registry, Stats &stats) = 0;                      ///< @brief 按记录顺序执行全部命令
+            virtual void applyOne(entt::registry &registry, Stats &stats, std::size_t index) = 0;  ///< @brief 执行指定的命令
+            virtual void clear() = 0;                                                             ///< @brief 清空（保留容量，下一帧复用）
+            [[nodiscard]] bool empty() const { return keys_.empty(); }
+        };
+
+        template <typename Component>
+        struct ComponentQueue final : ComponentQueueBase
+        {
+            struct Command
+            {
+                entt::entity entity_;
+                std::optional<Component> value_; ///< @brief 为空表示移除组件
+            };
+            std::vector<Command> commands_;
+
+            void applyAll(entt::registry &registry, Stats &stats) override
+            {
+                for (std::size_t i = 0; i < commands_.size(); ++i)
+                    applyOne(registry, stats, i);
+                clear();
+            }
+
+            void applyOne(entt::registry &registry, Stats &stats, std::size_t index) override
+            {
+                auto &command = commands_[index];
+                if (!registry.valid(command.entity_))
+                    return;
+                if (command.value_)
+                {
+                    if constexpr (std::is_empty_v<Component>)
+                        registry.emplace_or_replace<Component>(command.entity_);
+                    else
+                        registry.emplace_or_replace<Component>(command.entity_, std::move(*command.value_));
+                    ++stats.emplaces_;
+                }
+                else
+                {
+                    registry.remove<Component>(command.entity_);
+                    ++stats.removes_;
+                }
+            }
+
+            void clear() override
+            {
+                commands_.clear();
+                keys_.clear();
+            }
+        };
+
+        /// @brief 合并时排序用的命令引用
+        struct MergeEntry
+        {
+            std::uint64_t key_;     ///< @brief 顺序键
+            std::uint32_t source_;  ///< @brief 来源（队列或线程槽位）
+            std::uint32_t index_;   ///< @brief 在来源中的下标（即记录顺序）
+
+            bool operator<(const MergeEntry &other) const
+            {
+                if (key_ != other.key_)
+                    return key_ < other.key_;
+                return source_ != other.source_ ? source_ < other.source_ : index_ < other.index_;
+            }
+        };
+
+        /// @brief 单个线程的命令缓冲（对齐到缓存行，避免相邻线程的伪共享）
+        struct alignas(64) Slot
+        {
+            std::vector<std::unique_ptr<ComponentQueueBase>> queues_; ///< @brief 按组件类型编号索引
+            std::vector<entt::entity> destroys_;                      ///< @brief 待销毁的实体
+            std::vector<std::uint64_t> destroy_keys_;                 ///< @brief 待销毁实体的顺序键
+        };
+
+        JobSystem &job_system_;
+        std::vector<Slot> slots_;                  ///< @brief 按线程槽位索引（见 JobSystem::getCurrentThreadSlot）
+        std::vector<ComponentQueueBase *> pending_; ///< @brief apply 时按组件类型排序的临时列表
+        std::vector<MergeEntry> merge_;            ///< @brief apply 时按顺序键排序的临时列表
+        Stats stats_;                              ///< @brief 自上次 takeStats() 以来执行的命令数
+
+    public:
+        explicit CommandBuffer(JobSystem &job_system);
+
+        CommandBuffer(const CommandBuffer &) = delete;
+        CommandBuffer &operator=(const CommandBuffer &) = delete;
+        CommandBuffer(CommandBuffer &&) = delete;
+        CommandBuffer &operator=(CommandBuffer &&) = delete;
+
+        /// @brief 记录添加组件（执行时已存在则替换）
+        template <typename Component, typename... Args>
+        void emplace(entt::entity entity, Args &&...args)
+        {
+            auto &queue = this->queue<Component>();
+            queue.commands_.push_back({entity, Component{std::forward<Args>(args)...}});
+            queue.keys_.push_back(JobSystem::getCurrentOrderKey().value());
+        }
+
+        /// @brief 记录移除组件（执行时组件不存在则忽略）
+        template <typename Component>
+        void remove(entt::entity entity)
+        {
+            auto &queue = this->queue<Component>();
+            queue.commands_.push_back({entity, std::nullopt});
+            queue.keys_.push_back(JobSystem::getCurrentOrderKey().value());
+        }
+
+        /// @brief 记录销毁实体
+        void destroy(entt::entity entity)
+        {
+            auto &slot = slots_[job_system_.getCurrentThreadSlot()];
+            slot.destroys_.push_back(entity);
+            slot.destroy_keys_.push_back(JobSystem::getCurrentOrderKey().value());
+        }
+
+        /**
+         * @brief 同步点：执行所有记录的命令
+         * @param registry 要修改的注册表
+         * @return 本次执行的命令数量
+         */
+        Stats apply(entt::registry &registry);
+
+        /// @brief 取出自上次调用以来执行的命令数量，并清零
+        Stats takeStats() { return std::exchange(stats_, Stats{}); }
+
+    private:
+        static std::size_t nextTypeIndex(); ///< @brief 分配新的组件类型编号
+        void applyComponentGroup(entt::registry &registry, Stats &stats, std::size_t first, std::size_t last); ///< @brief 执行 pending_[first, last)（同一组件类型）的命令
+        void applyDestroys(entt::registry &registry, Stats &stats);                                             ///< @brief 按顺序键销毁实体
+
+        template <typename Component>
+        static std::size_t typeIndex()
+        {
+            static const std::size_t index = nextTypeIndex();
+            return index;
+        }
+
+        template <typename Component>
+        ComponentQueue<Component> &queue()
+        {
+            auto &slot = slots_[job_system_.getCurrentThreadSlot()];
+            const auto index = typeIndex<Component>();
+            if (index >= slot.queues_.size())
+                slot.queues_.resize(index + 1);
+            auto &queue = slot.queues_[index];
+            if (!queue)
+            {
+                queue = std::make_unique<ComponentQueue<Component>>();
+                queue->type_hash_ = entt::type_hash<Component>::value();
+            }
+            return static_cast<ComponentQueue<Component> &>(*queue);
+        }
+    };
+
+} // namespace engine::core
@@ -82,6 +82,7 @@ namespace engine::core
         {
             const auto &graphics_config = j["graphics"];
             vsync_enabled_ = graphics_config.value("vsync", vsync_enabled_);
+            sprite_batching_ = graphics_config.value("sprite_batching", sprite_batching_);
         }
         if (j.contains("performance"))
         {
@@ -92,6 +93,49 @@ namespace engine::core
                 spdlog::warn("目标 FPS 不能为负数。设置为 0（无限制）。");
                 target_fps_ = 0;
             }
+            fixed_tick_rate_ = perf_config.value("fixed_tick_rate", fixed_tick_rate_);
+            if (fixed_tick_rate_ < 0)
+            {
+                spdlog::warn("固定模拟频率不能为负数。设置为 0（可变步长）。");
+                fixed_tick_rate_ = 0;
+            }
+            max_ticks_per_frame_ = perf_config.value("max_ticks_per_frame", max_ticks_per_frame_);
+            if (max_ticks_per_frame_ < 1)
+            {
+                spdlog::warn("每帧最大模拟次数不能小于 1。设置为 1。");
+                max_ticks_per_frame_ = 1;
+            }
+            max_frame_time_ = perf_config.value("max_frame_time", max_frame_time_);
+            worker_threads_ = perf_config.value("worker_threads", worker_threads_);
+            if (worker_threads_ < -1)
+            {
+                spdlog::warn("工作线程数无效。设置为 -1（自动）。");
+                worker_threads_ = -1;
+            }
+            particle_capacity_ = perf_config.value("particle_capacity", particle_capacity_);
+            if (particle_capacity_ < 0)
+            {
+                spdlog::warn("粒子数量上限不能为负数。设置为 0（禁用粒子）。");
+                particle_capacity_ = 0;
+            }
+        }
+        if (j.contains("debug"))
+        {
+            const auto &debug_config = j["debug"];
+            trace_on_start_ = debug_config.value("trace_on_start", trace_on_start_);
+            trace_output_dir_ = debug_config.value("trace_output_dir", trace_output_dir_);
+            trace_max_events_ = debug_config.value("trace_max_events", trace_max_events_);
+            if (trace_max_events_ <= 0)
+            {
+                spdlog::warn("trace 最大事件数必须大于 0。使用默认值 1000000。");
+                trace_max_events_ = 1000000;
+            }
+            log_queue_size_ = debug_config.value("log_queue_size", log_queue_size_);
+            if (log_queue_size_ < 0)
+            {
+                spdlog::warn("日志缓冲区大小不能为负数。设置为 0（同步输出）。");
+                log_queue_size_ = 0;
+            }
         }
         if (j.contains("audio"))
         {
@@ -127,8 +171,9 @@ namespace engine::core
     {
         return nlohmann::ordered_json{
             {"window", {{"title", window_title_}, {"width", window_width_}, {"height", window_height_}, {"window_scale", window_scale_}, {"logical_scale", window_logical_scale_}, {"resizable", window_resizable_}}},
-            {"graphics", {{"vsync", vsync_enabled_}}},
-            {"performance", {{"target_fps", target_fps_}}},
+            {"graphics", {{"vsync", vsync_enabled_}, {"sprite_batching", sprite_batching_}}},
+            {"performance", {{"target_fps", target_fps_}, {"fixed_tick_rate", fixed_tick_rate_}, {"max_ticks_per_frame", max_ticks_per_frame_}, {"max_frame_time", max_frame_time_}, {"worker_threads", worker_threads_}, {"particle_capacity", particle_capacity_}}},
+            {"debug", {{"trace_on_start", trace_on_start_}, {"trace_output_dir", trace_output_dir_}, {"trace_max_events", trace_max_events_}, {"log_queue_size", log_queue_size_}}},
             {"audio", {{"music_volume", music_volume_}, {"sound_volume", sound_volume_}}},
             {"input_mappings", input_mappings_}};
     }
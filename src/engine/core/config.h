@@ -27,10 +27,22 @@ namespace engine::core
         bool window_resizable_ = true;
 
         // 图形设置
-        bool vsync_enabled_ = true; ///< @brief 是否启用垂直同步
+        bool vsync_enabled_ = true;   ///< @brief 是否启用垂直同步
+        bool sprite_batching_ = true; ///< @brief 是否启用精灵批处理（同一纹理的连续精灵合并为一次绘制调用）
 
         // 性能设置
-        int target_fps_ = 144; ///< @brief 目标 FPS 设置，0 表示不限制
+        int target_fps_ = 144;         ///< @brief 目标 FPS 设置，0 表示不限制
+        int fixed_tick_rate_ = 60;     ///< @brief 固定步长模拟的频率(每秒tick数)，0 表示使用可变步长（每帧更新一次）
+        int max_ticks_per_frame_ = 5;  ///< @brief 每帧最多执行的模拟tick数（防止“死亡螺旋”）
+        float max_frame_time_ = 0.25f; ///< @brief 单帧计入模拟的最长时间(秒)，超出部分被丢弃（如窗口拖动、断点导致的长帧）
+        int worker_threads_ = -1;      ///< @brief 任务系统的工作线程数，-1 表示自动（硬件线程数 - 1），0 表示不创建工作线程
+        int particle_capacity_ = 256;  ///< @brief 同时存在的粒子特效数量上限，超出时覆盖最旧的粒子，0 表示禁用粒子
+
+        // 调试设置
+        bool trace_on_start_ = false;                 ///< @brief 启动时立即开始记录 trace（可捕获资源加载过程）
+        std::string trace_output_dir_ = "traces";     ///< @brief trace 文件的输出目录
+        int trace_max_events_ = 1000000;              ///< @brief 内存中最多缓存的 trace 事件数，达到后自动停止并写出
+        int log_queue_size_ = 8192;                   ///< @brief 异步日志缓冲区可容纳的消息数，满时丢弃新消息，0 表示同步输出日志
 
         // 音频设置
         float music_volume_ = 0.5f;
@@ -46,6 +58,8 @@ namespace engine::core
             {"jump", {"J", "Space"}},
             {"attack", {"K", "MouseLeft"}},
             {"pause", {"P", "Escape"}},
+            {"toggle_profiler", {"F3"}},
+            {"toggle_trace", {"F4"}},
             // 可以继续添加更多默认动作
         };
 
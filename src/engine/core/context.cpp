@@ -17,7 +17,11 @@ Context::Context(entt::dispatcher& dispatcher,
                  engine::render::TextRenderer& text_renderer,
                  engine::resource::ResourceManager& resource_manager,
                  engine::audio::AudioPlayer& audio_player,
-                 engine::core::GameState& game_state)     
+                 engine::core::GameState& game_state,
+                 engine::core::Time& time,
+                 engine::core::JobSystem& job_system,
+                 engine::core::EventStager& event_stager,
+                 const engine::core::Config& config)
     : dispatcher_(dispatcher),
       input_manager_(input_manager),
       renderer_(renderer),
@@ -25,7 +29,11 @@ Context::Context(entt::dispatcher& dispatcher,
       text_renderer_(text_renderer),
       resource_manager_(resource_manager),
       audio_player_(audio_player),
-      game_state_(game_state)
+      game_state_(game_state),
+      time_(time),
+      job_system_(job_system),
+      event_stager_(event_stager),
+      config_(config)
 {
     spdlog::trace("上下文已创建并初始化。");
 }
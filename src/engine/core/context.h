@@ -21,6 +21,10 @@ namespace engine::audio {
 
 namespace engine::core {
     class GameState;
+    class Time;
+    class JobSystem;
+    class EventStager;
+    class Config;
 
 /**
  * @brief 持有对核心引擎模块引用的上下文对象。
@@ -38,6 +42,10 @@ private:
     engine::resource::ResourceManager& resource_manager_;   ///< @brief 资源管理器
     engine::audio::AudioPlayer& audio_player_;              ///< @brief 音频播放器
     engine::core::GameState& game_state_;                   ///< @brief 游戏状态
+    engine::core::Time& time_;                              ///< @brief 时间管理（帧时间、固定步长、渲染插值系数）
+    engine::core::JobSystem& job_system_;                   ///< @brief 任务系统（工作窃取线程池）
+    engine::core::EventStager& event_stager_;               ///< @brief 事件暂存区（工作线程中发送事件）
+    const engine::core::Config& config_;                    ///< @brief 配置（只读）
 public:
     /**
      * @brief 构造函数。
@@ -49,6 +57,10 @@ public:
      * @param resource_manager 对 ResourceManager 实例的引用。
      * @param audio_player 对 AudioPlayer 实例的引用。
      * @param game_state 对 GameState 实例的引用。
+     * @param time 对 Time 实例的引用。
+     * @param job_system 对 JobSystem 实例的引用。
+     * @param event_stager 对 EventStager 实例的引用。
+     * @param config 对 Config 实例的引用。
      */
     Context(entt::dispatcher& dispatcher,
             engine::input::InputManager& input_manager,
@@ -57,7 +69,11 @@ public:
             engine::render::TextRenderer& text_renderer,
             engine::resource::ResourceManager& resource_manager,
             engine::audio::AudioPlayer& audio_player,
-            engine::core::GameState& game_state);
+            engine::core::GameState& game_state,
+            engine::core::Time& time,
+            engine::core::JobSystem& job_system,
+            engine::core::EventStager& event_stager,
+            const engine::core::Config& config);
 
     // 禁止拷贝和移动，Context 对象通常是唯一的或按需创建/传递
     Context(const Context&) = delete;
@@ -74,6 +90,10 @@ public:
     engine::resource::ResourceManager& getResourceManager() const { return resource_manager_; } ///< @brief 获取资源管理器
     engine::audio::AudioPlayer& getAudioPlayer() const { return audio_player_; }                 ///< @brief 获取音频播放器
     engine::core::GameState& getGameState() const { return game_state_; }                         ///< @brief 获取游戏状态
+    engine::core::Time& getTime() const { return time_; }                                          ///< @brief 获取时间管理
+    engine::core::JobSystem& getJobSystem() const { return job_system_; }                         ///< @brief 获取任务系统
+    engine::core::EventStager& getEventStager() const { return event_stager_; }                   ///< @brief 获取事件暂存区
+    const engine::core::Config& getConfig() const { return config_; }                             ///< @brief 获取配置
 };
 
 } // namespace engine::core
\ No newline at end of file
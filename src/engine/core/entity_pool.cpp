@@ -0,0 +1,91 @@
+#include "entity_pool.h"
+#include <spdlog/spdlog.h>
+
+namespace engine::core
+{
+
+    EntityPool::EntityPool(entt::registry &registry) : registry_(registry) {}
+
+    entt::entity EntityPool::acquire(entt::id_type key)
+    {
+        // 未登记的键也记录统计（第一次创建通常发生在登记之前）
+        auto &bucket = buckets_[key];
+        while (!bucket.free_.empty())
+        {
+            const auto entity = bucket.free_.back();
+            bucket.free_.pop_back();
+            // 停用期间可能被整体销毁（如清空注册表），跳过无效的实体
+            if (registry_.valid(entity))
+            {
+                ++bucket.stats_.hits_;
+                return entity;
+            }
+        }
+        ++bucket.stats_.misses_;
+        return entt::null;
+    }
+
+    void EntityPool::adopt(entt::entity entity, entt::id_type key)
+    {
+        auto it = buckets_.find(key);
+        if (it == buckets_.end() || !it->second.deactivate_)
+        {
+            spdlog::error("EntityPool: 池 {} 未登记，实体 {} 不会被池化", key, entt::to_integral(entity));
+            return;
+        }
+        registry_.emplace_or_replace<engine::component::PooledComponent>(entity, key);
+    }
+
+    bool EntityPool::release(entt::entity entity)
+    {
+        const auto *pooled = registry_.try_get<engine::component::PooledComponent>(entity);
+        if (!pooled)
+            return false;
+        auto it = buckets_.find(pooled->pool_key_);
+        if (it == buckets_.end() || !it->second.deactivate_)
+            return false;
+        auto &bucket = it->second;
+        bucket.deactivate_(registry_, entity);
+        bucket.free_.push_back(entity);
+        ++bucket.stats_.releases_;
+        return true;
+    }
+
+    EntityPool::Stats EntityPool::getStats(entt::id_type key) const
+    {
+        auto it = buckets_.find(key);
+        if (it == buckets_.end())
+            return {};
+        auto stats = it->second.stats_;
+        stats.free_ = it->second.free_.size();
+        return stats;
+    }
+
+    EntityPool::Stats EntityPool::getStats() const
+    {
+        Stats total;
+        for (const auto &[key, bucket] : buckets_)
+        {
+            total.hits_ += bucket.stats_.hits_;
+            total.misses_ += bucket.stats_.misses_;
+            total.releases_ += bucket.stats_.releases_;
+            total.prewarmed_ += bucket.stats_.prewarmed_;
+            total.free_ += bucket.free_.size();
+        }
+        return total;
+    }
+
+    void EntityPool::clear()
+    {
+        for (auto &[key, bucket] : buckets_)
+        {
+            for (auto entity : bucket.free_)
+            {
+                if (registry_.valid(entity))
+                    registry_.destroy(entity);
+            }
+            bucket.free_.clear();
+        }
+    }
+
+} // namespace engine::core
@@ -0,0 +1,120 @@
+#pragma once
+#include "../component/pooled_component.h"
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+#include <entt/entity/registry.hpp>
+
+namespace engine::core
+{
+
+    /**
+     * @brief 实体池：按键（通常是蓝图ID）缓存停用的实体，复用实体与其组件，避免短命实体（投射物、特效）反复创建/销毁。
+     *
+     * - 登记池时声明“活动组件”：停用时只移除这些组件，实体因此不再出现在渲染、行为等系统的 view 中；
+     *   其余组件（变换、精灵、音效……）原地保留，复用时由创建者就地重置；
+     * - 池中的实体带有 PooledComponent，死亡处理（如 RemoveDeadSystem）据此调用 release() 归还实体而不是销毁；
+     * - 复用的实体ID不变（版本号不会增加），持有旧实体ID的一方需要自行确认实体仍是原来的用途。
+     *
+     * 非线程安全，只在主线程（或 exclusive 系统）中使用。
+     */
+    class EntityPool final
+    {
+    public:
+        /// @brief 池的统计数据
+        struct Stats
+        {
+            std::size_t hits_{0};      ///< @brief 取出时命中（复用停用的实体）
+            std::size_t misses_{0};    ///< @brief 取出时未命中（需要创建新实体）
+            std::size_t releases_{0};  ///< @brief 归还次数
+            std::size_t prewarmed_{0}; ///< @brief 预热创建的实体数量
+            std::size_t free_{0};      ///< @brief 当前停用（可复用）的实体数量
+
+            /// @brief 命中率（没有取出过时为0）
+            [[nodiscard]] double getHitRate() const
+            {
+                const auto total = hits_ + misses_;
+                return total > 0 ? static_cast<double>(hits_) / static_cast<double>(total) : 0.0;
+            }
+        };
+
+    private:
+        using Deactivator = void (*)(entt::registry &, entt::entity);
+
+        struct Bucket
+        {
+            std::vector<entt::entity> free_;   ///< @brief 停用的实体
+            Deactivator deactivate_{nullptr}; ///< @brief 移除活动组件
+            Stats stats_;
+        };
+
+        entt::registry &registry_;
+        std::unordered_map<entt::id_type, Bucket> buckets_;
+
+    public:
+        explicit EntityPool(entt::registry &registry);
+
+        EntityPool(const EntityPool &) = delete;
+        EntityPool &operator=(const EntityPool &) = delete;
+        EntityPool(EntityPool &&) = delete;
+        EntityPool &operator=(EntityPool &&) = delete;
+
+        /**
+         * @brief 登记池（重复登记会覆盖活动组件的声明）
+         * @tparam Active 活动组件：停用时移除，复用时由创建者重新添加
+         */
+        template <typename... Active>
+        void registerPool(entt::id_type key)
+        {
+            buckets_[key].deactivate_ = [](entt::registry &registry, entt::entity entity)
+            {
+                if constexpr (sizeof...(Active) > 0)
+                    registry.remove<Active...>(entity);
+            };
+        }
+
+        /**
+         * @brief 取出一个停用的实体
+         * @return 停用的实体（活动组件已移除，其余组件保持归还时的状态）；池为空或键未登记时返回 entt::null（记为未命中），
+         *         此时调用者应创建新实体并调用 adopt()
+         */
+        [[nodiscard]] entt::entity acquire(entt::id_type key);
+
+        /// @brief 让新创建的实体归属于池（添加 PooledComponent，池需要已经登记）
+        void adopt(entt::entity entity, entt::id_type key);
+
+        /**
+         * @brief 停用实体并归还到所属的池
+         * @return 实体不属于任何池（没有 PooledComponent 或池未登记）时返回 false，调用者应自行销毁
+         */
+        bool release(entt::entity entity);
+
+        /**
+         * @brief 预热：创建实体直到池中至少有 count 个停用的实体
+         * @param create 回调 entt::entity()，创建新实体（不含活动组件）并调用 adopt()
+         */
+        template <typename Func>
+        void prewarm(entt::id_type key, std::size_t count, Func &&create)
+        {
+            auto it = buckets_.find(key);
+            if (it == buckets_.end() || !it->second.deactivate_)
+                return;
+            auto &bucket = it->second;
+            bucket.free_.reserve(count);
+            while (bucket.free_.size() < count)
+            {
+                auto entity = create();
+                bucket.deactivate_(registry_, entity);
+                bucket.free_.push_back(entity);
+                ++bucket.stats_.prewarmed_;
+            }
+        }
+
+        [[nodiscard]] Stats getStats(entt::id_type key) const; ///< @brief 单个池的统计数据
+        [[nodiscard]] Stats getStats() const;                  ///< @brief 所有池的统计数据之和
+
+        /// @brief 销毁所有停用的实体（统计数据保留）
+        void clear();
+    };
+
+} // namespace engine::core
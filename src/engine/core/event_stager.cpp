@@ -0,0 +1,83 @@
+#include "event_stager.h"
+#include <algorithm>
+#include <spdlog/spdlog.h>
+
+namespace engine::core
+{
+
+    EventStager::EventStager(JobSystem &job_system)
+        : job_system_(job_system), slots_(job_system.getThreadSlotCount())
+    {
+        spdlog::trace("EventStager 初始化完成，线程槽位数: {}", slots_.size());
+    }
+
+    std::size_t EventStager::flush(entt::dispatcher &dispatcher)
+    {
+        std::size_t total = 0;
+        std::size_t type_count = 0;
+        for (auto &slot : slots_)
+        {
+            total += slot.count_;
+            slot.count_ = 0;
+            type_count = std::max(type_count, slot.queues_.size());
+        }
+        if (total == 0)
+        {
+            last_flush_count_ = 0;
+            return 0;
+        }
+
+        // 逐个事件类型合并（dispatcher 中不同类型的事件分别排队，只需保证同类事件的顺序）
+        for (std::size_t type = 0; type < type_count; ++type)
+        {
+            QueueBase *single = nullptr;
+            std::size_t sources = 0;
+            for (auto &slot : slots_)
+            {
+                if (type < slot.queues_.size() && slot.queues_[type] && !slot.queues_[type]->keys_.empty())
+                {
+                    single = slot.queues_[type].get();
+                    ++sources;
+                }
+            }
+            if (sources == 0)
+                continue;
+            // 常见情况：只有一个线程发送了这类事件，且顺序键已经有序，直接按发送顺序合并
+            if (sources == 1 && std::is_sorted(single->keys_.begin(), single->keys_.end()))
+            {
+                single->flushAll(dispatcher);
+                continue;
+            }
+
+            // 按 (顺序键, 槽位, 发送顺序) 排序；同一顺序键的工作只在一个线程上执行，因此槽位只区分未指定顺序键的事件
+            merge_.clear();
+            for (std::size_t slot_index = 0; slot_index < slots_.size(); ++slot_index)
+            {
+                auto &queues = slots_[slot_index].queues_;
+                if (type >= queues.size() || !queues[type])
+                    continue;
+                const auto &keys = queues[type]->keys_;
+                for (std::size_t i = 0; i < keys.size(); ++i)
+                    merge_.push_back({keys[i], static_cast<std::uint32_t>(slot_index), static_cast<std::uint32_t>(i)});
+            }
+            std::sort(merge_.begin(), merge_.end(), [](const MergeEntry &a, const MergeEntry &b)
+                      { return a.key_ != b.key_ ? a.key_ < b.key_ : (a.slot_ != b.slot_ ? a.slot_ < b.slot_ : a.index_ < b.index_); });
+            for (const auto &entry : merge_)
+                slots_[entry.slot_].queues_[type]->flushOne(dispatcher, entry.index_);
+            for (auto &slot : slots_)
+            {
+                if (type < slot.queues_.size() && slot.queues_[type])
+                    slot.queues_[type]->clear();
+            }
+        }
+        last_flush_count_ = total;
+        return total;
+    }
+
+    std::size_t EventStager::nextTypeIndex()
+    {
+        static std::atomic<std::size_t> next{0};
+        return next.fetch_add(1, std::memory_order_relaxed);
+    }
+
+} // namespace engine::core
@@ -0,0 +1,145 @@
+#pragma once
+#include "job_system.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <entt/signal/dispatcher.hpp>
+
+namespace engine::core
+{
+
+    /**
+     * @brief 事件暂存区：为每个线程（主线程 + 每个工作线程）提供独立的事件缓冲，
+     *        使并行执行的系统可以无锁地发送事件。
+     *
+     * entt::dispatcher 不是线程安全的，因此调度器中的系统（可能运行在工作线程上）通过 enqueue() 把事件写入
+     * 当前线程自己的缓冲区，GameApp 在同步点（每个tick分发事件之前）调用 flush() 把事件合并进 dispatcher 的队列。
+     *
+     * 每个事件记录发送时线程的顺序键（JobSystem::OrderKey：系统的注册序号 + parallelFor 的分块序号），
+     * 合并时同类事件按顺序键排列，相同时保持发送顺序。由哪个线程执行哪个分块（工作窃取）不影响合并结果，
+     * 因此每次运行的事件顺序都相同。没有指定顺序键的事件（如主线程在系统之外发送的）排在最前面。
+     *
+     * enqueue() 只能在主线程或所属 JobSystem 的工作线程中调用；flush() 只能在主线程、且没有任务运行时调用。
+     */
+    class EventStager final
+    {
+        /// @brief 类型擦除的单类事件队列
+        struct QueueBase
+        {
+            std::vector<std::uint64_t> keys_; ///< @brief 各事件的顺序键（与事件一一对应）
+
+            virtual ~QueueBase() = default;
+            virtual void flushAll(entt::dispatcher &dispatcher) = 0;                  ///< @brief 按发送顺序合并全部事件
+            virtual void flushOne(entt::dispatcher &dispatcher, std::size_t index) = 0; ///< @brief 合并指定的事件
+            virtual void clear() = 0;                                                ///< @brief 清空（保留容量，下一帧复用）
+        };
+
+        template <typename Event>
+        struct Queue final : QueueBase
+        {
+            std::vector<Event> events_;
+
+            void flushAll(entt::dispatcher &dispatcher) override
+            {
+                for (auto &event : events_)
+                    dispatcher.enqueue(std::move(event));
+                clear();
+            }
+
+            void flushOne(entt::dispatcher &dispatcher, std::size_t index) override
+            {
+                dispatcher.enqueue(std::move(events_[index]));
+            }
+
+            void clear() override
+            {
+                events_.clear();
+                keys_.clear();
+            }
+        };
+
+        /// @brief 合并时排序用的事件引用
+        struct MergeEntry
+        {
+            std::uint64_t key_;     ///< @brief 顺序键
+            std::uint32_t slot_;    ///< @brief 线程槽位
+            std::uint32_t index_;   ///< @brief 在该槽位队列中的下标（即发送顺序）
+        };
+
+        /// @brief 单个线程的缓冲区（对齐到缓存行，避免相邻线程的伪共享）
+        struct alignas(64) Slot
+        {
+            std::vector<std::unique_ptr<QueueBase>> queues_; ///< @brief 按事件类型编号索引
+            std::size_t count_{0};                           ///< @brief 自上次 flush 以来暂存的事件数
+        };
+
+        JobSystem &job_system_;
+        std::vector<Slot> slots_;           ///< @brief 按线程槽位索引（见 JobSystem::getCurrentThreadSlot）
+        std::size_t last_flush_count_{0};   ///< @brief 上次 flush 合并的事件数
+        std::vector<MergeEntry> merge_;     ///< @brief 合并时的排序缓冲（复用）
+
+    public:
+        explicit EventStager(JobSystem &job_system);
+
+        EventStager(const EventStager &) = delete;
+        EventStager &operator=(const EventStager &) = delete;
+        EventStager(EventStager &&) = delete;
+        EventStager &operator=(EventStager &&) = delete;
+
+        /// @brief 暂存一个事件（写入当前线程的缓冲区）
+        template <typename Event>
+        void enqueue(Event &&event)
+        {
+            using EventType = std::remove_cvref_t<Event>;
+            auto &queue = this->queue<EventType>();
+            queue.events_.push_back(std::forward<Event>(event));
+            queue.keys_.push_back(JobSystem::getCurrentOrderKey().value());
+        }
+
+        /// @brief 原地构造并暂存一个事件
+        template <typename Event, typename... Args>
+        void enqueue(Args &&...args)
+        {
+            auto &queue = this->queue<Event>();
+            queue.events_.push_back(Event{std::forward<Args>(args)...});
+            queue.keys_.push_back(JobSystem::getCurrentOrderKey().value());
+        }
+
+        /**
+         * @brief 把所有暂存的事件按顺序键合并进 dispatcher 的队列（不会触发回调）
+         * @return 合并的事件数量
+         */
+        std::size_t flush(entt::dispatcher &dispatcher);
+
+        [[nodiscard]] std::size_t getLastFlushCount() const { return last_flush_count_; } ///< @brief 上次 flush 合并的事件数
+
+    private:
+        static std::size_t nextTypeIndex(); ///< @brief 分配新的事件类型编号
+
+        template <typename Event>
+        static std::size_t typeIndex()
+        {
+            static const std::size_t index = nextTypeIndex();
+            return index;
+        }
+
+        template <typename Event>
+        Queue<Event> &queue()
+        {
+            auto &slot = slots_[job_system_.getCurrentThreadSlot()];
+            const auto index = typeIndex<Event>();
+            if (index >= slot.queues_.size())
+                slot.queues_.resize(index + 1);
+            auto &queue = slot.queues_[index];
+            if (!queue)
+                queue = std::make_unique<Queue<Event>>();
+            ++slot.count_;
+            return static_cast<Queue<Event> &>(*queue);
+        }
+    };
+
+} // namespace engine::core
@@ -3,6 +3,9 @@
 #include "context.h"
 #include "config.h"
 #include "game_state.h"
+#include "trace_recorder.h"
+#include "job_system.h"
+#include "event_stager.h"
 #include "../resource/resource_manager.h"
 #include "../audio/audio_player.h"
 #include "../render/renderer.h"
@@ -11,9 +14,17 @@
 #include "../input/input_manager.h"
 #include "../scene/scene_manager.h"
 #include "../utils/events.h"
+#include "../debug/profiler.h"
+#include "../debug/profiler_overlay.h"
+#include "../debug/async_log_sink.h"
 #include <SDL3/SDL.h>
+#include <algorithm>
+#include <cmath>
 #include <spdlog/spdlog.h>
 #include <entt/signal/dispatcher.hpp>
+#include <entt/core/hashed_string.hpp>
+
+using namespace entt::literals;
 
 namespace engine::core
 {
@@ -27,6 +38,7 @@ namespace engine::core
             spdlog::warn("GameApp 被销毁时没有显式关闭。现在关闭。 ...");
             close();
         }
+        shutdownLogger(); // 初始化失败时没有调用 close()
     }
 
     void GameApp::run()
@@ -37,17 +49,28 @@ namespace engine::core
             return;
         }
 
-        while (is_running_)
+        if (headless_)
         {
-            time_->update();
-            float delta_time = time_->getDeltaTime();
+            runHeadless();
+            close();
+            return;
+        }
 
-            handleEvents();
-            update(delta_time);
-            render();
+        while (is_running_)
+        {
+            profiler_->beginFrame();
+            {
+                ENGINE_PROFILE_SCOPE("Frame");
+                time_->update();
+                float delta_time = time_->getDeltaTime();
 
-            // 分发事件（让新创建的实体先更新再渲染）
-            dispatcher_->update();
+                handleEvents();
+                processMainThreadJobs();
+                simulate(delta_time);
+                render();
+            }
+            profiler_->endFrame();
+            trace_recorder_->endFrame();
 
             // spdlog::info("delta_time: {}", delta_time);
         }
@@ -61,6 +84,58 @@ namespace engine::core
         spdlog::trace("已注册场景设置函数。");
     }
 
+    void GameApp::setHeadless(std::uint64_t max_ticks, float delta_time)
+    {
+        headless_ = true;
+        headless_max_ticks_ = max_ticks;
+        if (delta_time > 0.0f)
+        {
+            headless_delta_time_ = delta_time;
+        }
+        else
+        {
+            spdlog::warn("无头模式的 tick 时长必须大于 0，使用默认值 {:.6f}s。", headless_delta_time_);
+        }
+    }
+
+    void GameApp::registerHeadlessReport(std::function<void(const HeadlessReport &)> func)
+    {
+        headless_report_func_ = std::move(func);
+        spdlog::trace("已注册无头模拟报告函数。");
+    }
+
+    void GameApp::runHeadless()
+    {
+        spdlog::info("无头模拟开始: 最多 {} 个tick, 每个tick {:.6f}s", headless_max_ticks_, headless_delta_time_);
+        const auto start_ns = SDL_GetTicksNS();
+        std::uint64_t ticks = 0;
+        while (is_running_ && (headless_max_ticks_ == 0 || ticks < headless_max_ticks_))
+        {
+            profiler_->beginFrame();
+            handleEvents(); // 仍然泵取SDL事件（dummy驱动下通常为空），保证退出事件等能被处理
+            processMainThreadJobs();
+            dispatchEvents();
+            update(headless_delta_time_);
+            profiler_->endFrame();
+            trace_recorder_->endFrame();
+            ++ticks;
+        }
+        dispatchEvents(); // 处理最后一个tick产生的事件，保证统计数据完整
+
+        HeadlessReport report;
+        report.ticks_ = ticks;
+        report.simulated_seconds_ = static_cast<double>(ticks) * headless_delta_time_;
+        report.wall_seconds_ = static_cast<double>(SDL_GetTicksNS() - start_ns) / 1000000000.0;
+        report.ticks_per_second_ = report.wall_seconds_ > 0.0 ? static_cast<double>(ticks) / report.wall_seconds_ : 0.0;
+        report.scene_ = scene_manager_->getCurrentScene();
+        spdlog::info("无头模拟结束: {} 个tick, 模拟时长 {:.2f}s, 实际耗时 {:.3f}s, {:.0f} ticks/s",
+                     report.ticks_, report.simulated_seconds_, report.wall_seconds_, report.ticks_per_second_);
+        if (headless_report_func_)
+        {
+            headless_report_func_(report);
+        }
+    }
+
     bool GameApp::init()
     {
         spdlog::trace("初始化 GameApp ...");
@@ -69,11 +144,21 @@ namespace engine::core
             spdlog::error("未注册场景设置函数，无法初始化 GameApp。");
             return false;
         }
+        if (!initProfiler())
+            return false;
         if (!initDispatcher())
             return false;
         if (!initConfig())
             return false;
-        if (!initSDL())
+        if (!initLogger())
+            return false;
+        if (!initTraceRecorder())
+            return false;
+        if (!initJobSystem())
+            return false;
+        if (!initEventStager())
+            return false;
+        if (!(headless_ ? initHeadlessSDL() : initSDL()))
             return false;
         if (!initGameState())
             return false;
@@ -91,6 +176,8 @@ namespace engine::core
             return false;
         if (!initInputManager())
             return false;
+        if (!initProfilerOverlay())
+            return false;
 
         if (!initContext())
             return false;
@@ -102,6 +189,8 @@ namespace engine::core
 
         // 注册退出事件 (回调函数可以无参数，代表不使用事件结构体中的数据)
         dispatcher_->sink<utils::QuitEvent>().connect<&GameApp::onQuitEvent>(this);
+        input_manager_->onAction("toggle_profiler"_hs).connect<&GameApp::onToggleProfiler>(this);
+        input_manager_->onAction("toggle_trace"_hs).connect<&GameApp::onToggleTrace>(this);
 
         is_running_ = true;
         spdlog::trace("GameApp 初始化成功。");
@@ -111,24 +200,87 @@ namespace engine::core
     void GameApp::handleEvents()
     {
         // 处理并分发输入事件
+        ENGINE_PROFILE_SCOPE("Input::update");
         input_manager_->update();
     }
 
+    void GameApp::processMainThreadJobs()
+    {
+        // 执行工作线程提交的、必须在主线程完成的任务（如创建纹理）
+        ENGINE_PROFILE_SCOPE("JobSystem::processMainThreadQueue");
+        job_system_->processMainThreadQueue();
+    }
+
+    void GameApp::dispatchEvents()
+    {
+        ENGINE_PROFILE_SCOPE("Dispatcher::update");
+        // 先把各线程暂存的事件按线程槽位顺序合并进队列，再统一分发
+        const auto staged = event_stager_->flush(*dispatcher_);
+        profiler_->setCounter("Staged events", static_cast<std::int64_t>(staged));
+        if (log_sink_)
+        {
+            profiler_->setCounter("Log dropped", static_cast<std::int64_t>(log_sink_->getDroppedCount()));
+        }
+        dispatcher_->update();
+    }
+
     void GameApp::update(float delta_time)
     {
         // 游戏逻辑更新
+        ENGINE_PROFILE_SCOPE("Scene::update");
         scene_manager_->update(delta_time);
     }
 
+    void GameApp::simulate(float frame_time)
+    {
+        if (!time_->isFixedTimestep())
+        { // 可变步长：每帧更新一次，分发事件放在更新之前（让新创建的实体先更新再渲染）
+            dispatchEvents();
+            update(frame_time);
+            return;
+        }
+
+        // 固定步长：限制单帧计入的时间，避免长帧后一次性追赶过多
+        accumulator_ += std::min(frame_time, config_->max_frame_time_);
+        const double fixed_delta_time = time_->getFixedDeltaTime();
+        int ticks = 0;
+        while (accumulator_ >= fixed_delta_time && ticks < config_->max_ticks_per_frame_)
+        {
+            dispatchEvents(); // 每个tick开始时分发上一个tick产生的事件
+            update(static_cast<float>(fixed_delta_time));
+            accumulator_ -= fixed_delta_time;
+            ++ticks;
+        }
+        // 达到单帧tick上限仍然落后时，丢弃积压的时间（“死亡螺旋”保护），只保留不足一个tick的部分
+        if (accumulator_ >= fixed_delta_time)
+        {
+            spdlog::debug("模拟落后，丢弃 {:.3f}s 的积压时间（本帧已执行 {} 个tick）", accumulator_ - std::fmod(accumulator_, fixed_delta_time), ticks);
+            accumulator_ = std::fmod(accumulator_, fixed_delta_time);
+        }
+        // 渲染时在上一个tick与当前tick的状态之间插值
+        time_->setInterpolationAlpha(static_cast<float>(accumulator_ / fixed_delta_time));
+    }
+
     void GameApp::render()
     {
         // 1. 清除屏幕
         renderer_->clearScreen();
 
         // 2. 具体渲染代码
-        scene_manager_->render();
+        {
+            ENGINE_PROFILE_SCOPE("Scene::render");
+            scene_manager_->render();
+        }
+
+        // 3. 调试叠加层（显示的是上一帧及之前的数据）
+        if (profiler_overlay_)
+        {
+            ENGINE_PROFILE_SCOPE("ProfilerOverlay::render");
+            profiler_overlay_->render();
+        }
 
-        // 3. 更新屏幕显示
+        // 4. 更新屏幕显示
+        ENGINE_PROFILE_SCOPE("Renderer::present");
         renderer_->present();
     }
 
@@ -138,11 +290,19 @@ namespace engine::core
 
         // 断开事件处理函数
         dispatcher_->sink<utils::QuitEvent>().disconnect<&GameApp::onQuitEvent>(this);
+        input_manager_->onAction("toggle_profiler"_hs).disconnect<&GameApp::onToggleProfiler>(this);
+        input_manager_->onAction("toggle_trace"_hs).disconnect<&GameApp::onToggleTrace>(this);
+
+        // 正在记录的 trace 在退出时写出
+        trace_recorder_->stop();
 
         // 先关闭场景管理器，确保所有场景都被清理
         scene_manager_->close();
+        // 场景清理后关闭任务系统（会先执行完已提交的任务），此后不再有工作线程访问资源
+        job_system_.reset();
 
         // 为了确保正确的销毁顺序，有些智能指针对象也需要手动管理
+        profiler_overlay_.reset(); // ImGui 后端依赖渲染器，需在销毁渲染器之前关闭
         resource_manager_.reset();
 
         if (sdl_renderer_ != nullptr)
@@ -155,8 +315,28 @@ namespace engine::core
             SDL_DestroyWindow(window_);
             window_ = nullptr;
         }
+        if (headless_surface_ != nullptr)
+        {
+            SDL_DestroySurface(headless_surface_);
+            headless_surface_ = nullptr;
+        }
         SDL_Quit();
         is_running_ = false;
+        shutdownLogger(); // 最后恢复同步日志
+    }
+
+    void GameApp::shutdownLogger()
+    {
+        if (!log_sink_)
+            return;
+        if (const auto dropped = log_sink_->getDroppedCount(); dropped > 0)
+        {
+            spdlog::warn("异步日志缓冲区曾经已满，共丢弃 {} 条日志（容量 {}）。", dropped, log_sink_->getCapacity());
+        }
+        // 恢复原默认日志器后异步 sink 不再被引用，销毁时停止后台线程并输出剩余的消息
+        spdlog::set_default_logger(previous_logger_);
+        previous_logger_.reset();
+        log_sink_.reset();
     }
 
     bool GameApp::initDispatcher()
@@ -189,6 +369,35 @@ namespace engine::core
         return true;
     }
 
+    bool GameApp::initLogger()
+    {
+        if (config_->log_queue_size_ == 0)
+        {
+            spdlog::trace("日志使用同步输出。");
+            return true;
+        }
+        try
+        {
+            // 异步 sink 包装原默认日志器的 sink（输出目标与格式不变），新日志器沿用原来的名称与级别
+            previous_logger_ = spdlog::default_logger();
+            log_sink_ = std::make_shared<engine::debug::AsyncLogSink>(previous_logger_->sinks(),
+                                                                      static_cast<std::size_t>(config_->log_queue_size_));
+            auto logger = std::make_shared<spdlog::logger>(previous_logger_->name(), log_sink_);
+            logger->set_level(previous_logger_->level());
+            logger->flush_on(spdlog::level::err); // 错误立即输出，避免随后崩溃时丢失
+            spdlog::set_default_logger(std::move(logger));
+        }
+        catch (const std::exception &e)
+        {
+            spdlog::error("初始化异步日志失败: {}", e.what());
+            log_sink_.reset();
+            previous_logger_.reset();
+            return false;
+        }
+        spdlog::trace("异步日志初始化成功，缓冲区容量: {}", log_sink_->getCapacity());
+        return true;
+    }
+
     bool GameApp::initSDL()
     {
         if (!SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO))
@@ -230,6 +439,38 @@ namespace engine::core
         return true;
     }
 
+    bool GameApp::initHeadlessSDL()
+    {
+        // 使用dummy驱动，不需要显示设备和声卡
+        SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "dummy");
+        SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+        if (!SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO))
+        {
+            spdlog::error("SDL 初始化失败(无头模式)! SDL错误: {}", SDL_GetError());
+            return false;
+        }
+
+        // 不创建窗口，只创建一个逻辑分辨率大小的离屏表面，并在其上创建软件渲染器（资源加载、文字引擎等仍需要渲染器）
+        int logical_width = static_cast<int>(static_cast<float>(config_->window_width_) * config_->window_logical_scale_);
+        int logical_height = static_cast<int>(static_cast<float>(config_->window_height_) * config_->window_logical_scale_);
+        headless_surface_ = SDL_CreateSurface(logical_width, logical_height, SDL_PIXELFORMAT_RGBA32);
+        if (headless_surface_ == nullptr)
+        {
+            spdlog::error("无法创建离屏表面! SDL错误: {}", SDL_GetError());
+            return false;
+        }
+        sdl_renderer_ = SDL_CreateSoftwareRenderer(headless_surface_);
+        if (sdl_renderer_ == nullptr)
+        {
+            spdlog::error("无法创建软件渲染器! SDL错误: {}", SDL_GetError());
+            return false;
+        }
+        SDL_SetRenderDrawBlendMode(sdl_renderer_, SDL_BLENDMODE_BLEND);
+        SDL_SetRenderLogicalPresentation(sdl_renderer_, logical_width, logical_height, SDL_LOGICAL_PRESENTATION_LETTERBOX);
+        spdlog::trace("SDL 初始化成功(无头模式)。");
+        return true;
+    }
+
     bool GameApp::initGameState()
     {
         try
@@ -256,6 +497,7 @@ namespace engine::core
             return false;
         }
         time_->setTargetFps(config_->target_fps_);
+        time_->setFixedTickRate(config_->fixed_tick_rate_);
         spdlog::trace("时间管理初始化成功。");
         return true;
     }
@@ -283,6 +525,7 @@ namespace engine::core
             audio_player_ = std::make_unique<engine::audio::AudioPlayer>(resource_manager_.get());
             audio_player_->setMusicVolume(config_->music_volume_); // 设置背景音乐音量
             audio_player_->setSoundVolume(config_->sound_volume_); // 设置音效音量
+            audio_player_->setMuted(headless_);                    // 无头模式下不播放任何声音
         }
         catch (const std::exception &e)
         {
@@ -298,6 +541,7 @@ namespace engine::core
         try
         {
             renderer_ = std::make_unique<engine::render::Renderer>(sdl_renderer_, resource_manager_.get());
+            renderer_->setBatchingEnabled(config_->sprite_batching_);
         }
         catch (const std::exception &e)
         {
@@ -364,7 +608,11 @@ namespace engine::core
                                                                *text_renderer_,
                                                                *resource_manager_,
                                                                *audio_player_,
-                                                               *game_state_);
+                                                               *game_state_,
+                                                               *time_,
+                                                               *job_system_,
+                                                               *event_stager_,
+                                                               *config_);
         }
         catch (const std::exception &e)
         {
@@ -389,10 +637,111 @@ namespace engine::core
         return true;
     }
 
+    bool GameApp::initProfiler()
+    {
+        try
+        {
+            profiler_ = std::make_unique<engine::debug::Profiler>();
+            engine::debug::Profiler::setCurrent(profiler_.get());
+        }
+        catch (const std::exception &e)
+        {
+            spdlog::error("初始化帧分析器失败: {}", e.what());
+            return false;
+        }
+        spdlog::trace("帧分析器初始化成功。");
+        return true;
+    }
+
+    bool GameApp::initProfilerOverlay()
+    {
+        if (headless_)
+            return true; // 无头模式没有窗口，不需要叠加层
+        try
+        {
+            profiler_overlay_ = std::make_unique<engine::debug::ProfilerOverlay>(window_, sdl_renderer_, *profiler_);
+        }
+        catch (const std::exception &e)
+        {
+            spdlog::error("初始化分析器叠加层失败: {}", e.what());
+            return false;
+        }
+        spdlog::trace("分析器叠加层初始化成功。");
+        return true;
+    }
+
+    bool GameApp::initTraceRecorder()
+    {
+        try
+        {
+            trace_recorder_ = std::make_unique<engine::core::TraceRecorder>(config_->trace_output_dir_,
+                                                                            static_cast<std::size_t>(config_->trace_max_events_));
+            engine::core::TraceRecorder::setCurrent(trace_recorder_.get());
+        }
+        catch (const std::exception &e)
+        {
+            spdlog::error("初始化 trace 记录器失败: {}", e.what());
+            return false;
+        }
+        // 在加载资源之前开始记录，以便捕获资源加载的耗时
+        if (config_->trace_on_start_)
+        {
+            trace_recorder_->start();
+        }
+        spdlog::trace("trace 记录器初始化成功。");
+        return true;
+    }
+
+    bool GameApp::initJobSystem()
+    {
+        try
+        {
+            job_system_ = std::make_unique<engine::core::JobSystem>(config_->worker_threads_);
+        }
+        catch (const std::exception &e)
+        {
+            spdlog::error("初始化任务系统失败: {}", e.what());
+            return false;
+        }
+        spdlog::trace("任务系统初始化成功。");
+        return true;
+    }
+
+    bool GameApp::initEventStager()
+    {
+        try
+        {
+            event_stager_ = std::make_unique<engine::core::EventStager>(*job_system_);
+        }
+        catch (const std::exception &e)
+        {
+            spdlog::error("初始化事件暂存区失败: {}", e.what());
+            return false;
+        }
+        spdlog::trace("事件暂存区初始化成功。");
+        return true;
+    }
+
     void GameApp::onQuitEvent()
     {
         spdlog::trace("GameApp 收到来自事件分发器的退出请求。");
         is_running_ = false;
     }
 
+    bool GameApp::onToggleProfiler()
+    {
+        if (profiler_overlay_)
+        {
+            profiler_overlay_->toggle();
+            spdlog::debug("分析器叠加层: {}", profiler_overlay_->isVisible() ? "显示" : "隐藏");
+        }
+        return false;
+    }
+
+    bool GameApp::onToggleTrace()
+    {
+        trace_recorder_->toggle();
+        return false;
+    }
+
 } // namespace engine::core
\ No newline at end of file
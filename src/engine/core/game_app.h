@@ -1,11 +1,18 @@
 #pragma once
 #include <memory>
 #include <functional>
+#include <cstdint>
 #include <entt/signal/fwd.hpp>
 
 // 前向声明, 减少头文件的依赖，增加编译速度
 struct SDL_Window;
 struct SDL_Renderer;
+struct SDL_Surface;
+
+namespace spdlog
+{
+    class logger;
+}
 
 namespace engine::resource
 {
@@ -27,6 +34,7 @@ namespace engine::input
 namespace engine::scene
 {
     class SceneManager;
+    class Scene;
 }
 
 namespace engine::audio
@@ -34,12 +42,34 @@ namespace engine::audio
     class AudioPlayer;
 }
 
+namespace engine::debug
+{
+    class Profiler;
+    class ProfilerOverlay;
+    class AsyncLogSink;
+}
+
 namespace engine::core
 { // 命名空间的最佳实践：与文件路径一致
     class Time;
     class Config;
     class Context;
     class GameState;
+    class TraceRecorder;
+    class JobSystem;
+    class EventStager;
+
+    /**
+     * @brief 无头模拟结束后的报告数据
+     */
+    struct HeadlessReport
+    {
+        std::uint64_t ticks_{0};             ///< @brief 执行的模拟tick数
+        double simulated_seconds_{0.0};      ///< @brief 模拟的游戏内时长（秒）
+        double wall_seconds_{0.0};           ///< @brief 实际耗时（秒）
+        double ticks_per_second_{0.0};       ///< @brief 实际每秒执行的tick数
+        engine::scene::Scene *scene_{nullptr}; ///< @brief 结束时的活动场景（可能为空），用于读取场景内的统计数据
+    };
 
     /**
      * @brief 主游戏应用程序类，初始化SDL，管理游戏循环。
@@ -49,7 +79,15 @@ namespace engine::core
     private:
         SDL_Window *window_ = nullptr;
         SDL_Renderer *sdl_renderer_ = nullptr;
+        SDL_Surface *headless_surface_ = nullptr; ///< @brief 无头模式下软件渲染器的离屏目标
         bool is_running_ = false;
+        double accumulator_ = 0.0; ///< @brief 固定步长模拟的时间累积器（秒）
+
+        // 无头模式（无窗口、无绘制、无声音，以固定步长不限速地运行模拟）
+        bool headless_ = false;                    ///< @brief 是否为无头模式
+        std::uint64_t headless_max_ticks_ = 0;     ///< @brief 无头模式下最多执行的tick数，0 表示直到收到退出事件
+        float headless_delta_time_ = 1.0f / 60.0f; ///< @brief 无头模式下每个tick的时长（秒）
+        std::function<void(const HeadlessReport &)> headless_report_func_; ///< @brief 无头模拟结束后的报告回调
 
         /// @brief 游戏场景设置函数，用于在运行游戏前设置初始场景 (GameApp不再决定初始场景是什么)
         std::function<void(engine::core::Context &)> scene_setup_func_;
@@ -67,6 +105,13 @@ namespace engine::core
         std::unique_ptr<engine::scene::SceneManager> scene_manager_;
         std::unique_ptr<engine::audio::AudioPlayer> audio_player_;
         std::unique_ptr<engine::core::GameState> game_state_;
+        std::unique_ptr<engine::debug::Profiler> profiler_;               // 帧分析器
+        std::unique_ptr<engine::debug::ProfilerOverlay> profiler_overlay_; // 分析器的 ImGui 叠加层（无头模式下为空）
+        std::unique_ptr<engine::core::TraceRecorder> trace_recorder_;     // trace 记录器（Chrome/Perfetto trace-event JSON）
+        std::unique_ptr<engine::core::JobSystem> job_system_;             // 任务系统（工作窃取线程池）
+        std::unique_ptr<engine::core::EventStager> event_stager_;         // 事件暂存区（工作线程发送的事件在同步点合并进 dispatcher）
+        std::shared_ptr<engine::debug::AsyncLogSink> log_sink_;           // 异步日志 sink（为空表示同步输出日志）
+        std::shared_ptr<spdlog::logger> previous_logger_;                 // 安装异步日志之前的默认日志器，关闭时恢复
 
     public:
         GameApp();
@@ -84,6 +129,23 @@ namespace engine::core
          */
         void registerSceneSetup(std::function<void(engine::core::Context &)> func);
 
+        /**
+         * @brief 启用无头模式（需在 run() 之前调用）。
+         *        不创建窗口，使用离屏的软件渲染器加载资源，跳过所有绘制，音频静音，
+         *        以固定步长不限速地执行模拟，适用于没有显示设备的构建服务器上的批量平衡测试。
+         * @param max_ticks 最多执行的tick数，0 表示直到收到退出事件
+         * @param delta_time 每个tick的时长（秒）
+         */
+        void setHeadless(std::uint64_t max_ticks, float delta_time);
+
+        /**
+         * @brief 注册无头模拟结束后的报告函数（在场景关闭之前调用）。
+         * @param func 接收 HeadlessReport 的函数对象。
+         */
+        void registerHeadlessReport(std::function<void(const HeadlessReport &)> func);
+
+        bool isHeadless() const { return headless_; }
+
         // 禁止拷贝和移动
         GameApp(const GameApp &) = delete;
         GameApp &operator=(const GameApp &) = delete;
@@ -93,14 +155,21 @@ namespace engine::core
     private:
         [[nodiscard]] bool init(); // nodiscard 表示该函数返回值不应该被忽略
         void handleEvents();
+        void processMainThreadJobs(); ///< @brief 执行任务系统的主线程队列
+        void dispatchEvents();        ///< @brief 同步点：合并暂存的事件，然后分发 dispatcher 队列中的所有事件
         void update(float delta_time);
+        void simulate(float frame_time); ///< @brief 推进模拟：固定步长时按累积时间执行若干tick，否则执行一次可变步长更新
         void render();
         void close();
+        void runHeadless(); ///< @brief 无头模式的主循环
+        void shutdownLogger(); ///< @brief 恢复同步日志（输出异步缓冲区中剩余的消息）
 
         // 各模块的初始化/创建函数，在init()中调用
         [[nodiscard]] bool initDispatcher();
         [[nodiscard]] bool initConfig();
+        [[nodiscard]] bool initLogger(); ///< @brief 把默认日志器的输出改为异步（根据配置）
         [[nodiscard]] bool initSDL();
+        [[nodiscard]] bool initHeadlessSDL(); ///< @brief 无头模式下的SDL初始化（dummy驱动 + 离屏软件渲染器）
         [[nodiscard]] bool initGameState();
         [[nodiscard]] bool initTime();
         [[nodiscard]] bool initResourceManager();
@@ -111,9 +180,16 @@ namespace engine::core
         [[nodiscard]] bool initInputManager();
         [[nodiscard]] bool initContext();
         [[nodiscard]] bool initSceneManager();
+        [[nodiscard]] bool initProfiler();
+        [[nodiscard]] bool initProfilerOverlay();
+        [[nodiscard]] bool initTraceRecorder();
+        [[nodiscard]] bool initJobSystem();
+        [[nodiscard]] bool initEventStager();
 
         // 事件处理函数
         void onQuitEvent();
+        bool onToggleProfiler(); ///< @brief 切换分析器叠加层的显示
+        bool onToggleTrace();    ///< @brief 开始/停止记录 trace
     };
 
 } // namespace engine::core
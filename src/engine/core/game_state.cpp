@@ -6,9 +6,10 @@ namespace engine::core {
 
 GameState::GameState(SDL_Window* window, SDL_Renderer* renderer, State initial_state)
     : window_(window), renderer_(renderer), current_state_(initial_state){
-    if (window_ == nullptr || renderer_ == nullptr) {
-        spdlog::error("窗口或渲染器为空");
-        throw std::runtime_error("窗口或渲染器不能为空");
+    // 无头模式下没有窗口，只要求渲染器有效
+    if (renderer_ == nullptr) {
+        spdlog::error("渲染器为空");
+        throw std::runtime_error("渲染器不能为空");
     }
     spdlog::trace("游戏状态初始化完成");
 }
@@ -24,6 +25,9 @@ void GameState::setState(State new_state) {
 
 glm::vec2 GameState::getWindowSize() const
 {
+    if (window_ == nullptr) {   // 无头模式：没有窗口，以逻辑分辨率作为窗口大小
+        return getLogicalSize();
+    }
     int width, height;
     // SDL3获取窗口大小的方法
     SDL_GetWindowSize(window_, &width, &height);
@@ -32,6 +36,7 @@ glm::vec2 GameState::getWindowSize() const
 
 void GameState::setWindowSize(const glm::vec2& window_size)
 {
+    if (window_ == nullptr) return;
     SDL_SetWindowSize(window_, static_cast<int>(window_size.x), static_cast<int>(window_size.y));
 }
 
@@ -27,14 +27,14 @@ enum class State {
  */
 class GameState final {
 private:    
-    SDL_Window* window_ = nullptr;              ///< @brief SDL窗口，用于获取窗口大小
+    SDL_Window* window_ = nullptr;              ///< @brief SDL窗口，用于获取窗口大小（无头模式下为空）
     SDL_Renderer* renderer_ = nullptr;          ///< @brief SDL渲染器，用于获取逻辑分辨率
     State current_state_ = State::Title;        ///< @brief 当前游戏状态
 
 public:
     /**
      * @brief 构造函数，初始化游戏状态。
-     * @param window SDL窗口，必须传入有效值。
+     * @param window SDL窗口，无头模式下可以为空。
      * @param renderer SDL渲染器，必须传入有效值。
      * @param initial_state 游戏的初始状态，默认为 Title
      */
@@ -0,0 +1,303 @@
+#include "job_system.h"
+#include <spdlog/spdlog.h>
+#include <exception>
+
+namespace engine::core
+{
+
+    namespace
+    {
+        /// @brief 当前线程的工作线程编号，非工作线程为 NOT_A_WORKER
+        constexpr std::size_t NOT_A_WORKER = static_cast<std::size_t>(-1);
+        thread_local std::size_t tls_worker_index = NOT_A_WORKER;
+        thread_local const JobSystem *tls_owner = nullptr; ///< @brief 工作线程所属的 JobSystem
+        thread_local JobSystem::OrderKey tls_order_key;      ///< @brief 当前线程的顺序键
+    }
+
+    JobSystem::OrderKey JobSystem::getCurrentOrderKey()
+    {
+        return tls_order_key;
+    }
+
+    void JobSystem::setCurrentOrderKey(OrderKey key)
+    {
+        tls_order_key = key;
+    }
+
+    JobSystem::JobSystem(int worker_count)
+        : main_thread_id_(std::this_thread::get_id())
+    {
+        if (worker_count < 0)
+        {
+            const auto hardware_threads = std::thread::hardware_concurrency();
+            worker_count = hardware_threads > 1 ? static_cast<int>(hardware_threads) - 1 : 0;
+        }
+
+        worker_queues_.reserve(static_cast<std::size_t>(worker_count));
+        for (int i = 0; i < worker_count; ++i)
+        {
+            worker_queues_.push_back(std::make_unique<WorkerQueue>());
+        }
+        workers_.reserve(static_cast<std::size_t>(worker_count));
+        for (int i = 0; i < worker_count; ++i)
+        {
+            workers_.emplace_back(&JobSystem::workerLoop, this, static_cast<std::size_t>(i));
+        }
+        spdlog::info("JobSystem 初始化完成，工作线程数: {}", workers_.size());
+    }
+
+    std::size_t JobSystem::getCurrentThreadSlot() const
+    {
+        return tls_owner == this ? tls_worker_index + 1 : 0;
+    }
+
+    JobSystem::~JobSystem()
+    {
+        // 先把已提交的任务执行完（包括主线程队列），再通知工作线程退出
+        while (queued_.load() > 0 && tryRunOne())
+        {
+        }
+        processMainThreadQueue();
+        {
+            std::lock_guard lock(sleep_mutex_);
+            stopping_.store(true);
+        }
+        wake_cv_.notify_all();
+        for (auto &worker : workers_)
+        {
+            if (worker.joinable())
+                worker.join();
+        }
+        spdlog::trace("JobSystem 已关闭。");
+    }
+
+    JobHandle JobSystem::submit(std::function<void()> task, std::span<const JobHandle> dependencies)
+    {
+        auto job = std::make_shared<detail::Job>();
+        job->task_ = std::move(task);
+        return submitJob(std::move(job), dependencies);
+    }
+
+    JobHandle JobSystem::runOnMainThread(std::function<void()> task, std::span<const JobHandle> dependencies)
+    {
+        auto job = std::make_shared<detail::Job>();
+        job->task_ = std::move(task);
+        job->main_thread_ = true;
+        return submitJob(std::move(job), dependencies);
+    }
+
+    JobHandle JobSystem::submitJob(JobPtr job, std::span<const JobHandle> dependencies)
+    {
+        // 登记到每个未完成的依赖上；依赖完成时会减少 pending_
+        for (const auto &dependency : dependencies)
+        {
+            if (!dependency.job_)
+                continue;
+            std::lock_guard lock(dependency.job_->mutex_);
+            if (!dependency.job_->done_.load(std::memory_order_acquire))
+            {
+                job->pending_.fetch_add(1, std::memory_order_relaxed);
+                dependency.job_->continuations_.push_back(job);
+            }
+        }
+        // 去掉提交保护，如果依赖都已完成，立即调度
+        if (job->pending_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            schedule(job);
+        }
+        return JobHandle(std::move(job));
+    }
+
+    void JobSystem::schedule(JobPtr job)
+    {
+        if (job->main_thread_)
+        {
+            std::lock_guard lock(main_mutex_);
+            main_jobs_.push_back(std::move(job));
+            return;
+        }
+
+        if (tls_owner == this && tls_worker_index != NOT_A_WORKER)
+        { // 工作线程提交的任务放入自己的队列尾部
+            auto &queue = *worker_queues_[tls_worker_index];
+            std::lock_guard lock(queue.mutex_);
+            queue.jobs_.push_back(std::move(job));
+        }
+        else
+        {
+            std::lock_guard lock(global_mutex_);
+            global_jobs_.push_back(std::move(job));
+        }
+        queued_.fetch_add(1, std::memory_order_release);
+        {
+            // 与工作线程检查等待条件的过程串行化，避免丢失唤醒
+            std::lock_guard lock(sleep_mutex_);
+        }
+        wake_cv_.notify_one();
+    }
+
+    void JobSystem::execute(const JobPtr &job)
+    {
+        // 任务不继承执行线程当前的顺序键（等待中的线程会帮忙执行其它任务），需要时由任务自己指定
+        const OrderScope order_scope(OrderKey{});
+        try
+        {
+            job->task_();
+        }
+        catch (const std::exception &e)
+        {
+            spdlog::error("JobSystem: 任务执行时抛出异常: {}", e.what());
+        }
+        catch (...)
+        {
+            spdlog::error("JobSystem: 任务执行时抛出未知异常");
+        }
+        job->task_ = nullptr; // 尽早释放任务捕获的资源
+
+        // 标记完成并取出后续任务（加锁保证不会与 submitJob 中的登记交错）
+        std::vector<JobPtr> continuations;
+        {
+            std::lock_guard lock(job->mutex_);
+            job->done_.store(true, std::memory_order_release);
+            continuations.swap(job->continuations_);
+        }
+        for (auto &continuation : continuations)
+        {
+            if (continuation->pending_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                schedule(std::move(continuation));
+            }
+        }
+    }
+
+    JobSystem::JobPtr JobSystem::tryPop(std::size_t worker_index)
+    {
+        // 1. 自己的队列（尾部，后进先出）
+        if (worker_index != NOT_A_WORKER)
+        {
+            auto &queue = *worker_queues_[worker_index];
+            std::lock_guard lock(queue.mutex_);
+            if (!queue.jobs_.empty())
+            {
+                auto job = std::move(queue.jobs_.back());
+                queue.jobs_.pop_back();
+                queued_.fetch_sub(1, std::memory_order_relaxed);
+                return job;
+            }
+        }
+        // 2. 全局注入队列（头部，先进先出）
+        {
+            std::lock_guard lock(global_mutex_);
+            if (!global_jobs_.empty())
+            {
+                auto job = std::move(global_jobs_.front());
+                global_jobs_.pop_front();
+                queued_.fetch_sub(1, std::memory_order_relaxed);
+                return job;
+            }
+        }
+        // 3. 从其它工作线程的队列头部窃取
+        const std::size_t count = worker_queues_.size();
+        const std::size_t start = worker_index == NOT_A_WORKER ? 0 : worker_index + 1;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const std::size_t victim = (start + i) % count;
+            if (victim == worker_index)
+                continue;
+            auto &queue = *worker_queues_[victim];
+            std::unique_lock lock(queue.mutex_, std::try_to_lock); // 被占用就换下一个，避免争抢
+            if (lock.owns_lock() && !queue.jobs_.empty())
+            {
+                auto job = std::move(queue.jobs_.front());
+                queue.jobs_.pop_front();
+                queued_.fetch_sub(1, std::memory_order_relaxed);
+                return job;
+            }
+        }
+        return nullptr;
+    }
+
+    bool JobSystem::tryRunOne()
+    {
+        const auto worker_index = tls_owner == this ? tls_worker_index : NOT_A_WORKER;
+        if (auto job = tryPop(worker_index))
+        {
+            execute(job);
+            return true;
+        }
+        return false;
+    }
+
+    std::size_t JobSystem::processMainThreadQueue()
+    {
+        if (!isMainThread())
+        {
+            spdlog::error("JobSystem: processMainThreadQueue 只能在主线程调用");
+            return 0;
+        }
+        std::size_t executed = 0;
+        // 执行过程中可能产生新的主线程任务，循环直到队列为空
+        std::vector<JobPtr> jobs;
+        while (true)
+        {
+            {
+                std::lock_guard lock(main_mutex_);
+                if (main_jobs_.empty())
+                    break;
+                jobs.swap(main_jobs_);
+            }
+            for (auto &job : jobs)
+            {
+                execute(job);
+                ++executed;
+            }
+            jobs.clear();
+        }
+        return executed;
+    }
+
+    void JobSystem::wait(const JobHandle &handle)
+    {
+        const bool on_main_thread = isMainThread();
+        if (!on_main_thread && handle.job_ && handle.job_->main_thread_ && !handle.isDone())
+        {
+            spdlog::debug("JobSystem: 非主线程在等待主线程任务，需等到主线程处理主线程队列");
+        }
+        while (!handle.isDone())
+        {
+            if (tryRunOne())
+                continue;
+            if (on_main_thread && processMainThreadQueue() > 0)
+                continue;
+            std::this_thread::yield(); // 剩下的任务都在其它线程上执行
+        }
+    }
+
+    void JobSystem::waitAll(std::span<const JobHandle> handles)
+    {
+        for (const auto &handle : handles)
+        {
+            wait(handle);
+        }
+    }
+
+    void JobSystem::workerLoop(std::size_t worker_index)
+    {
+        tls_worker_index = worker_index;
+        tls_owner = this;
+        while (true)
+        {
+            if (auto job = tryPop(worker_index))
+            {
+                execute(job);
+                continue;
+            }
+            std::unique_lock lock(sleep_mutex_);
+            wake_cv_.wait(lock, [this]()
+                          { return stopping_.load() || queued_.load(std::memory_order_acquire) > 0; });
+            if (stopping_.load() && queued_.load() == 0)
+                break;
+        }
+    }
+
+} // namespace engine::core
@@ -0,0 +1,270 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include <entt/entity/entity.hpp>
+
+namespace engine::core
+{
+
+    class JobSystem;
+
+    namespace detail
+    {
+        /// @brief 任务的内部状态（由 JobHandle 共享持有）
+        struct Job
+        {
+            std::function<void()> task_;                  ///< @brief 要执行的任务
+            std::atomic<int> pending_{1};                 ///< @brief 尚未完成的依赖数（+1 为提交保护，提交完成后减去）
+            std::atomic<bool> done_{false};               ///< @brief 是否已完成
+            bool main_thread_{false};                     ///< @brief 是否只能在主线程执行
+            std::mutex mutex_;                            ///< @brief 保护 continuations_ 与完成状态的切换
+            std::vector<std::shared_ptr<Job>> continuations_; ///< @brief 依赖此任务的后续任务
+        };
+    }
+
+    /**
+     * @brief 任务句柄，可用于查询完成状态、等待任务或作为其它任务的依赖。
+     *        默认构造的句柄是“空”的，视为已完成。
+     */
+    class JobHandle
+    {
+        friend class JobSystem;
+        std::shared_ptr<detail::Job> job_;
+
+        explicit JobHandle(std::shared_ptr<detail::Job> job) : job_(std::move(job)) {}
+
+    public:
+        JobHandle() = default;
+
+        [[nodiscard]] bool isValid() const { return job_ != nullptr; }                        ///< @brief 是否关联了任务
+        [[nodiscard]] bool isDone() const { return !job_ || job_->done_.load(std::memory_order_acquire); } ///< @brief 任务是否已完成
+    };
+
+    /**
+     * @brief 工作窃取(work-stealing)线程池。
+     *
+     * - 每个工作线程有自己的双端队列：自己从尾部取（后进先出，缓存友好），空闲线程从其他队列的头部窃取。
+     * - 非工作线程（如主线程）提交的任务进入全局注入队列。
+     * - 任务可以声明依赖（submit 的 dependencies 参数）或作为后续任务(then)，所有依赖完成后才会被调度。
+     * - wait() 在等待期间会帮忙执行其它任务，因此在任务内部等待子任务不会死锁；
+     *   主线程等待时还会执行主线程队列中的任务。
+     * - 主线程队列(runOnMainThread)用于必须在主线程调用的 SDL 接口（如创建纹理），
+     *   由 GameApp 每帧调用 processMainThreadQueue() 执行。
+     *
+     * 工作线程数为 0 时，所有任务都在 wait()/parallelFor() 的调用线程上执行，行为与单线程一致。
+     *
+     * 顺序键(OrderKey)：每个线程记录当前执行的工作在逻辑上的位置，与实际由哪个线程执行无关。
+     * 调用者用 OrderScope 为一段工作指定任务编号（如 SystemScheduler 为每个系统指定注册序号），
+     * parallelFor 为每个分块分配连续的子序号，之后调用线程的子序号越过所有分块。
+     * 按顺序键合并各线程产生的数据（如 EventStager），结果不受工作窃取的分配方式影响。
+     */
+    class JobSystem final
+    {
+    public:
+        /// @brief 顺序键：先比较任务编号，再比较子序号
+        struct OrderKey
+        {
+            std::uint32_t task_{0}; ///< @brief 任务编号（0 表示未指定）
+            std::uint32_t sub_{0};  ///< @brief 任务内的子序号（parallelFor 的分块）
+
+            [[nodiscard]] std::uint64_t value() const { return (static_cast<std::uint64_t>(task_) << 32) | sub_; }
+        };
+
+        /// @brief 在作用域内把当前线程的顺序键设为 {task, 0}，离开时恢复
+        class OrderScope
+        {
+            OrderKey previous_;
+
+        public:
+            explicit OrderScope(std::uint32_t task) : OrderScope(OrderKey{task, 0}) {}
+            explicit OrderScope(OrderKey key) : previous_(getCurrentOrderKey()) { setCurrentOrderKey(key); }
+            ~OrderScope() { setCurrentOrderKey(previous_); }
+
+            OrderScope(const OrderScope &) = delete;
+            OrderScope &operator=(const OrderScope &) = delete;
+        };
+
+        [[nodiscard]] static OrderKey getCurrentOrderKey(); ///< @brief 当前线程的顺序键
+        static void setCurrentOrderKey(OrderKey key);       ///< @brief 设置当前线程的顺序键
+
+    private:
+        using JobPtr = std::shared_ptr<detail::Job>;
+
+        /// @brief 每个工作线程的任务队列
+        struct WorkerQueue
+        {
+            std::mutex mutex_;
+            std::deque<JobPtr> jobs_;
+        };
+
+        std::vector<std::unique_ptr<WorkerQueue>> worker_queues_; ///< @brief 工作线程的本地队列（下标 = 工作线程编号）
+        std::vector<std::thread> workers_;                        ///< @brief 工作线程
+
+        std::mutex global_mutex_;             ///< @brief 保护全局注入队列
+        std::deque<JobPtr> global_jobs_;      ///< @brief 非工作线程提交的任务
+
+        std::mutex main_mutex_;               ///< @brief 保护主线程队列
+        std::vector<JobPtr> main_jobs_;       ///< @brief 只能在主线程执行的任务
+        std::thread::id main_thread_id_;      ///< @brief 主线程（创建 JobSystem 的线程）
+
+        std::mutex sleep_mutex_;              ///< @brief 工作线程休眠用
+        std::condition_variable wake_cv_;     ///< @brief 有新任务时唤醒工作线程
+        std::atomic<std::size_t> queued_{0};  ///< @brief 队列中（不含主线程队列）待执行的任务数
+        std::atomic<bool> stopping_{false};   ///< @brief 是否正在关闭
+
+    public:
+        /**
+         * @brief 构造函数，创建工作线程
+         * @param worker_count 工作线程数量，-1 表示自动（硬件线程数 - 1）
+         */
+        explicit JobSystem(int worker_count = -1);
+        ~JobSystem(); ///< @brief 等待已提交的任务执行完毕后关闭所有工作线程
+
+        JobSystem(const JobSystem &) = delete;
+        JobSystem &operator=(const JobSystem &) = delete;
+        JobSystem(JobSystem &&) = delete;
+        JobSystem &operator=(JobSystem &&) = delete;
+
+        [[nodiscard]] std::size_t getWorkerCount() const { return workers_.size(); }  ///< @brief 工作线程数量
+        [[nodiscard]] bool isMainThread() const { return std::this_thread::get_id() == main_thread_id_; } ///< @brief 当前是否为主线程
+
+        /**
+         * @brief 当前线程的槽位编号：工作线程 i 为 i + 1，其余线程（主线程）为 0。
+         *        用于按线程分配的无锁缓冲区（如 EventStager）。
+         */
+        [[nodiscard]] std::size_t getCurrentThreadSlot() const;
+        [[nodiscard]] std::size_t getThreadSlotCount() const { return workers_.size() + 1; } ///< @brief 槽位数量（工作线程数 + 1）
+
+        /**
+         * @brief 提交任务
+         * @param task 任务
+         * @param dependencies 依赖的任务，全部完成后才会执行此任务
+         * @return 任务句柄
+         */
+        JobHandle submit(std::function<void()> task, std::span<const JobHandle> dependencies = {});
+        JobHandle submit(std::function<void()> task, std::initializer_list<JobHandle> dependencies)
+        {
+            return submit(std::move(task), std::span<const JobHandle>(dependencies.begin(), dependencies.size()));
+        }
+
+        /**
+         * @brief 后续任务：在 parent 完成后执行 task
+         */
+        JobHandle then(const JobHandle &parent, std::function<void()> task) { return submit(std::move(task), {parent}); }
+
+        /**
+         * @brief 提交只能在主线程执行的任务（如 SDL 渲染相关调用）。可以从任意线程调用。
+         * @param task 任务
+         * @param dependencies 依赖的任务
+         * @return 任务句柄
+         */
+        JobHandle runOnMainThread(std::function<void()> task, std::span<const JobHandle> dependencies = {});
+
+        /**
+         * @brief 执行主线程队列中的所有任务（只能在主线程调用，GameApp 每帧调用一次）
+         * @return 执行的任务数量
+         */
+        std::size_t processMainThreadQueue();
+
+        void wait(const JobHandle &handle);               ///< @brief 等待任务完成（等待期间帮忙执行其它任务）
+        void waitAll(std::span<const JobHandle> handles); ///< @brief 等待一组任务全部完成
+
+        /**
+         * @brief 并行执行区间 [begin, end)，阻塞直到全部完成
+         *
+         * 第 i 个分块在顺序键 {task, sub + i} 下执行（{task, sub} 为调用线程的顺序键），
+         * 返回后调用线程的子序号为 sub + 分块数，因此之后产生的数据排在所有分块之后。
+         * @note 嵌套调用（在分块内再调用 parallelFor）时，内层分块的子序号会与外层后续的分块重叠。
+         * @param begin 起始下标
+         * @param end 结束下标（不包含）
+         * @param func 回调函数，签名为 void(std::size_t chunk_begin, std::size_t chunk_end)
+         * @param min_chunk_size 每个分块的最小元素数量，元素太少时直接在当前线程执行
+         */
+        template <typename Func>
+        void parallelFor(std::size_t begin, std::size_t end, Func &&func, std::size_t min_chunk_size = 64);
+
+        /**
+         * @brief 并行遍历 EnTT view，阻塞直到全部完成
+         *
+         * 回调函数的签名为 void(entt::entity, Components&...)，与 view.each() 相同（不包含空类型组件）。
+         * 回调中只允许读写组件，不允许创建/销毁实体或添加/移除组件。
+         * @param view EnTT view
+         * @param func 回调函数
+         * @param min_chunk_size 每个分块的最小实体数量
+         */
+        template <typename View, typename Func>
+        void parallelForEach(const View &view, Func &&func, std::size_t min_chunk_size = 64);
+
+    private:
+        void workerLoop(std::size_t worker_index);
+        void schedule(JobPtr job);         ///< @brief 依赖全部满足的任务进入队列
+        void execute(const JobPtr &job);   ///< @brief 执行任务并释放后续任务
+        [[nodiscard]] JobPtr tryPop(std::size_t worker_index); ///< @brief 取出一个任务（自己的队列 -> 全局队列 -> 窃取）
+        bool tryRunOne();                  ///< @brief 在当前线程执行一个任务，没有任务时返回 false
+        JobHandle submitJob(JobPtr job, std::span<const JobHandle> dependencies);
+    };
+
+    template <typename Func>
+    void JobSystem::parallelFor(std::size_t begin, std::size_t end, Func &&func, std::size_t min_chunk_size)
+    {
+        if (end <= begin)
+            return;
+        const std::size_t count = end - begin;
+        min_chunk_size = std::max<std::size_t>(min_chunk_size, 1);
+        // 每个线程约分到4块，便于负载均衡；元素太少时不拆分
+        const std::size_t max_chunks = (workers_.size() + 1) * 4;
+        const std::size_t chunk_count = std::min(max_chunks, (count + min_chunk_size - 1) / min_chunk_size);
+        if (workers_.empty() || chunk_count <= 1)
+        {
+            func(begin, end);
+            return;
+        }
+
+        const std::size_t chunk_size = (count + chunk_count - 1) / chunk_count;
+        const OrderKey key = getCurrentOrderKey();
+        std::vector<JobHandle> handles;
+        handles.reserve(chunk_count - 1);
+        // 第一块留给当前线程执行（沿用当前的顺序键），其余提交到队列
+        std::uint32_t chunk_index = 1;
+        for (std::size_t chunk_begin = begin + chunk_size; chunk_begin < end; chunk_begin += chunk_size, ++chunk_index)
+        {
+            const std::size_t chunk_end = std::min(chunk_begin + chunk_size, end);
+            const OrderKey chunk_key{key.task_, key.sub_ + chunk_index};
+            handles.push_back(submit([&func, chunk_begin, chunk_end, chunk_key]()
+                                     {
+                                         const OrderScope scope(chunk_key);
+                                         func(chunk_begin, chunk_end); }));
+        }
+        func(begin, std::min(begin + chunk_size, end));
+        waitAll(handles);
+        setCurrentOrderKey(OrderKey{key.task_, key.sub_ + chunk_index});
+    }
+
+    template <typename View, typename Func>
+    void JobSystem::parallelForEach(const View &view, Func &&func, std::size_t min_chunk_size)
+    {
+        // 先收集实体，再按下标并行（多组件 view 无法随机访问）
+        std::vector<entt::entity> entities(view.begin(), view.end());
+        parallelFor(0, entities.size(), [&](std::size_t chunk_begin, std::size_t chunk_end)
+                    {
+            for (std::size_t i = chunk_begin; i < chunk_end; ++i)
+            {
+                const auto entity = entities[i];
+                std::apply([&](auto &...components)
+                           { func(entity, components...); }, view.get(entity));
+            } }, min_chunk_size);
+    }
+
+} // namespace engine::core
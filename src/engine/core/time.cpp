@@ -1,5 +1,7 @@
 #include "time.h"
+#include "../debug/profiler.h"
 #include <spdlog/spdlog.h>
+#include <algorithm>
 #include <SDL3/SDL_timer.h>    // 用于 SDL_GetTicksNS()
 
 namespace engine::core {
@@ -25,6 +27,7 @@ void Time::update() {
 }
 
 void Time::limitFrameRate(float current_delta_time) {
+    ENGINE_PROFILE_SCOPE("Time::limitFrameRate");
     // 如果当前帧耗费的时间小于目标帧时间，则等待剩余时间
     if (current_delta_time < target_frame_time_) {
         double time_to_wait = target_frame_time_ - current_delta_time;
@@ -75,4 +78,24 @@ int Time::getTargetFps() const {
     return target_fps_;
 }
 
+void Time::setFixedTickRate(int tick_rate) {
+    if (tick_rate < 0) {
+        spdlog::warn("Fixed tick rate 不能为负。Setting to 0 (variable timestep).");
+        tick_rate = 0;
+    }
+    fixed_tick_rate_ = tick_rate;
+    if (fixed_tick_rate_ > 0) {
+        fixed_delta_time_ = 1.0 / static_cast<double>(fixed_tick_rate_);
+        spdlog::info("Fixed tick rate 设置为: {} (Tick time: {:.6f}s)", fixed_tick_rate_, fixed_delta_time_);
+    } else {
+        fixed_delta_time_ = 0.0;
+        interpolation_alpha_ = 1.0f;
+        spdlog::info("Fixed tick rate 设置为: Variable timestep");
+    }
+}
+
+void Time::setInterpolationAlpha(float alpha) {
+    interpolation_alpha_ = std::clamp(alpha, 0.0f, 1.0f);
+}
+
 } // namespace engine::core 
\ No newline at end of file
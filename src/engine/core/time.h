@@ -20,6 +20,11 @@ private:
     int target_fps_ = 0;             ///< @brief 目标 FPS (0 表示不限制)
     double target_frame_time_ = 0.0; ///< @brief 目标每帧时间 (秒)
 
+    // 固定步长模拟相关
+    int fixed_tick_rate_ = 0;           ///< @brief 固定步长模拟的频率 (0 表示使用可变步长)
+    double fixed_delta_time_ = 0.0;     ///< @brief 每个模拟tick的时长 (秒)
+    float interpolation_alpha_ = 1.0f;  ///< @brief 渲染插值系数：累积器中剩余时间 / 固定步长，范围[0, 1)
+
 public:
     Time();
 
@@ -77,6 +82,25 @@ public:
      */
     int getTargetFps() const;
 
+    /**
+     * @brief 设置固定步长模拟的频率。
+     *
+     * @param tick_rate 每秒模拟tick数。设置为 0 表示使用可变步长。负值将被视为 0。
+     */
+    void setFixedTickRate(int tick_rate);
+
+    int getFixedTickRate() const { return fixed_tick_rate_; }                           ///< @brief 获取固定步长模拟的频率，0 表示可变步长
+    float getFixedDeltaTime() const { return static_cast<float>(fixed_delta_time_); }   ///< @brief 获取每个模拟tick的时长 (秒)，可变步长时为0
+    bool isFixedTimestep() const { return fixed_tick_rate_ > 0; }                       ///< @brief 是否使用固定步长模拟
+
+    /**
+     * @brief 设置渲染插值系数（由主循环在模拟结束后设置）。
+     *
+     * @param alpha 上一次与当前模拟状态之间的插值系数，会被限制在[0, 1]范围内
+     */
+    void setInterpolationAlpha(float alpha);
+    float getInterpolationAlpha() const { return interpolation_alpha_; }               ///< @brief 获取渲染插值系数
+
 private:
     /**
      * @brief update 中调用，用于限制帧率。如果设置了 target_fps_ > 0，且当前帧执行时间小于目标帧时间，则会调用 SDL_DelayNS() 来等待剩余时间。
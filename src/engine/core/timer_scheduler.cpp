@@ -0,0 +1,69 @@
+#include "timer_scheduler.h"
+#include <limits>
+
+namespace engine::core
+{
+
+    TimerHandle TimerScheduler::scheduleAt(double time, entt::entity entity, entt::id_type kind)
+    {
+        std::uint32_t slot;
+        if (!free_slots_.empty())
+        {
+            slot = free_slots_.back();
+            free_slots_.pop_back();
+        }
+        else
+        {
+            slot = static_cast<std::uint32_t>(generations_.size());
+            generations_.push_back(1);
+        }
+        const auto generation = generations_[slot];
+
+        heap_.push_back(Entry{Timer{time, entity, kind}, next_sequence_++, slot, generation});
+        std::push_heap(heap_.begin(), heap_.end(), Later{});
+        ++active_count_;
+        return TimerHandle{slot, generation};
+    }
+
+    bool TimerScheduler::cancel(TimerHandle handle)
+    {
+        // 堆中的条目留到弹出时再跳过
+        return handle.isValid() && release(handle.slot_, handle.generation_);
+    }
+
+    bool TimerScheduler::isPending(TimerHandle handle) const
+    {
+        return handle.isValid() && handle.slot_ < generations_.size() && generations_[handle.slot_] == handle.generation_;
+    }
+
+    void TimerScheduler::clear()
+    {
+        heap_.clear();
+        free_slots_.clear();
+        for (std::uint32_t slot = 0; slot < generations_.size(); ++slot)
+        {
+            if (++generations_[slot] == 0)
+                generations_[slot] = 1;
+            free_slots_.push_back(slot);
+        }
+        active_count_ = 0;
+    }
+
+    double TimerScheduler::getNextTime() const
+    {
+        return heap_.empty() ? std::numeric_limits<double>::infinity() : heap_.front().timer_.time_;
+    }
+
+    bool TimerScheduler::release(std::uint32_t slot, std::uint32_t generation)
+    {
+        if (slot >= generations_.size() || generations_[slot] != generation)
+            return false;
+        // 代数递增使旧句柄与堆中的旧条目失效（跳过 0，0 表示空句柄）
+        if (++generations_[slot] == 0)
+            generations_[slot] = 1;
+        free_slots_.push_back(slot);
+        --active_count_;
+        return true;
+    }
+
+} // namespace engine::core
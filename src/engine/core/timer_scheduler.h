@@ -0,0 +1,130 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <entt/entity/entity.hpp>
+#include <entt/core/fwd.hpp>
+
+namespace engine::core
+{
+
+    /**
+     * @brief 定时器句柄，用于取消尚未触发的定时器。
+     *        默认构造的句柄是“空”的；定时器触发或被取消后，句柄自动失效。
+     */
+    struct TimerHandle
+    {
+        std::uint32_t slot_{0};       ///< @brief 槽位编号
+        std::uint32_t generation_{0}; ///< @brief 槽位代数（0 表示空句柄）
+
+        [[nodiscard]] bool isValid() const { return generation_ != 0; }
+    };
+
+    /**
+     * @brief 基于最小堆的定时器调度器，按绝对模拟时间排序。
+     *
+     * 每个定时器携带一个实体与一个种类ID（如 "attack_ready"_hs、技能、增益、波次……），
+     * advance() 推进模拟时间，只弹出已经到期的定时器，因此每帧的开销与到期数量成正比，而不是与定时器总数成正比。
+     * 到期时间相同的定时器按登记顺序触发，结果是确定的。
+     *
+     * - 取消采用惰性删除：cancel() 只让句柄失效，堆中的旧条目在弹出时跳过，操作均为 O(1) / O(log n)；
+     * - 回调中可以登记新的定时器，到期时间不晚于当前时间的会在同一次 advance() 中触发；
+     * - 调度器不检查实体是否有效，由回调自行判断。
+     *
+     * 非线程安全：登记、取消与推进需要在同一线程（或互不重叠的系统）中进行。
+     */
+    class TimerScheduler final
+    {
+    public:
+        /// @brief 到期的定时器
+        struct Timer
+        {
+            double time_{0.0};                 ///< @brief 到期时间（模拟时间，秒）
+            entt::entity entity_{entt::null};  ///< @brief 关联的实体
+            entt::id_type kind_{0};            ///< @brief 定时器种类
+        };
+
+    private:
+        struct Entry
+        {
+            Timer timer_;
+            std::uint64_t sequence_{0};   ///< @brief 登记顺序，用于到期时间相同时的排序
+            std::uint32_t slot_{0};
+            std::uint32_t generation_{0};
+        };
+
+        /// @brief 堆比较：到期时间早（相同时登记早）的条目在堆顶
+        struct Later
+        {
+            bool operator()(const Entry &a, const Entry &b) const
+            {
+                return a.timer_.time_ != b.timer_.time_ ? a.timer_.time_ > b.timer_.time_ : a.sequence_ > b.sequence_;
+            }
+        };
+
+        std::vector<Entry> heap_;                  ///< @brief 最小堆（可能包含已取消的条目）
+        std::vector<std::uint32_t> generations_;   ///< @brief 每个槽位当前的代数，与条目中的代数不一致即为已取消
+        std::vector<std::uint32_t> free_slots_;    ///< @brief 可复用的槽位
+        double now_{0.0};                          ///< @brief 当前模拟时间（秒）
+        std::uint64_t next_sequence_{0};
+        std::size_t active_count_{0};              ///< @brief 尚未触发、未取消的定时器数量
+
+    public:
+        TimerScheduler() = default;
+
+        /**
+         * @brief 登记一个在绝对时间 time 到期的定时器
+         * @return 可用于取消的句柄
+         */
+        TimerHandle scheduleAt(double time, entt::entity entity, entt::id_type kind);
+
+        /// @brief 登记一个在 delay 秒后到期的定时器
+        TimerHandle scheduleAfter(double delay, entt::entity entity, entt::id_type kind) { return scheduleAt(now_ + delay, entity, kind); }
+
+        /**
+         * @brief 取消尚未触发的定时器
+         * @return 定时器是否处于等待中（已触发/已取消/空句柄返回 false）
+         */
+        bool cancel(TimerHandle handle);
+
+        /// @brief 定时器是否仍在等待中
+        [[nodiscard]] bool isPending(TimerHandle handle) const;
+
+        /**
+         * @brief 推进模拟时间，按到期顺序触发所有到期的定时器
+         * @param delta_time 推进的时长（秒）
+         * @param on_expired 回调 void(const TimerScheduler::Timer&)
+         * @return 触发的定时器数量
+         */
+        template <typename Func>
+        std::size_t advance(double delta_time, Func &&on_expired)
+        {
+            now_ += delta_time;
+            std::size_t fired = 0;
+            while (!heap_.empty() && heap_.front().timer_.time_ <= now_)
+            {
+                std::pop_heap(heap_.begin(), heap_.end(), Later{});
+                const Entry entry = heap_.back();
+                heap_.pop_back();
+                if (!release(entry.slot_, entry.generation_))
+                    continue; // 已取消
+                ++fired;
+                on_expired(entry.timer_);
+            }
+            return fired;
+        }
+
+        /// @brief 清除所有定时器（时间不变，已发出的句柄全部失效）
+        void clear();
+
+        [[nodiscard]] double getTime() const { return now_; }                   ///< @brief 当前模拟时间（秒）
+        [[nodiscard]] std::size_t getPendingCount() const { return active_count_; } ///< @brief 等待中的定时器数量
+        [[nodiscard]] double getNextTime() const;                                ///< @brief 最早的到期时间下界（堆顶可能是已取消的条目；没有定时器时返回无穷大）
+
+    private:
+        /// @brief 释放槽位；槽位代数与条目不一致（已取消）时返回 false
+        bool release(std::uint32_t slot, std::uint32_t generation);
+    };
+
+} // namespace engine::core
@@ -0,0 +1,217 @@
+#include "trace_recorder.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+
+namespace engine::core
+{
+
+    namespace
+    {
+        /// @brief 写出JSON字符串（转义引号、反斜杠和控制字符）
+        void writeJsonString(std::ofstream &out, std::string_view text)
+        {
+            out << '"';
+            for (const char c : text)
+            {
+                switch (c)
+                {
+                case '"':
+                    out << "\\\"";
+                    break;
+                case '\\':
+                    out << "\\\\";
+                    break;
+                case '\n':
+                    out << "\\n";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                        out << ' ';
+                    else
+                        out << c;
+                }
+            }
+            out << '"';
+        }
+    }
+
+    TraceRecorder::TraceRecorder(std::string output_dir, std::size_t max_events)
+        : output_dir_(std::move(output_dir)), max_events_(std::max<std::size_t>(max_events, 1))
+    {
+        spdlog::trace("TraceRecorder 构造完成，输出目录: '{}', 最大事件数: {}", output_dir_, max_events_);
+    }
+
+    TraceRecorder::~TraceRecorder()
+    {
+        if (isRecording())
+        {
+            stop();
+        }
+        TraceRecorder *self = this;
+        if (current_.compare_exchange_strong(self, nullptr))
+        {
+            active_.store(false);
+        }
+    }
+
+    void TraceRecorder::setCurrent(TraceRecorder *recorder)
+    {
+        current_.store(recorder, std::memory_order_release);
+        active_.store(recorder != nullptr && recorder->isRecording());
+    }
+
+    void TraceRecorder::start()
+    {
+        if (isRecording())
+            return;
+        {
+            std::lock_guard lock(mutex_);
+            event_count_ = 0; // 保留已分配的块，不在每次开始时预先分配整个缓冲区
+            overflowed_.store(false, std::memory_order_relaxed);
+            origin_ = Clock::now();
+            recording_.store(true, std::memory_order_release);
+        }
+        if (current() == this)
+            active_.store(true);
+        spdlog::info("开始记录 trace（最多 {} 个事件）。", max_events_);
+    }
+
+    std::string TraceRecorder::stop()
+    {
+        if (!recording_.exchange(false, std::memory_order_acq_rel))
+            return {};
+        if (current() == this)
+            active_.store(false);
+
+        // 文件名使用本地时间，便于区分多次记录
+        const auto now = std::time(nullptr);
+        std::tm local_time{};
+#ifdef _WIN32
+        localtime_s(&local_time, &now);
+#else
+        localtime_r(&now, &local_time);
+#endif
+        char file_name[64];
+        std::strftime(file_name, sizeof(file_name), "trace_%Y%m%d_%H%M%S.json", &local_time);
+
+        std::error_code ec;
+        std::filesystem::create_directories(output_dir_, ec);
+        const auto file_path = (std::filesystem::path(output_dir_) / file_name).string();
+
+        std::lock_guard lock(mutex_);
+        if (!writeFile(file_path))
+        {
+            spdlog::error("写入 trace 文件失败: '{}'", file_path);
+            return {};
+        }
+        spdlog::info("trace 已写入 '{}'，共 {} 个事件{}。", file_path, event_count_,
+                     overflowed_.load(std::memory_order_relaxed) ? "（缓冲区已满，后续事件被丢弃）" : "");
+        event_count_ = 0;
+        return file_path;
+    }
+
+    void TraceRecorder::toggle()
+    {
+        if (isRecording())
+            stop();
+        else
+            start();
+    }
+
+    void TraceRecorder::endFrame()
+    {
+        if (isRecording() && overflowed_.load(std::memory_order_relaxed))
+        {
+            spdlog::warn("trace 缓冲区已满，自动停止记录。");
+            stop();
+        }
+    }
+
+    void TraceRecorder::record(const char *name, Clock::time_point start, Clock::time_point end, std::string_view detail)
+    {
+        if (!isRecording())
+            return;
+        const auto thread_id = currentThreadId();
+        std::lock_guard lock(mutex_);
+        if (!isRecording()) // 加锁期间可能已经停止
+            return;
+        if (event_count_ >= max_events_)
+        {
+            overflowed_.store(true, std::memory_order_relaxed);
+            return;
+        }
+        if (event_count_ == blocks_.size() * BLOCK_SIZE)
+        {
+            blocks_.push_back(std::make_unique<Event[]>(BLOCK_SIZE)); // 只分配新块，已有的事件不会移动
+        }
+        auto &event = blocks_[event_count_ / BLOCK_SIZE][event_count_ % BLOCK_SIZE];
+        event.name_ = name;
+        event.start_us_ = std::chrono::duration_cast<std::chrono::microseconds>(start - origin_).count();
+        event.duration_us_ = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+        event.thread_id_ = thread_id;
+        event.detail_.assign(detail); // 复用字符串的容量
+        ++event_count_;
+    }
+
+    bool TraceRecorder::writeFile(const std::string &file_path) const
+    {
+        std::ofstream out(file_path, std::ios::binary | std::ios::trunc);
+        if (!out)
+            return false;
+
+        // 按开始时间排序：嵌套的区域是在内层先结束、先被记录的
+        std::vector<const Event *> sorted;
+        sorted.reserve(event_count_);
+        std::uint32_t max_thread_id = 0;
+        for (std::size_t i = 0; i < event_count_; ++i)
+        {
+            const auto &event = eventAt(i);
+            sorted.push_back(&event);
+            max_thread_id = std::max(max_thread_id, event.thread_id_);
+        }
+        std::stable_sort(sorted.begin(), sorted.end(), [](const Event *a, const Event *b)
+                         { return a->start_us_ < b->start_us_; });
+
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        // 元数据：进程名与线程名
+        out << R"({"name":"process_name","ph":"M","pid":1,"tid":0,"args":{"name":"MonsterWar"}})";
+        for (std::uint32_t tid = 0; tid <= max_thread_id; ++tid)
+        {
+            out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << tid
+                << ",\"args\":{\"name\":\"";
+            if (tid == 0)
+                out << "Main";
+            else
+                out << "Thread " << tid;
+            out << "\"}}";
+        }
+        for (const auto *event : sorted)
+        {
+            out << ",\n{\"name\":";
+            writeJsonString(out, event->name_);
+            out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << event->thread_id_
+                << ",\"ts\":" << event->start_us_ << ",\"dur\":" << event->duration_us_;
+            if (!event->detail_.empty())
+            {
+                out << ",\"args\":{\"detail\":";
+                writeJsonString(out, event->detail_);
+                out << '}';
+            }
+            out << '}';
+        }
+        out << "\n]}\n";
+        return static_cast<bool>(out);
+    }
+
+    std::uint32_t TraceRecorder::currentThreadId()
+    {
+        // 第一个调用的线程（主线程）编号为0
+        static std::atomic<std::uint32_t> next_id{0};
+        thread_local const std::uint32_t id = next_id.fetch_add(1);
+        return id;
+    }
+
+} // namespace engine::core
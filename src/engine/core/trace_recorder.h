@@ -0,0 +1,93 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace engine::core
+{
+
+    /**
+     * @brief Trace 记录器：把计时区域记录为 Chrome/Perfetto 的 trace-event JSON（"X" 完整事件）。
+     *
+     * 记录期间事件只追加到内存缓冲区，stop() 时才一次性写入文件，避免文件 IO 干扰帧时间。
+     * 缓冲区由固定大小的块组成，按需分配新块而不移动已有的事件（加锁期间不会出现大块内存的搬移），
+     * 停止记录后保留已分配的块，供下一次记录复用。
+     * 事件来源是 ENGINE_PROFILE_SCOPE 宏（见 engine/debug/profiler.h），与帧分析器共用同一套计时区域。
+     * 生成的文件可以在 chrome://tracing 或 https://ui.perfetto.dev 中打开。
+     */
+    class TraceRecorder final
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+    private:
+        /// @brief 一条完整事件(ph = "X")
+        struct Event
+        {
+            const char *name_;          ///< @brief 事件名称（静态字符串）
+            std::int64_t start_us_;     ///< @brief 开始时间，相对记录开始的微秒数
+            std::int64_t duration_us_;  ///< @brief 持续时间（微秒）
+            std::uint32_t thread_id_;   ///< @brief 线程编号
+            std::string detail_;        ///< @brief 附加信息（如资源路径），可为空
+        };
+
+        inline static std::atomic<TraceRecorder *> current_{nullptr}; ///< @brief 当前使用的记录器（由 GameApp 设置）
+        inline static std::atomic<bool> active_{false};               ///< @brief 当前记录器是否正在记录（热路径只读这个标志）
+
+        std::string output_dir_;      ///< @brief 输出目录
+        std::size_t max_events_;      ///< @brief 缓冲区最多容纳的事件数
+        static constexpr std::size_t BLOCK_SIZE = 4096; ///< @brief 每块容纳的事件数
+
+        std::vector<std::unique_ptr<Event[]>> blocks_; ///< @brief 事件缓冲区（固定大小的块，停止记录后保留）
+        std::size_t event_count_{0};  ///< @brief 本次记录的事件数
+        std::mutex mutex_;            ///< @brief 保护事件缓冲区（允许其他线程记录）
+        Clock::time_point origin_{};  ///< @brief 记录开始的时间
+        std::atomic<bool> recording_{false};  ///< @brief 是否正在记录（工作线程在 record() 中读取）
+        std::atomic<bool> overflowed_{false}; ///< @brief 缓冲区是否已满（之后的事件被丢弃）
+
+    public:
+        /**
+         * @brief 构造函数
+         * @param output_dir trace 文件的输出目录（不存在时自动创建）
+         * @param max_events 最多缓存的事件数，达到后丢弃后续事件，并在下一次 endFrame() 时自动停止
+         */
+        TraceRecorder(std::string output_dir, std::size_t max_events);
+        ~TraceRecorder();
+
+        TraceRecorder(const TraceRecorder &) = delete;
+        TraceRecorder &operator=(const TraceRecorder &) = delete;
+        TraceRecorder(TraceRecorder &&) = delete;
+        TraceRecorder &operator=(TraceRecorder &&) = delete;
+
+        static TraceRecorder *current() { return current_.load(std::memory_order_acquire); } ///< @brief 获取当前记录器（可能为空）
+        static void setCurrent(TraceRecorder *recorder);                                      ///< @brief 设置当前记录器
+        static bool isActive() { return active_.load(std::memory_order_relaxed); }           ///< @brief 当前记录器是否正在记录
+
+        void start();                       ///< @brief 开始记录（清空之前的缓冲区）
+        std::string stop();                 ///< @brief 停止记录并写出文件，返回文件路径（失败或未在记录时返回空字符串）
+        void toggle();                      ///< @brief 开始/停止记录
+        bool isRecording() const { return recording_.load(std::memory_order_acquire); }
+        void endFrame();                    ///< @brief 每帧结束时调用：缓冲区已满时自动停止并写出
+
+        /**
+         * @brief 记录一条完整事件（线程安全）
+         * @param name 事件名称，必须是静态生命周期的字符串
+         * @param start 开始时间
+         * @param end 结束时间
+         * @param detail 附加信息，写入事件的 args（可为空）
+         */
+        void record(const char *name, Clock::time_point start, Clock::time_point end, std::string_view detail = {});
+
+    private:
+        const Event &eventAt(std::size_t index) const { return blocks_[index / BLOCK_SIZE][index % BLOCK_SIZE]; }
+        [[nodiscard]] bool writeFile(const std::string &file_path) const;
+        static std::uint32_t currentThreadId(); ///< @brief 为每个线程分配一个从0开始的小编号
+    };
+
+} // namespace engine::core
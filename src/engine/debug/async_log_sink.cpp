@@ -0,0 +1,168 @@
+#include "async_log_sink.h"
+#include <spdlog/details/log_msg.h>
+#include <spdlog/formatter.h>
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstring>
+
+namespace engine::debug
+{
+
+    AsyncLogSink::AsyncLogSink(std::vector<spdlog::sink_ptr> targets, std::size_t capacity)
+        : targets_(std::move(targets)),
+          capacity_(std::bit_ceil(std::max<std::size_t>(capacity, 2))),
+          mask_(capacity_ - 1)
+    {
+        slots_ = std::make_unique<Slot[]>(capacity_);
+        for (std::size_t i = 0; i < capacity_; ++i)
+        {
+            slots_[i].sequence_.store(i, std::memory_order_relaxed);
+        }
+        worker_ = std::thread(&AsyncLogSink::workerLoop, this);
+    }
+
+    AsyncLogSink::~AsyncLogSink()
+    {
+        stop_.store(true, std::memory_order_release);
+        if (worker_.joinable())
+        {
+            worker_.join();
+        }
+        flush();
+    }
+
+    void AsyncLogSink::log(const spdlog::details::log_msg &msg)
+    {
+        std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        Slot *slot;
+        for (;;)
+        {
+            slot = &slots_[pos & mask_];
+            const std::size_t sequence = slot->sequence_.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0)
+            {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // 消费者还没有读走这个槽位上一轮的消息：缓冲区已满
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            else
+            {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        auto &record = slot->record_;
+        record.time_ = msg.time;
+        record.level_ = msg.level;
+        record.thread_id_ = msg.thread_id;
+        record.name_size_ = static_cast<std::uint16_t>(std::min(msg.logger_name.size(), MAX_LOGGER_NAME_SIZE));
+        std::memcpy(record.name_, msg.logger_name.data(), record.name_size_);
+        record.text_size_ = static_cast<std::uint16_t>(std::min(msg.payload.size(), MAX_MESSAGE_SIZE));
+        std::memcpy(record.text_, msg.payload.data(), record.text_size_);
+        slot->sequence_.store(pos + 1, std::memory_order_release);
+    }
+
+    void AsyncLogSink::flush()
+    {
+        drain();
+        for (auto &target : targets_)
+        {
+            target->flush();
+        }
+    }
+
+    void AsyncLogSink::set_pattern(const std::string &pattern)
+    {
+        for (auto &target : targets_)
+        {
+            target->set_pattern(pattern);
+        }
+    }
+
+    void AsyncLogSink::set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter)
+    {
+        for (auto &target : targets_)
+        {
+            target->set_formatter(sink_formatter->clone());
+        }
+    }
+
+    bool AsyncLogSink::tryPop(Record &record)
+    {
+        std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        Slot *slot;
+        for (;;)
+        {
+            slot = &slots_[pos & mask_];
+            const std::size_t sequence = slot->sequence_.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0)
+            {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false; // 缓冲区为空（或生产者还没有写完）
+            }
+            else
+            {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        // 先复制出来再释放槽位，输出（可能很慢）期间生产者可以继续使用这个槽位
+        record = slot->record_;
+        slot->sequence_.store(pos + capacity_, std::memory_order_release);
+        return true;
+    }
+
+    std::size_t AsyncLogSink::drain()
+    {
+        Record record;
+        std::size_t count = 0;
+        while (tryPop(record))
+        {
+            write(record);
+            ++count;
+        }
+        return count;
+    }
+
+    void AsyncLogSink::write(const Record &record)
+    {
+        spdlog::details::log_msg msg(record.time_, spdlog::source_loc{},
+                                     spdlog::string_view_t(record.name_, record.name_size_), record.level_,
+                                     spdlog::string_view_t(record.text_, record.text_size_));
+        msg.thread_id = record.thread_id_;
+        for (auto &target : targets_)
+        {
+            if (target->should_log(msg.level))
+            {
+                target->log(msg);
+            }
+        }
+    }
+
+    void AsyncLogSink::workerLoop()
+    {
+        while (!stop_.load(std::memory_order_acquire))
+        {
+            if (drain() == 0)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+
+} // namespace engine::debug
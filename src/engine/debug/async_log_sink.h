@@ -0,0 +1,94 @@
+#pragma once
+#include <spdlog/sinks/sink.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace engine::debug
+{
+
+    /**
+     * @brief 异步日志 sink：记录日志的线程只把消息复制进无锁环形缓冲区，格式化与输出由后台线程完成。
+     *
+     * - 缓冲区为固定容量（向上取整为 2 的幂）的多生产者多消费者队列（按槽位序号同步，不加锁、不分配内存），
+     *   主线程和工作线程都可以直接记录日志；
+     * - 缓冲区满时新消息被丢弃并计数（getDroppedCount），记录日志的线程永远不会等待输出；
+     * - 消息正文超过 MAX_MESSAGE_SIZE 字节时被截断；
+     * - flush() 在调用线程中输出缓冲区中剩余的消息并刷新目标 sink（与后台线程并发时两边输出的顺序可能交错），
+     *   析构时停止后台线程并输出剩余的消息。
+     *
+     * 目标 sink 会被后台线程和 flush() 的调用线程同时使用，需要是线程安全的（*_mt）。
+     */
+    class AsyncLogSink final : public spdlog::sinks::sink
+    {
+    public:
+        static constexpr std::size_t MAX_MESSAGE_SIZE{256};    ///< @brief 消息正文的最大长度（字节）
+        static constexpr std::size_t MAX_LOGGER_NAME_SIZE{32}; ///< @brief 日志器名称的最大长度（字节）
+
+    private:
+        /// @brief 一条日志消息（定长，复制进缓冲区时不分配内存）
+        struct Record
+        {
+            spdlog::log_clock::time_point time_;
+            spdlog::level::level_enum level_{spdlog::level::info};
+            std::size_t thread_id_{0};
+            std::uint16_t name_size_{0};
+            std::uint16_t text_size_{0};
+            char name_[MAX_LOGGER_NAME_SIZE];
+            char text_[MAX_MESSAGE_SIZE];
+        };
+
+        /// @brief 缓冲区槽位：sequence_ 等于写入位置时可写，等于写入位置 + 1 时可读
+        struct Slot
+        {
+            std::atomic<std::size_t> sequence_{0};
+            Record record_;
+        };
+
+        std::vector<spdlog::sink_ptr> targets_; ///< @brief 实际输出的 sink
+        std::unique_ptr<Slot[]> slots_;
+        std::size_t capacity_;
+        std::size_t mask_;
+
+        alignas(64) std::atomic<std::size_t> enqueue_pos_{0}; ///< @brief 下一个写入位置（生产者竞争）
+        alignas(64) std::atomic<std::size_t> dequeue_pos_{0}; ///< @brief 下一个读取位置（消费者竞争）
+        alignas(64) std::atomic<std::uint64_t> dropped_{0};   ///< @brief 因缓冲区已满被丢弃的消息数
+
+        std::atomic<bool> stop_{false};
+        std::thread worker_; ///< @brief 后台输出线程
+
+    public:
+        /**
+         * @brief 构造函数（创建后台输出线程）
+         * @param targets 实际输出的 sink（线程安全）
+         * @param capacity 缓冲区可容纳的消息数（向上取整为 2 的幂）
+         */
+        AsyncLogSink(std::vector<spdlog::sink_ptr> targets, std::size_t capacity);
+        ~AsyncLogSink() override;
+
+        AsyncLogSink(const AsyncLogSink &) = delete;
+        AsyncLogSink &operator=(const AsyncLogSink &) = delete;
+        AsyncLogSink(AsyncLogSink &&) = delete;
+        AsyncLogSink &operator=(AsyncLogSink &&) = delete;
+
+        void log(const spdlog::details::log_msg &msg) override; ///< @brief 把消息复制进缓冲区（缓冲区满时丢弃）
+        void flush() override;                                  ///< @brief 输出缓冲区中剩余的消息并刷新目标 sink
+        void set_pattern(const std::string &pattern) override;
+        void set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) override;
+
+        [[nodiscard]] std::uint64_t getDroppedCount() const { return dropped_.load(std::memory_order_relaxed); } ///< @brief 累计丢弃的消息数
+        [[nodiscard]] std::size_t getCapacity() const { return capacity_; }                                       ///< @brief 缓冲区容量
+        [[nodiscard]] const std::vector<spdlog::sink_ptr> &getTargets() const { return targets_; }               ///< @brief 实际输出的 sink
+
+    private:
+        bool tryPop(Record &record); ///< @brief 取出一条消息，缓冲区为空时返回 false
+        std::size_t drain();         ///< @brief 输出缓冲区中的所有消息，返回输出的数量
+        void write(const Record &record);
+        void workerLoop();
+    };
+
+} // namespace engine::debug
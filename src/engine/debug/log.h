@@ -0,0 +1,52 @@
+#pragma once
+#include <spdlog/spdlog.h>
+
+/**
+ * @file log.h
+ * @brief 热路径日志宏：级别低于编译期最低级别的调用在预处理阶段被替换为空语句，参数不会被求值。
+ *
+ * 每个tick、每个事件都会执行的代码（系统的 update、事件回调）使用这些宏代替 spdlog::trace/debug/info，
+ * 发布版本中这些调用完全不存在（没有格式化、没有级别判断），调试版本中仍受 spdlog 运行时级别控制。
+ * 初始化、加载、关闭等只执行一次的代码直接使用 spdlog 即可。
+ *
+ * 编译期最低级别由 ENGINE_LOG_ACTIVE_LEVEL 决定（取值与 SPDLOG_LEVEL_* 相同），可通过编译选项覆盖，
+ * 默认：定义了 NDEBUG（发布版本）时为 warn，否则为 trace。
+ */
+
+#ifndef ENGINE_LOG_ACTIVE_LEVEL
+#ifdef NDEBUG
+#define ENGINE_LOG_ACTIVE_LEVEL SPDLOG_LEVEL_WARN
+#else
+#define ENGINE_LOG_ACTIVE_LEVEL SPDLOG_LEVEL_TRACE
+#endif
+#endif
+
+#if ENGINE_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_TRACE
+#define ENGINE_LOG_TRACE(...) spdlog::trace(__VA_ARGS__)
+#else
+#define ENGINE_LOG_TRACE(...) (void)0
+#endif
+
+#if ENGINE_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_DEBUG
+#define ENGINE_LOG_DEBUG(...) spdlog::debug(__VA_ARGS__)
+#else
+#define ENGINE_LOG_DEBUG(...) (void)0
+#endif
+
+#if ENGINE_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_INFO
+#define ENGINE_LOG_INFO(...) spdlog::info(__VA_ARGS__)
+#else
+#define ENGINE_LOG_INFO(...) (void)0
+#endif
+
+#if ENGINE_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_WARN
+#define ENGINE_LOG_WARN(...) spdlog::warn(__VA_ARGS__)
+#else
+#define ENGINE_LOG_WARN(...) (void)0
+#endif
+
+#if ENGINE_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_ERROR
+#define ENGINE_LOG_ERROR(...) spdlog::error(__VA_ARGS__)
+#else
+#define ENGINE_LOG_ERROR(...) (void)0
+#endif
@@ -0,0 +1,162 @@
+#include "profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <mutex>
+#include <spdlog/spdlog.h>
+
+namespace engine::debug
+{
+
+    namespace
+    {
+        /// @brief 全局的区域名称表（区域编号 = 下标）
+        std::vector<const char *> &zoneNames()
+        {
+            static std::vector<const char *> names;
+            return names;
+        }
+
+        std::mutex &zoneNamesMutex()
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+    }
+
+    Profiler::~Profiler()
+    {
+        if (current_ == this)
+        {
+            current_ = nullptr;
+        }
+    }
+
+    std::size_t Profiler::zoneId(const char *name)
+    {
+        std::lock_guard lock(zoneNamesMutex());
+        auto &names = zoneNames();
+        for (std::size_t i = 0; i < names.size(); ++i)
+        {
+            if (names[i] == name || std::strcmp(names[i], name) == 0)
+                return i;
+        }
+        names.push_back(name);
+        spdlog::trace("Profiler: 注册计时区域 '{}' (id: {})", name, names.size() - 1);
+        return names.size() - 1;
+    }
+
+    const char *Profiler::zoneName(std::size_t id)
+    {
+        std::lock_guard lock(zoneNamesMutex());
+        const auto &names = zoneNames();
+        return id < names.size() ? names[id] : "?";
+    }
+
+    void Profiler::beginFrame()
+    {
+        frame_start_ = Clock::now();
+        for (auto &counter : counters_)
+        {
+            if (counter.per_frame_)
+                counter.value_ = 0;
+        }
+    }
+
+    void Profiler::endFrame()
+    {
+        const std::chrono::duration<double, std::milli> frame_time = Clock::now() - frame_start_;
+        frame_history_[head_] = static_cast<float>(frame_time.count());
+        std::lock_guard lock(zones_mutex_);
+        for (auto &zone : zones_)
+        {
+            zone.history_[head_] = static_cast<float>(zone.current_ms_);
+            zone.last_calls_ = zone.current_calls_;
+            zone.current_ms_ = 0.0;
+            zone.current_calls_ = 0;
+        }
+        head_ = (head_ + 1) % HISTORY_SIZE;
+        frame_count_ = std::min(frame_count_ + 1, HISTORY_SIZE);
+    }
+
+    void Profiler::addSample(std::size_t zone_id, double elapsed_ms)
+    {
+        std::lock_guard lock(zones_mutex_);
+        if (zone_id >= zones_.size())
+        {
+            zones_.resize(zone_id + 1); // 新注册的区域，历史数据为0
+        }
+        auto &zone = zones_[zone_id];
+        zone.current_ms_ += elapsed_ms;
+        ++zone.current_calls_;
+    }
+
+    void Profiler::setCounter(const char *name, std::int64_t value)
+    {
+        findCounter(name).value_ = value;
+    }
+
+    void Profiler::addCounter(const char *name, std::int64_t delta)
+    {
+        auto &counter = findCounter(name);
+        counter.per_frame_ = true;
+        counter.value_ += delta;
+    }
+
+    Profiler::Counter &Profiler::findCounter(const char *name)
+    {
+        auto it = std::find_if(counters_.begin(), counters_.end(), [name](const Counter &counter)
+                               { return counter.name_ == name || std::strcmp(counter.name_, name) == 0; });
+        if (it != counters_.end())
+        {
+            return *it;
+        }
+        return counters_.emplace_back(Counter{name, 0});
+    }
+
+    void Profiler::computeStats(std::vector<ZoneStats> &out) const
+    {
+        out.clear();
+        out.reserve(zones_.size());
+        for (std::size_t i = 0; i < zones_.size(); ++i)
+        {
+            auto stats = computeHistoryStats(zoneName(i), zones_[i].history_);
+            stats.calls_ = zones_[i].last_calls_;
+            out.push_back(stats);
+        }
+    }
+
+    Profiler::ZoneStats Profiler::computeFrameStats() const
+    {
+        auto stats = computeHistoryStats("Frame", frame_history_);
+        stats.calls_ = 1;
+        return stats;
+    }
+
+    Profiler::ZoneStats Profiler::computeHistoryStats(const char *name, const std::array<float, HISTORY_SIZE> &history) const
+    {
+        ZoneStats stats;
+        stats.name_ = name;
+        if (frame_count_ == 0)
+            return stats;
+
+        // 有效数据：未写满时为 [0, frame_count_)，写满后为整个缓冲区
+        scratch_.assign(history.begin(), history.begin() + frame_count_);
+        stats.last_ms_ = history[(head_ + HISTORY_SIZE - 1) % HISTORY_SIZE];
+
+        double sum = 0.0;
+        for (auto value : scratch_)
+            sum += value;
+        stats.avg_ms_ = static_cast<float>(sum / static_cast<double>(scratch_.size()));
+
+        // 99分位：取第 ceil(0.99 * n) 小的值
+        const auto p99_index = static_cast<std::size_t>(std::ceil(0.99 * static_cast<double>(scratch_.size()))) - 1;
+        std::nth_element(scratch_.begin(), scratch_.begin() + p99_index, scratch_.end());
+        stats.p99_ms_ = scratch_[p99_index];
+        // nth_element之后，p99之后的元素都不小于它，之前的都不大于它
+        stats.max_ms_ = *std::max_element(scratch_.begin() + p99_index, scratch_.end());
+        stats.min_ms_ = *std::min_element(scratch_.begin(), scratch_.begin() + p99_index + 1);
+        return stats;
+    }
+
+} // namespace engine::debug
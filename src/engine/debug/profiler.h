@@ -0,0 +1,192 @@
+#pragma once
+#include "../core/trace_recorder.h"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace engine::debug
+{
+
+    /**
+     * @brief 帧分析器：记录每个计时区域(zone)每帧的耗时，并保留最近 HISTORY_SIZE 帧的历史。
+     *
+     * 使用方式：主循环每帧开始调用 beginFrame()，结束调用 endFrame()；
+     * 需要计时的代码块使用 ENGINE_PROFILE_SCOPE("名称") 宏（正在记录 trace 时，同一区域也会写入 TraceRecorder）。
+     * 同一区域在一帧内被多次进入时（如固定步长下一帧执行多个tick），耗时会累加。
+     *
+     * 区域编号是全局的（按首次注册的顺序分配），因此宏可以把编号缓存在静态变量中。
+     * addSample() 可以从任意线程调用（SystemScheduler 会在工作线程中执行系统），其余接口只应在主线程调用。
+     */
+    class Profiler final
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+        static constexpr std::size_t HISTORY_SIZE{240}; ///< @brief 历史帧数（环形缓冲区长度）
+
+        /// @brief 某个区域在历史窗口内的统计数据（单位：毫秒）
+        struct ZoneStats
+        {
+            const char *name_{""};     ///< @brief 区域名称
+            float last_ms_{0.0f};      ///< @brief 上一帧的耗时
+            float min_ms_{0.0f};       ///< @brief 最小耗时
+            float avg_ms_{0.0f};       ///< @brief 平均耗时
+            float p99_ms_{0.0f};       ///< @brief 99分位耗时
+            float max_ms_{0.0f};       ///< @brief 最大耗时
+            std::uint32_t calls_{0};   ///< @brief 上一帧的进入次数
+        };
+
+        /// @brief 计数器（如实体数量），只保留最新值；每帧累加的计数器（addCounter）保留本帧的累计值
+        struct Counter
+        {
+            const char *name_{""};
+            std::int64_t value_{0};
+            bool per_frame_{false}; ///< @brief 是否为每帧累加的计数器（beginFrame() 时清零）
+        };
+
+    private:
+        /// @brief 单个区域的计时数据
+        struct Zone
+        {
+            std::array<float, HISTORY_SIZE> history_{}; ///< @brief 每帧耗时的环形缓冲区
+            double current_ms_{0.0};                    ///< @brief 当前帧累计的耗时
+            std::uint32_t current_calls_{0};            ///< @brief 当前帧的进入次数
+            std::uint32_t last_calls_{0};               ///< @brief 上一帧的进入次数
+        };
+
+        inline static Profiler *current_{nullptr}; ///< @brief 当前使用的分析器（由 GameApp 设置）
+
+        std::mutex zones_mutex_;                          ///< @brief 保护 zones_ 的写入（addSample 可能来自工作线程）
+        std::vector<Zone> zones_;                         ///< @brief 按区域编号索引
+        std::array<float, HISTORY_SIZE> frame_history_{}; ///< @brief 每帧总耗时的环形缓冲区
+        std::size_t head_{0};                             ///< @brief 下一帧写入的位置
+        std::size_t frame_count_{0};                      ///< @brief 已记录的有效帧数（不超过 HISTORY_SIZE）
+        Clock::time_point frame_start_{Clock::now()};     ///< @brief 当前帧开始的时间
+        std::vector<Counter> counters_;                   ///< @brief 计数器
+        mutable std::vector<float> scratch_;              ///< @brief 计算分位数时使用的临时缓冲（避免每次分配）
+
+    public:
+        Profiler() = default;
+        ~Profiler();
+
+        Profiler(const Profiler &) = delete;
+        Profiler &operator=(const Profiler &) = delete;
+        Profiler(Profiler &&) = delete;
+        Profiler &operator=(Profiler &&) = delete;
+
+        static Profiler *current() { return current_; }                  ///< @brief 获取当前分析器（可能为空）
+        static void setCurrent(Profiler *profiler) { current_ = profiler; } ///< @brief 设置当前分析器
+
+        /**
+         * @brief 获取（必要时注册）区域编号。同名区域返回同一编号。
+         * @param name 区域名称，必须是静态生命周期的字符串（如字符串字面量）
+         */
+        static std::size_t zoneId(const char *name);
+        static const char *zoneName(std::size_t id); ///< @brief 获取区域名称
+
+        void beginFrame();                                    ///< @brief 开始新的一帧
+        void endFrame();                                      ///< @brief 结束当前帧，把各区域的耗时写入历史
+        void addSample(std::size_t zone_id, double elapsed_ms); ///< @brief 记录一次区域耗时（由 ProfileScope 调用）
+
+        /**
+         * @brief 设置计数器的值（同名计数器会被覆盖）
+         * @param name 计数器名称，必须是静态生命周期的字符串
+         */
+        void setCounter(const char *name, std::int64_t value);
+
+        /**
+         * @brief 累加每帧计数器（beginFrame() 时清零），用于一帧内可能执行多次的代码（如固定步长下的多个tick）
+         * @param name 计数器名称，必须是静态生命周期的字符串
+         * @param delta 增量
+         */
+        void addCounter(const char *name, std::int64_t delta);
+
+        /**
+         * @brief 计算所有区域在历史窗口内的统计数据（按注册顺序排列）
+         * @param out 输出（会先被清空）
+         */
+        void computeStats(std::vector<ZoneStats> &out) const;
+
+        /**
+         * @brief 计算帧耗时在历史窗口内的统计数据
+         */
+        [[nodiscard]] ZoneStats computeFrameStats() const;
+
+        const std::vector<Counter> &getCounters() const { return counters_; }                   ///< @brief 获取所有计数器
+        const float *getFrameHistory() const { return frame_history_.data(); }                    ///< @brief 帧耗时环形缓冲区
+        std::size_t getHistoryCount() const { return frame_count_; }                              ///< @brief 有效帧数
+        std::size_t getHistoryOffset() const { return frame_count_ < HISTORY_SIZE ? 0 : head_; }  ///< @brief 最旧一帧在缓冲区中的位置
+
+    private:
+        Counter &findCounter(const char *name); ///< @brief 查找计数器，不存在时添加
+        ZoneStats computeHistoryStats(const char *name, const std::array<float, HISTORY_SIZE> &history) const;
+    };
+
+    /**
+     * @brief RAII 计时器：构造时记录开始时间，析构时把耗时提交给分析器，
+     *        正在记录 trace 时同时提交给 TraceRecorder。
+     */
+    class ProfileScope final
+    {
+        Profiler *profiler_;
+        std::size_t zone_id_;
+        const char *name_;
+        std::string_view detail_;
+        bool tracing_;
+        Profiler::Clock::time_point start_;
+
+    public:
+        /**
+         * @param profiler 分析器（可为空）
+         * @param zone_id 区域编号
+         * @param name 区域名称（静态字符串）
+         * @param detail 附加信息，只写入 trace（必须在作用域内保持有效）
+         */
+        ProfileScope(Profiler *profiler, std::size_t zone_id, const char *name, std::string_view detail = {})
+            : profiler_(profiler), zone_id_(zone_id), name_(name), detail_(detail),
+              tracing_(core::TraceRecorder::isActive()),
+              start_((profiler_ || tracing_) ? Profiler::Clock::now() : Profiler::Clock::time_point{}) {}
+
+        ~ProfileScope()
+        {
+            if (!profiler_ && !tracing_)
+                return;
+            const auto end = Profiler::Clock::now();
+            if (profiler_)
+            {
+                const std::chrono::duration<double, std::milli> elapsed = end - start_;
+                profiler_->addSample(zone_id_, elapsed.count());
+            }
+            if (tracing_)
+            {
+                if (auto *recorder = core::TraceRecorder::current())
+                    recorder->record(name_, start_, end, detail_);
+            }
+        }
+
+        ProfileScope(const ProfileScope &) = delete;
+        ProfileScope &operator=(const ProfileScope &) = delete;
+    };
+
+} // namespace engine::debug
+
+// --- 计时宏 ---
+// 定义 ENGINE_DISABLE_PROFILER 可以在编译期移除所有计时代码
+#define ENGINE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define ENGINE_PROFILE_CONCAT(a, b) ENGINE_PROFILE_CONCAT_IMPL(a, b)
+
+#ifndef ENGINE_DISABLE_PROFILER
+/// @brief 对当前作用域计时（帧分析器 + trace），name 必须是字符串字面量
+#define ENGINE_PROFILE_SCOPE(name) ENGINE_PROFILE_SCOPE_DETAIL(name, std::string_view{})
+/// @brief 同 ENGINE_PROFILE_SCOPE，并在 trace 事件中附带 detail（如资源路径）
+#define ENGINE_PROFILE_SCOPE_DETAIL(name, detail)                                                                             \
+    static const std::size_t ENGINE_PROFILE_CONCAT(engine_profile_zone_, __LINE__) = ::engine::debug::Profiler::zoneId(name); \
+    const ::engine::debug::ProfileScope ENGINE_PROFILE_CONCAT(engine_profile_scope_, __LINE__)(                                \
+        ::engine::debug::Profiler::current(), ENGINE_PROFILE_CONCAT(engine_profile_zone_, __LINE__), name, detail)
+#else
+#define ENGINE_PROFILE_SCOPE(name) ((void)0)
+#define ENGINE_PROFILE_SCOPE_DETAIL(name, detail) ((void)0)
+#endif
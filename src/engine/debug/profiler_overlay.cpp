@@ -0,0 +1,122 @@
+#include "profiler_overlay.h"
+#include <SDL3/SDL.h>
+#include <imgui.h>
+#include <imgui_impl_sdl3.h>
+#include <imgui_impl_sdlrenderer3.h>
+#include <spdlog/spdlog.h>
+#include <stdexcept>
+
+namespace engine::debug
+{
+
+    ProfilerOverlay::ProfilerOverlay(SDL_Window *window, SDL_Renderer *renderer, const Profiler &profiler)
+        : window_(window), renderer_(renderer), profiler_(profiler)
+    {
+        IMGUI_CHECKVERSION();
+        ImGui::CreateContext();
+        ImGui::GetIO().IniFilename = nullptr; // 不生成 imgui.ini
+        ImGui::StyleColorsDark();
+        if (!ImGui_ImplSDL3_InitForSDLRenderer(window_, renderer_) || !ImGui_ImplSDLRenderer3_Init(renderer_))
+        {
+            ImGui::DestroyContext();
+            throw std::runtime_error("ProfilerOverlay: 初始化 ImGui 后端失败。");
+        }
+        SDL_AddEventWatch(&ProfilerOverlay::onSDLEvent, this);
+        zone_stats_.reserve(32);
+        spdlog::trace("ProfilerOverlay 初始化成功。");
+    }
+
+    ProfilerOverlay::~ProfilerOverlay()
+    {
+        SDL_RemoveEventWatch(&ProfilerOverlay::onSDLEvent, this);
+        ImGui_ImplSDLRenderer3_Shutdown();
+        ImGui_ImplSDL3_Shutdown();
+        ImGui::DestroyContext();
+    }
+
+    bool ProfilerOverlay::onSDLEvent(void *userdata, SDL_Event *event)
+    {
+        auto *self = static_cast<ProfilerOverlay *>(userdata);
+        if (self->visible_)
+        {
+            ImGui_ImplSDL3_ProcessEvent(event);
+        }
+        return true; // 事件监视的返回值会被忽略
+    }
+
+    void ProfilerOverlay::render()
+    {
+        if (!visible_)
+            return;
+
+        ImGui_ImplSDLRenderer3_NewFrame();
+        ImGui_ImplSDL3_NewFrame();
+        ImGui::NewFrame();
+
+        ImGui::SetNextWindowPos(ImVec2(8.0f, 8.0f), ImGuiCond_FirstUseEver);
+        ImGui::SetNextWindowSize(ImVec2(460.0f, 520.0f), ImGuiCond_FirstUseEver);
+        ImGui::SetNextWindowBgAlpha(0.85f);
+        if (ImGui::Begin("Profiler (F3)", &visible_))
+        {
+            // --- 帧耗时 ---
+            const auto frame = profiler_.computeFrameStats();
+            ImGui::Text("Frame: %.2f ms (%.0f FPS)  min %.2f  avg %.2f  p99 %.2f  max %.2f",
+                        frame.last_ms_, frame.last_ms_ > 0.0f ? 1000.0f / frame.last_ms_ : 0.0f,
+                        frame.min_ms_, frame.avg_ms_, frame.p99_ms_, frame.max_ms_);
+            ImGui::PlotLines("##frame_time", profiler_.getFrameHistory(), static_cast<int>(profiler_.getHistoryCount()),
+                             static_cast<int>(profiler_.getHistoryOffset()), nullptr, 0.0f, frame.max_ms_ * 1.1f,
+                             ImVec2(-1.0f, 60.0f));
+
+            // --- 计数器 ---
+            for (const auto &counter : profiler_.getCounters())
+            {
+                ImGui::Text("%s: %lld", counter.name_, static_cast<long long>(counter.value_));
+                ImGui::SameLine(0.0f, 16.0f);
+            }
+            ImGui::NewLine();
+
+            // --- 各计时区域 ---
+            profiler_.computeStats(zone_stats_);
+            constexpr auto table_flags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_SizingStretchProp | ImGuiTableFlags_ScrollY;
+            if (ImGui::BeginTable("##zones", 6, table_flags))
+            {
+                ImGui::TableSetupScrollFreeze(0, 1);
+                ImGui::TableSetupColumn("Zone", ImGuiTableColumnFlags_WidthStretch, 3.0f);
+                ImGui::TableSetupColumn("Calls");
+                ImGui::TableSetupColumn("Last");
+                ImGui::TableSetupColumn("Min");
+                ImGui::TableSetupColumn("Avg");
+                ImGui::TableSetupColumn("P99");
+                ImGui::TableHeadersRow();
+                for (const auto &stats : zone_stats_)
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(stats.name_);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%u", stats.calls_);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", stats.last_ms_);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", stats.min_ms_);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", stats.avg_ms_);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", stats.p99_ms_);
+                }
+                ImGui::EndTable();
+            }
+        }
+        ImGui::End();
+        ImGui::Render();
+
+        // ImGui 使用窗口坐标，绘制时暂时关闭逻辑分辨率，结束后恢复
+        int logical_width = 0, logical_height = 0;
+        SDL_RendererLogicalPresentation mode = SDL_LOGICAL_PRESENTATION_DISABLED;
+        SDL_GetRenderLogicalPresentation(renderer_, &logical_width, &logical_height, &mode);
+        SDL_SetRenderLogicalPresentation(renderer_, 0, 0, SDL_LOGICAL_PRESENTATION_DISABLED);
+        ImGui_ImplSDLRenderer3_RenderDrawData(ImGui::GetDrawData(), renderer_);
+        SDL_SetRenderLogicalPresentation(renderer_, logical_width, logical_height, mode);
+    }
+
+} // namespace engine::debug
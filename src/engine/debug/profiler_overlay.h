@@ -0,0 +1,48 @@
+#pragma once
+#include "profiler.h"
+#include <vector>
+
+struct SDL_Window;
+struct SDL_Renderer;
+union SDL_Event;
+
+namespace engine::debug
+{
+
+    /**
+     * @brief 分析器的 ImGui 叠加层：显示帧耗时曲线、各计时区域的 min/avg/p99 以及计数器。
+     *
+     * 负责 ImGui 上下文及 SDL3/SDL_Renderer 后端的创建和销毁。
+     * SDL 事件通过事件监视(SDL_AddEventWatch)转发给 ImGui，不需要修改输入管理器。
+     */
+    class ProfilerOverlay final
+    {
+        SDL_Window *window_;
+        SDL_Renderer *renderer_;
+        const Profiler &profiler_;
+        bool visible_{false};                         ///< @brief 是否显示
+        std::vector<Profiler::ZoneStats> zone_stats_; ///< @brief 每次绘制时重新计算的统计数据（复用内存）
+
+    public:
+        /**
+         * @brief 构造函数，初始化 ImGui
+         * @throws std::runtime_error 如果 ImGui 后端初始化失败
+         */
+        ProfilerOverlay(SDL_Window *window, SDL_Renderer *renderer, const Profiler &profiler);
+        ~ProfilerOverlay();
+
+        ProfilerOverlay(const ProfilerOverlay &) = delete;
+        ProfilerOverlay &operator=(const ProfilerOverlay &) = delete;
+        ProfilerOverlay(ProfilerOverlay &&) = delete;
+        ProfilerOverlay &operator=(ProfilerOverlay &&) = delete;
+
+        void render(); ///< @brief 绘制叠加层（在 present 之前调用，不可见时什么也不做）
+
+        void toggle() { visible_ = !visible_; }         ///< @brief 切换显示/隐藏
+        bool isVisible() const { return visible_; }     ///< @brief 是否显示
+
+    private:
+        static bool onSDLEvent(void *userdata, SDL_Event *event); ///< @brief SDL 事件监视回调，把事件转发给 ImGui
+    };
+
+} // namespace engine::debug
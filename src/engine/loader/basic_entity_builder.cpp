@@ -7,6 +7,7 @@
 #include "../component/transform_component.h"
 #include "../component/render_component.h"
 #include "../resource/resource_manager.h"
+#include "../resource/animation_library.h"
 #include <entt/entt.hpp>
 #include <spdlog/spdlog.h>
 
@@ -115,10 +116,11 @@ namespace engine::loader
         // 如果是自定义形状对象，则不需要SpriteComponent
         if (!tile_info_)
             return;
-        // 创建Sprite时候确保纹理加载
+        // 创建Sprite时候确保纹理加载，并解析纹理句柄（之后绘制时直接使用句柄）
         auto &resource_manager = context_.getResourceManager();
-        resource_manager.loadTexture(tile_info_->sprite_.texture_id_, tile_info_->sprite_.texture_path_);
-        registry_.emplace<engine::component::SpriteComponent>(entity_id_, tile_info_->sprite_);
+        auto sprite = tile_info_->sprite_;
+        sprite.texture_handle_ = resource_manager.resolveTexture(sprite.texture_id_, tile_info_->texture_path_);
+        registry_.emplace<engine::component::SpriteComponent>(entity_id_, std::move(sprite));
     }
 
     void BasicEntityBuilder::buildTransform()
@@ -160,6 +162,9 @@ namespace engine::loader
         spdlog::trace("构建Render组件");
         int layer = level_loader_.getCurrentLayer(); // 确定图层
         float depth = position_.y;                   // 确定深度（默认y坐标）
+        // 瓦片层实体不会移动，标记为静态（需要在RenderComponent之前添加）
+        if (index_ >= 0)
+            registry_.emplace<engine::component::StaticRenderTag>(entity_id_);
         registry_.emplace<engine::component::RenderComponent>(entity_id_, layer, depth);
     }
 
@@ -169,12 +174,19 @@ namespace engine::loader
         // 如果存在动画，其信息已经解析并保存在tile_info_中
         if (tile_info_ && tile_info_->animation_)
         {
-            // 创建动画map
-            std::unordered_map<entt::id_type, engine::component::Animation> animations;
+            // 同一图块的动画只在动画库中登记一次，之后的瓦片实体直接引用
+            auto &library = context_.getResourceManager().getAnimationLibrary();
             auto animation_id = entt::hashed_string("tile"); // 图块动画名称默认为"tile"
-            animations.emplace(animation_id, std::move(tile_info_->animation_.value()));
-            // 通过动画map创建AnimationComponent，并添加
-            registry_.emplace<engine::component::AnimationComponent>(entity_id_, std::move(animations), animation_id);
+            auto set_id = library.findSet(tile_info_->animation_key_);
+            if (set_id == engine::resource::INVALID_ANIMATION_ID)
+            {
+                set_id = library.createSet(tile_info_->animation_key_);
+                library.addClip(set_id, animation_id, *tile_info_->animation_);
+            }
+            const auto clip_id = library.findClip(set_id, animation_id);
+            // 组件只保存集合与片段索引
+            registry_.emplace<engine::component::AnimationComponent>(entity_id_, set_id, animation_id, clip_id,
+                                                                     library.getClip(clip_id).loop_);
         }
     }
 
@@ -0,0 +1,151 @@
+#include "cooked_level.h"
+#include <array>
+#include <cstdint>
+
+namespace engine::loader
+{
+
+    namespace
+    {
+        /// @brief 各段单条记录的大小（字节）
+        constexpr std::array<std::size_t, cooked::SECTION_COUNT> RECORD_SIZES{
+            sizeof(char),              // STRINGS
+            sizeof(cooked::Source),    // SOURCES
+            sizeof(cooked::Texture),   // TEXTURES
+            sizeof(cooked::Tile),      // TILES
+            sizeof(cooked::Frame),     // FRAMES
+            sizeof(cooked::Property),  // PROPERTIES
+            sizeof(cooked::Layer),     // LAYERS
+            sizeof(std::uint32_t),     // CELLS
+            sizeof(cooked::Object),    // OBJECTS
+        };
+
+        constexpr std::array<const char *, cooked::SECTION_COUNT> SECTION_NAMES{
+            "STRINGS", "SOURCES", "TEXTURES", "TILES", "FRAMES", "PROPERTIES", "LAYERS", "CELLS", "OBJECTS"};
+    }
+
+    bool CookedLevel::open(std::string_view path)
+    {
+        header_ = nullptr;
+        error_.clear();
+        if (!file_.open(path))
+            return fail("无法映射文件");
+        if (!validate())
+        {
+            header_ = nullptr;
+            file_.close();
+            return false;
+        }
+        return true;
+    }
+
+    std::string_view CookedLevel::getString(const cooked::StringRef &ref) const
+    {
+        const auto strings = section<char>(cooked::STRINGS);
+        return {strings.data() + ref.offset_, ref.size_};
+    }
+
+    bool CookedLevel::fail(std::string message)
+    {
+        error_ = std::move(message);
+        return false;
+    }
+
+    bool CookedLevel::checkString(const cooked::StringRef &ref) const
+    {
+        const std::uint64_t end = static_cast<std::uint64_t>(ref.offset_) + ref.size_;
+        return end <= header_->sections_[cooked::STRINGS].count_;
+    }
+
+    bool CookedLevel::checkRange(const cooked::Range &range, cooked::Section index) const
+    {
+        const std::uint64_t end = static_cast<std::uint64_t>(range.first_) + range.count_;
+        return end <= header_->sections_[index].count_;
+    }
+
+    bool CookedLevel::validate()
+    {
+        // --- 文件头 ---
+        if (file_.size() < sizeof(cooked::Header))
+            return fail("文件过小");
+        header_ = reinterpret_cast<const cooked::Header *>(file_.data());
+        if (header_->magic_ != cooked::MAGIC)
+            return fail("不是烘焙关卡文件");
+        if (header_->version_ != cooked::VERSION)
+            return fail("版本 " + std::to_string(header_->version_) + " 与当前版本 " + std::to_string(cooked::VERSION) + " 不一致，需要重新烘焙");
+        if (header_->map_width_ < 0 || header_->map_height_ < 0 || header_->tile_width_ < 0 || header_->tile_height_ < 0)
+            return fail("地图尺寸无效");
+
+        // --- 段的边界 ---
+        for (std::size_t i = 0; i < cooked::SECTION_COUNT; ++i)
+        {
+            const auto &entry = header_->sections_[i];
+            const std::uint64_t end = entry.offset_ + static_cast<std::uint64_t>(entry.count_) * RECORD_SIZES[i];
+            if (entry.offset_ % 4 != 0 || entry.offset_ < sizeof(cooked::Header) || end > file_.size())
+                return fail(std::string("段 ") + SECTION_NAMES[i] + " 超出文件范围");
+        }
+
+        // --- 记录之间的引用 ---
+        const auto texture_count = header_->sections_[cooked::TEXTURES].count_;
+        const auto tile_count = header_->sections_[cooked::TILES].count_;
+        for (const auto &source : getSources())
+        {
+            if (!checkString(source.path_))
+                return fail("源文件路径无效");
+        }
+        for (const auto &texture : getTextures())
+        {
+            if (!checkString(texture.path_))
+                return fail("纹理路径无效");
+        }
+        for (const auto &tile : getTiles())
+        {
+            if (tile.texture_ >= texture_count || !checkRange(tile.frames_, cooked::FRAMES) || !checkRange(tile.properties_, cooked::PROPERTIES))
+                return fail("瓦片描述无效");
+        }
+        for (const auto &property : section<cooked::Property>(cooked::PROPERTIES))
+        {
+            if (!checkString(property.name_) || !checkString(property.string_value_) ||
+                static_cast<std::uint32_t>(property.type_) > static_cast<std::uint32_t>(cooked::PropertyType::FILE))
+                return fail("属性无效");
+        }
+        for (const auto &cell : section<std::uint32_t>(cooked::CELLS))
+        {
+            if (cell != cooked::NONE && cell >= tile_count)
+                return fail("瓦片层网格引用了不存在的瓦片");
+        }
+        for (const auto &object : section<cooked::Object>(cooked::OBJECTS))
+        {
+            if (!checkString(object.name_) || !checkRange(object.properties_, cooked::PROPERTIES) ||
+                (object.tile_ != cooked::NONE && object.tile_ >= tile_count))
+                return fail("对象无效");
+        }
+        const auto cell_count = static_cast<std::uint64_t>(header_->map_width_) * static_cast<std::uint64_t>(header_->map_height_);
+        for (const auto &layer : getLayers())
+        {
+            if (!checkString(layer.name_))
+                return fail("图层名称无效");
+            switch (layer.type_)
+            {
+            case cooked::LayerType::IMAGE:
+                if (layer.texture_ >= texture_count)
+                    return fail("图片层的纹理无效");
+                break;
+            case cooked::LayerType::TILE:
+                if (!checkRange(layer.cells_, cooked::CELLS) || layer.cells_.count_ != cell_count)
+                    return fail("瓦片层的网格大小与地图不一致");
+                break;
+            case cooked::LayerType::OBJECT:
+                if (!checkRange(layer.objects_, cooked::OBJECTS))
+                    return fail("对象层的对象范围无效");
+                break;
+            case cooked::LayerType::EMPTY:
+                break;
+            default:
+                return fail("未知的图层类型");
+            }
+        }
+        return true;
+    }
+
+} // namespace engine::loader
@@ -0,0 +1,64 @@
+#pragma once
+#include "cooked_level_format.h"
+#include "../utils/mapped_file.h"
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace engine::loader
+{
+
+    /**
+     * @brief 烘焙关卡文件（.mwl）的只读视图：内存映射文件，打开时校验一次，之后的访问直接返回文件中的记录。
+     *
+     * open() 会检查文件头、各段的边界，以及所有字符串引用、下标与范围是否有效，
+     * 因此通过校验后，按记录中的引用访问其它段不需要再检查（也不会越界）。
+     * 返回的 span 与 string_view 指向映射的内存，只在 CookedLevel 存活且没有重新 open() 期间有效。
+     */
+    class CookedLevel final
+    {
+        engine::utils::MappedFile file_;
+        const cooked::Header *header_{nullptr};
+        std::string error_; ///< @brief 最近一次校验失败的原因
+
+    public:
+        CookedLevel() = default;
+
+        /**
+         * @brief 映射并校验烘焙关卡文件
+         * @param path 文件路径
+         * @return true 成功，false 文件不存在、格式或版本不符、数据损坏（原因见 getError()）
+         */
+        [[nodiscard]] bool open(std::string_view path);
+
+        [[nodiscard]] const cooked::Header &getHeader() const { return *header_; }
+        [[nodiscard]] const std::string &getError() const { return error_; }
+
+        // --- 段 ---
+        [[nodiscard]] std::span<const cooked::Source> getSources() const { return section<cooked::Source>(cooked::SOURCES); }
+        [[nodiscard]] std::span<const cooked::Texture> getTextures() const { return section<cooked::Texture>(cooked::TEXTURES); }
+        [[nodiscard]] std::span<const cooked::Tile> getTiles() const { return section<cooked::Tile>(cooked::TILES); }
+        [[nodiscard]] std::span<const cooked::Layer> getLayers() const { return section<cooked::Layer>(cooked::LAYERS); }
+
+        // --- 通过引用访问 ---
+        [[nodiscard]] std::string_view getString(const cooked::StringRef &ref) const;
+        [[nodiscard]] std::span<const cooked::Frame> getFrames(const cooked::Range &range) const { return section<cooked::Frame>(cooked::FRAMES).subspan(range.first_, range.count_); }
+        [[nodiscard]] std::span<const cooked::Property> getProperties(const cooked::Range &range) const { return section<cooked::Property>(cooked::PROPERTIES).subspan(range.first_, range.count_); }
+        [[nodiscard]] std::span<const std::uint32_t> getCells(const cooked::Range &range) const { return section<std::uint32_t>(cooked::CELLS).subspan(range.first_, range.count_); }
+        [[nodiscard]] std::span<const cooked::Object> getObjects(const cooked::Range &range) const { return section<cooked::Object>(cooked::OBJECTS).subspan(range.first_, range.count_); }
+
+    private:
+        template <typename T>
+        std::span<const T> section(cooked::Section index) const
+        {
+            const auto &entry = header_->sections_[index];
+            return {reinterpret_cast<const T *>(file_.data() + entry.offset_), entry.count_};
+        }
+
+        bool validate();                                                          ///< @brief 校验整个文件（失败时设置 error_）
+        bool fail(std::string message);                                           ///< @brief 记录错误并返回 false
+        bool checkString(const cooked::StringRef &ref) const;                     ///< @brief 字符串引用是否在 STRINGS 段内
+        bool checkRange(const cooked::Range &range, cooked::Section index) const; ///< @brief 范围是否在指定段内
+    };
+
+} // namespace engine::loader
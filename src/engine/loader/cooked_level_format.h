@@ -0,0 +1,196 @@
+#pragma once
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file cooked_level_format.h
+ * @brief 烘焙关卡文件（.mwl）的二进制格式，由离线工具 level_cooker 从 Tiled 地图（.tmj + .tsj）生成，
+ *        LevelLoader 通过内存映射直接读取，不需要解析 JSON。
+ *
+ * 文件由 Header 和若干段（section）组成，每段是一个定长记录的数组，位置与数量记录在 Header::sections_ 中。
+ * 所有数值为小端序，所有记录按 4 字节对齐，段的起始位置也按 4 字节对齐。
+ * 字符串统一存放在 STRINGS 段（不以 '\0' 结尾），其它记录通过 StringRef 引用；
+ * 记录之间通过数组下标引用（如瓦片引用纹理），一组连续的记录用 Range 表示。
+ *
+ * 烘焙时已经完成的工作：解析路径（相对于工作目录，已规范化）、计算纹理ID（路径的哈希值）、
+ * 把瓦片层的 gid 解析为去重后的瓦片描述（源矩形、翻转、类型、动画帧、自定义属性）、丢弃不可见的图层。
+ * 修改格式时需要增加 VERSION，读取时版本不一致的文件会被拒绝（LevelLoader 会退回到读取 JSON）。
+ */
+namespace engine::loader::cooked
+{
+
+    inline constexpr std::uint32_t MAGIC = 0x314C574D; ///< @brief "MWL1"（小端序）
+    inline constexpr std::uint32_t VERSION = 1;
+    inline constexpr std::uint32_t NONE = 0xFFFFFFFFu; ///< @brief 空引用（下标类字段）
+
+    static_assert(std::endian::native == std::endian::little, "烘焙关卡文件按小端序直接映射使用");
+
+    /// @brief 段编号
+    enum Section : std::uint32_t
+    {
+        STRINGS,    ///< @brief char：字符串数据
+        SOURCES,    ///< @brief Source：烘焙时读取的源文件（地图与图块集），用于判断烘焙结果是否过期
+        TEXTURES,   ///< @brief Texture：用到的纹理
+        TILES,      ///< @brief Tile：去重后的瓦片描述
+        FRAMES,     ///< @brief Frame：瓦片动画帧
+        PROPERTIES, ///< @brief Property：自定义属性（瓦片与对象的属性）
+        LAYERS,     ///< @brief Layer：图层（按加载顺序）
+        CELLS,      ///< @brief std::uint32_t：瓦片层网格，值为 TILES 下标，NONE 表示空
+        OBJECTS,    ///< @brief Object：对象层中的对象
+        SECTION_COUNT
+    };
+
+    /// @brief 字符串引用（STRINGS 段中的偏移与长度）
+    struct StringRef
+    {
+        std::uint32_t offset_{0};
+        std::uint32_t size_{0};
+    };
+
+    /// @brief 连续记录的范围（所在段中的起始下标与数量）
+    struct Range
+    {
+        std::uint32_t first_{0};
+        std::uint32_t count_{0};
+    };
+
+    /**
+     * @brief 计算文件内容的哈希值（FNV-1a），用于判断源文件在烘焙之后是否被修改过
+     * @note 比较内容而不是修改时间：从版本库检出时文件的修改时间没有意义
+     */
+    constexpr std::uint32_t hashContent(const unsigned char *data, std::size_t size)
+    {
+        std::uint32_t hash = 2166136261u;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            hash ^= data[i];
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    /// @brief 段在文件中的位置
+    struct SectionEntry
+    {
+        std::uint32_t offset_{0}; ///< @brief 相对文件开头的字节偏移
+        std::uint32_t count_{0};  ///< @brief 记录数量
+    };
+
+    struct Header
+    {
+        std::uint32_t magic_{MAGIC};
+        std::uint32_t version_{VERSION};
+        std::int32_t map_width_{0};   ///< @brief 地图宽度（瓦片数）
+        std::int32_t map_height_{0};  ///< @brief 地图高度（瓦片数）
+        std::int32_t tile_width_{0};  ///< @brief 瓦片宽度（像素）
+        std::int32_t tile_height_{0}; ///< @brief 瓦片高度（像素）
+        std::uint32_t has_background_color_{0};
+        float background_color_[4]{}; ///< @brief 背景颜色 RGBA（0~1）
+        SectionEntry sections_[SECTION_COUNT];
+    };
+
+    /// @brief 源文件
+    struct Source
+    {
+        StringRef path_;          ///< @brief 路径（相对于工作目录）
+        std::uint32_t size_{0};   ///< @brief 烘焙时的文件大小（字节）
+        std::uint32_t hash_{0};   ///< @brief 烘焙时的内容哈希值（hashContent）
+    };
+
+    struct Texture
+    {
+        std::uint32_t id_{0}; ///< @brief 纹理ID（entt::hashed_string(path)）
+        StringRef path_;      ///< @brief 纹理路径
+    };
+
+    /// @brief 瓦片类型（与 engine::component::TileType 的取值一致）
+    enum class TileType : std::uint8_t
+    {
+        EMPTY,
+        NORMAL,
+        SOLID,
+        HAZARD,
+    };
+
+    /// @brief 瓦片描述：对应一个 gid（包含翻转标志位，翻转的瓦片是独立的描述）
+    struct Tile
+    {
+        std::uint32_t texture_{NONE};    ///< @brief TEXTURES 下标
+        float src_rect_[4]{};            ///< @brief 源矩形 x, y, w, h
+        std::uint8_t is_flipped_{0};     ///< @brief 是否水平翻转
+        TileType type_{TileType::NORMAL};
+        std::uint8_t padding_[2]{};
+        std::uint32_t animation_set_{0}; ///< @brief 图块集路径的哈希值（与局部ID组合为 AnimationLibrary 的集合键）
+        std::uint32_t local_id_{0};      ///< @brief 图块集中的局部ID
+        Range frames_;                   ///< @brief 动画帧（FRAMES），数量为 0 表示没有动画
+        Range properties_;               ///< @brief 自定义属性（PROPERTIES），数量为 0 表示没有属性
+    };
+
+    struct Frame
+    {
+        float src_rect_[4]{};     ///< @brief 源矩形 x, y, w, h
+        float duration_ms_{0.0f}; ///< @brief 帧时长（毫秒）
+    };
+
+    /// @brief 自定义属性的类型（对应 Tiled 属性的 type 字段）
+    enum class PropertyType : std::uint32_t
+    {
+        BOOL,
+        INT,
+        FLOAT,
+        STRING,
+        OBJECT, ///< @brief 对象引用，值为对象ID
+        COLOR,  ///< @brief 颜色，值为字符串（"#AARRGGBB"）
+        FILE,   ///< @brief 文件，值为字符串
+    };
+
+    struct Property
+    {
+        StringRef name_;
+        PropertyType type_{PropertyType::STRING};
+        std::int32_t int_value_{0};   ///< @brief BOOL、INT、OBJECT 的值
+        float float_value_{0.0f};     ///< @brief FLOAT 的值
+        StringRef string_value_;      ///< @brief STRING、COLOR、FILE 的值
+    };
+
+    enum class LayerType : std::uint32_t
+    {
+        IMAGE,
+        TILE,
+        OBJECT,
+        EMPTY, ///< @brief 没有可加载内容的图层（缺少数据或不支持的类型），只占用一个图层序号
+    };
+
+    struct Layer
+    {
+        LayerType type_{LayerType::TILE};
+        StringRef name_;
+        std::int32_t order_{0};          ///< @brief 图层属性 "order" 的值
+        std::uint8_t has_order_{0};      ///< @brief 是否设置了 "order"
+        std::uint8_t bake_{1};           ///< @brief 图层属性 "bake"（瓦片层，默认为真）
+        std::uint8_t repeat_x_{0};       ///< @brief 图片层是否横向重复
+        std::uint8_t repeat_y_{0};       ///< @brief 图片层是否纵向重复
+        float offset_[2]{};              ///< @brief 图层偏移
+        float parallax_[2]{1.0f, 1.0f};  ///< @brief 视差因子
+        std::uint32_t texture_{NONE};    ///< @brief 图片层的纹理（TEXTURES 下标）
+        Range cells_;                    ///< @brief 瓦片层的网格（CELLS，数量为地图宽 * 高）
+        Range objects_;                  ///< @brief 对象层的对象（OBJECTS）
+    };
+
+    struct Object
+    {
+        std::int32_t id_{0};
+        StringRef name_;
+        std::uint32_t tile_{NONE}; ///< @brief 图片对象的瓦片描述（TILES 下标），NONE 表示自定义形状
+        float x_{0.0f};
+        float y_{0.0f};
+        float width_{0.0f};
+        float height_{0.0f};
+        float rotation_{0.0f};
+        std::uint8_t is_point_{0}; ///< @brief 是否为点对象（如路径节点）
+        std::uint8_t padding_[3]{};
+        Range properties_; ///< @brief 自定义属性（PROPERTIES），路径节点的连接即 OBJECT 类型的属性
+    };
+
+} // namespace engine::loader::cooked
@@ -1,7 +1,9 @@
 #include "level_loader.h"
+#include "cooked_level.h"
 #include "../scene/scene.h"
 #include "../core/context.h"
 #include "../resource/resource_manager.h"
+#include "../resource/animation_library.h"
 #include "../component/tilelayer_component.h"
 #include "../component/name_component.h"
 #include "../component/sprite_component.h"
@@ -10,16 +12,24 @@
 #include "../component/render_component.h"
 #include "../render/renderer.h"
 #include "../utils/math.h"
+#include "../utils/mapped_file.h"
+#include "../debug/profiler.h"
+#include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <spdlog/spdlog.h>
 #include <SDL3/SDL_rect.h>
+#include <SDL3/SDL_render.h>
+#include <glm/common.hpp>
 #include <entt/entity/registry.hpp>
 #include <entt/core/hashed_string.hpp>
 
 namespace engine::loader
 {
 
+    static_assert(static_cast<int>(engine::component::TileType::HAZARD) == static_cast<int>(cooked::TileType::HAZARD),
+                  "烘焙文件中的瓦片类型与 TileType 的取值必须一致");
+
     LevelLoader::~LevelLoader() = default;
 
     void LevelLoader::setEntityBuilder(std::unique_ptr<BasicEntityBuilder> builder)
@@ -29,6 +39,7 @@ namespace engine::loader
 
     bool LevelLoader::loadLevel(std::string_view level_path, engine::scene::Scene *scene)
     {
+        ENGINE_PROFILE_SCOPE_DETAIL("LevelLoader::loadLevel", level_path);
         if (!scene)
         {
             spdlog::error("场景指针为空");
@@ -42,6 +53,26 @@ namespace engine::loader
             entity_builder_ = std::make_unique<BasicEntityBuilder>(*this, scene->getContext(), scene->getRegistry());
         }
 
+        // 优先使用烘焙关卡文件，不可用时读取 JSON（两种方式都记录耗时，便于比较）
+        const auto start_time = std::chrono::steady_clock::now();
+        std::string_view format = "JSON";
+        CookedLevel cooked_level;
+        if (use_cooked_level_ && openCookedLevel(level_path, cooked_level))
+        {
+            format = "烘焙文件";
+            loadCookedLevel(level_path, cooked_level);
+        }
+        else if (!loadJsonLevel(level_path))
+        {
+            return false;
+        }
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start_time;
+        spdlog::info("关卡加载完成: {}（{}，耗时 {:.2f} ms）", level_path, format, elapsed.count());
+        return true;
+    }
+
+    bool LevelLoader::loadJsonLevel(std::string_view level_path)
+    {
         // 1. 加载 JSON 文件
         auto path = std::filesystem::path(level_path);
         std::ifstream file(path);
@@ -139,11 +170,210 @@ namespace engine::loader
             spdlog::info("当前图层: {}, 图层ID: {}", layer_json.value("name", "Unnamed"), current_layer_);
             current_layer_++; // 每加载一个图层，图层ID加1
         }
+        return true;
+    }
+
+    bool LevelLoader::openCookedLevel(std::string_view level_path, CookedLevel &level)
+    {
+        const auto cooked_path = std::filesystem::path(level_path).replace_extension(".mwl");
+        std::error_code error;
+        if (!std::filesystem::exists(cooked_path, error))
+        {
+            spdlog::debug("没有烘焙关卡文件 '{}'，读取 JSON", cooked_path.string());
+            return false;
+        }
+        if (!level.open(cooked_path.string()))
+        {
+            spdlog::warn("烘焙关卡文件 '{}' 无法使用（{}），读取 JSON", cooked_path.string(), level.getError());
+            return false;
+        }
 
-        spdlog::info("关卡加载完成: {}", level_path);
+        // 源文件（地图与图块集）在烘焙之后被修改过，则烘焙结果已过期；源文件不存在时（如只发布烘焙文件）直接使用
+        for (const auto &source : level.getSources())
+        {
+            const std::string source_path(level.getString(source.path_));
+            engine::utils::MappedFile source_file;
+            if (!source_file.open(source_path))
+                continue;
+            const auto *data = reinterpret_cast<const unsigned char *>(source_file.data());
+            if (source_file.size() != source.size_ || cooked::hashContent(data, source_file.size()) != source.hash_)
+            {
+                spdlog::warn("烘焙关卡文件 '{}' 已过期（'{}' 已修改），读取 JSON。请重新运行 level_cooker", cooked_path.string(), source_path);
+                return false;
+            }
+        }
         return true;
     }
 
+    void LevelLoader::loadCookedLevel(std::string_view level_path, const CookedLevel &level)
+    {
+        // 1. 基本地图信息及背景颜色
+        const auto &header = level.getHeader();
+        map_path_ = level_path; // 与 JSON 相同（区块纹理的ID由地图路径决定）
+        map_size_ = glm::ivec2(header.map_width_, header.map_height_);
+        tile_size_ = glm::ivec2(header.tile_width_, header.tile_height_);
+        if (header.has_background_color_)
+        {
+            const auto *color = header.background_color_;
+            scene_->getContext().getRenderer().setBgColorFloat(color[0], color[1], color[2], color[3]);
+        }
+
+        // 2. 瓦片描述已在烘焙时解析并去重，每种只需转换一次
+        std::vector<engine::component::TileInfo> tile_infos;
+        tile_infos.reserve(level.getTiles().size());
+        for (const auto &tile : level.getTiles())
+        {
+            tile_infos.push_back(makeTileInfo(level, tile));
+        }
+
+        // 3. 图层（不可见的图层在烘焙时已被丢弃，图层序号的规则与 JSON 相同）
+        for (const auto &layer : level.getLayers())
+        {
+            if (layer.has_order_)
+            {
+                current_layer_ = layer.order_;
+            }
+            const std::string layer_name(level.getString(layer.name_));
+            switch (layer.type_)
+            {
+            case cooked::LayerType::IMAGE:
+            {
+                const auto &texture = level.getTextures()[layer.texture_];
+                createImageLayer(layer_name, texture.id_, std::string(level.getString(texture.path_)),
+                                 glm::vec2(layer.offset_[0], layer.offset_[1]), glm::vec2(layer.parallax_[0], layer.parallax_[1]),
+                                 glm::bvec2(layer.repeat_x_ != 0, layer.repeat_y_ != 0));
+                break;
+            }
+            case cooked::LayerType::TILE:
+            {
+                const auto cells = level.getCells(layer.cells_);
+                createTileLayer(layer_name, layer.bake_ != 0, cells.size(),
+                                [&](size_t index) -> std::optional<engine::component::TileInfo>
+                                {
+                                    if (cells[index] == cooked::NONE)
+                                        return std::nullopt;
+                                    return tile_infos[cells[index]];
+                                });
+                break;
+            }
+            case cooked::LayerType::OBJECT:
+                for (const auto &object : level.getObjects(layer.objects_))
+                {
+                    // 实体生成器以 json 为输入，这里由记录直接构造（不需要解析文本）
+                    const auto object_json = makeObject(level, object);
+                    if (object.tile_ == cooked::NONE)
+                    {
+                        entity_builder_->configure(&object_json)->build();
+                    }
+                    else
+                    {
+                        entity_builder_->configure(&object_json, &tile_infos[object.tile_])->build();
+                    }
+                }
+                break;
+            case cooked::LayerType::EMPTY:
+                break;
+            }
+            spdlog::info("当前图层: {}, 图层ID: {}", layer_name, current_layer_);
+            current_layer_++; // 每加载一个图层，图层ID加1
+        }
+    }
+
+    engine::component::TileInfo LevelLoader::makeTileInfo(const CookedLevel &level, const cooked::Tile &tile)
+    {
+        const auto &texture = level.getTextures()[tile.texture_];
+        engine::component::TileInfo tile_info;
+        tile_info.sprite_ = engine::component::Sprite(texture.id_,
+                                                      engine::utils::Rect{glm::vec2(tile.src_rect_[0], tile.src_rect_[1]),
+                                                                          glm::vec2(tile.src_rect_[2], tile.src_rect_[3])},
+                                                      tile.is_flipped_ != 0);
+        tile_info.texture_path_ = level.getString(texture.path_);
+        tile_info.type_ = static_cast<engine::component::TileType>(tile.type_);
+        if (tile.frames_.count_ > 0)
+        {
+            std::vector<engine::component::AnimationFrame> animation_frames;
+            animation_frames.reserve(tile.frames_.count_);
+            for (const auto &frame : level.getFrames(tile.frames_))
+            {
+                animation_frames.emplace_back(engine::utils::Rect{glm::vec2(frame.src_rect_[0], frame.src_rect_[1]),
+                                                                  glm::vec2(frame.src_rect_[2], frame.src_rect_[3])},
+                                              frame.duration_ms_);
+            }
+            tile_info.animation_ = engine::component::Animation(std::move(animation_frames));
+            tile_info.animation_key_ = engine::resource::AnimationLibrary::combineKey(tile.animation_set_, tile.local_id_);
+        }
+        if (tile.properties_.count_ > 0)
+        {
+            tile_info.properties_ = makeProperties(level, tile.properties_);
+        }
+        return tile_info;
+    }
+
+    nlohmann::json LevelLoader::makeProperties(const CookedLevel &level, const cooked::Range &range)
+    {
+        auto properties = nlohmann::json::array();
+        for (const auto &property : level.getProperties(range))
+        {
+            nlohmann::json property_json;
+            property_json["name"] = level.getString(property.name_);
+            switch (property.type_)
+            {
+            case cooked::PropertyType::BOOL:
+                property_json["type"] = "bool";
+                property_json["value"] = property.int_value_ != 0;
+                break;
+            case cooked::PropertyType::INT:
+                property_json["type"] = "int";
+                property_json["value"] = property.int_value_;
+                break;
+            case cooked::PropertyType::FLOAT:
+                property_json["type"] = "float";
+                property_json["value"] = property.float_value_;
+                break;
+            case cooked::PropertyType::OBJECT:
+                property_json["type"] = "object";
+                property_json["value"] = property.int_value_;
+                break;
+            case cooked::PropertyType::STRING:
+                property_json["type"] = "string";
+                property_json["value"] = level.getString(property.string_value_);
+                break;
+            case cooked::PropertyType::COLOR:
+                property_json["type"] = "color";
+                property_json["value"] = level.getString(property.string_value_);
+                break;
+            case cooked::PropertyType::FILE:
+                property_json["type"] = "file";
+                property_json["value"] = level.getString(property.string_value_);
+                break;
+            }
+            properties.push_back(std::move(property_json));
+        }
+        return properties;
+    }
+
+    nlohmann::json LevelLoader::makeObject(const CookedLevel &level, const cooked::Object &object)
+    {
+        nlohmann::json object_json = {
+            {"id", object.id_},
+            {"name", level.getString(object.name_)},
+            {"x", object.x_},
+            {"y", object.y_},
+            {"width", object.width_},
+            {"height", object.height_},
+            {"rotation", object.rotation_},
+        };
+        if (object.is_point_)
+        {
+            object_json["point"] = true;
+        }
+        if (object.properties_.count_ > 0)
+        {
+            object_json["properties"] = makeProperties(level, object.properties_);
+        }
+        return object_json;
+    }
+
     void LevelLoader::loadImageLayer(const nlohmann::json &layer_json)
     {
         // 获取纹理相对路径 （会自动处理'\/\'符号）
@@ -155,11 +385,8 @@ namespace engine::loader
             return;
         }
 
-        // 创建精灵 (在获取纹理大小时会确保纹理加载)
         auto texture_path = resolvePath(image_path, map_path_);
-        auto &resource_manager = scene_->getContext().getResourceManager();
-        auto texture_size = resource_manager.getTextureSize(entt::hashed_string(texture_path.c_str()), texture_path);
-        auto sprite = engine::component::Sprite(texture_path, engine::utils::Rect{glm::vec2(0.0f), texture_size});
+        entt::id_type texture_id = entt::hashed_string(texture_path.c_str());
 
         // 获取图层偏移量（json中没有则代表未设置，给默认值即可）
         const glm::vec2 offset = glm::vec2(layer_json.value("offsetx", 0.0f), layer_json.value("offsety", 0.0f));
@@ -168,12 +395,21 @@ namespace engine::loader
         const glm::vec2 scroll_factor = glm::vec2(layer_json.value("parallaxx", 1.0f), layer_json.value("parallaxy", 1.0f));
         const glm::bvec2 repeat = glm::bvec2(layer_json.value("repeatx", false), layer_json.value("repeaty", false));
 
-        // 获取图层名称
-        std::string layer_name = layer_json.value("name", "Unnamed");
-        entt::id_type name_id = entt::hashed_string(layer_name.c_str());
-
         /*  可用类似方法获取其它各种属性，这里我们暂时用不上 */
 
+        createImageLayer(layer_json.value("name", "Unnamed"), texture_id, texture_path, offset, scroll_factor, repeat);
+    }
+
+    void LevelLoader::createImageLayer(const std::string &layer_name, entt::id_type texture_id, const std::string &texture_path,
+                                       const glm::vec2 &offset, const glm::vec2 &scroll_factor, const glm::bvec2 &repeat)
+    {
+        // 创建精灵 (在获取纹理大小时会确保纹理加载)
+        auto &resource_manager = scene_->getContext().getResourceManager();
+        auto texture_size = resource_manager.getTextureSize(texture_id, texture_path);
+        auto sprite = engine::component::Sprite(texture_id, engine::utils::Rect{glm::vec2(0.0f), texture_size},
+                                                false, resource_manager.resolveTexture(texture_id, texture_path));
+        entt::id_type name_id = entt::hashed_string(layer_name.c_str());
+
         // 创建图层实体
         auto &registry = scene_->getRegistry();
         auto entity = registry.create();
@@ -183,6 +419,7 @@ namespace engine::loader
         registry.emplace<engine::component::TransformComponent>(entity, offset);
         registry.emplace<engine::component::ParallaxComponent>(entity, scroll_factor, repeat);
         registry.emplace<engine::component::SpriteComponent>(entity, sprite);
+        registry.emplace<engine::component::StaticRenderTag>(entity);
         registry.emplace<engine::component::RenderComponent>(entity, current_layer_);
         /* 实体与组件创建完毕后即由registry自动管理，不需要“添加到场景”的步骤 */
 
@@ -197,8 +434,27 @@ namespace engine::loader
             return;
         }
 
-        // 获取图层名称
-        std::string layer_name = layer_json.value("name", "Unnamed");
+        // 获取图层数据 (瓦片 ID 列表)，按索引解析为瓦片信息
+        const auto &data = layer_json["data"];
+        createTileLayer(layer_json.value("name", "Unnamed"), getTileProperty<bool>(layer_json, "bake").value_or(true), data.size(),
+                        [&](size_t index) -> std::optional<engine::component::TileInfo>
+                        {
+                            const int gid = data[index].get<int>();
+                            if (gid == 0)
+                                return std::nullopt;
+                            auto tile_info = getTileInfoByGid(gid);
+                            if (!tile_info)
+                            {
+                                spdlog::error("瓦片 ID 为 {} 的瓦片未找到图块集。", gid);
+                            }
+                            return tile_info;
+                        });
+    }
+
+    void LevelLoader::createTileLayer(const std::string &layer_name, bool bake_layer, size_t cell_count,
+                                      const std::function<std::optional<engine::component::TileInfo>(size_t)> &tile_at)
+    {
+        // 获取图层名称ID
         entt::id_type name_id = entt::hashed_string(layer_name.c_str());
 
         // 创建图层实体
@@ -209,39 +465,152 @@ namespace engine::loader
         // 准备瓦片实体vector (瓦片数量 = 地图宽度 * 地图高度)
         std::vector<entt::entity> tiles;
         tiles.reserve(map_size_.x * map_size_.y);
-
-        // 获取图层数据 (瓦片 ID 列表)
-        const auto &data = layer_json["data"];
-
-        size_t index = 0; // data数据的索引，它决定图块在地图中的位置
-        // --- 每一个瓦片都是一个独立的entity ---
-        for (const int gid : data)
+        std::vector<entt::entity> chunks;
+
+        // 确定是否烘焙及区块尺寸（区块不超过地图本身的大小）
+        const bool bake = bake_tile_layers_ && bake_chunk_size_ > 0 && bake_layer;
+        const glm::ivec2 map_pixel_size = map_size_ * tile_size_;
+        const glm::ivec2 chunk_size = glm::max(glm::min(glm::ivec2(bake_chunk_size_), map_pixel_size), glm::ivec2(1));
+        const glm::ivec2 chunk_count = (map_pixel_size + chunk_size - glm::ivec2(1)) / chunk_size;
+        // 每个区块中待烘焙的瓦片 (data索引, 瓦片信息)
+        std::vector<std::vector<std::pair<size_t, engine::component::TileInfo>>> chunk_tiles(bake ? chunk_count.x * chunk_count.y : 0);
+
+        // index 为 data 数据的索引，它决定图块在地图中的位置
+        // --- 每一个瓦片都是一个独立的entity (可烘焙的瓦片先按区块收集起来) ---
+        for (size_t index = 0; index < cell_count; ++index)
         {
-            if (gid == 0)
-            {
-                index++;
-                continue;
-            }
-            auto tile_info = getTileInfoByGid(gid);
+            auto tile_info = tile_at(index);
             if (!tile_info)
+                continue;
+            if (bake && isBakeable(index, tile_info.value(), chunk_size))
             {
-                spdlog::error("瓦片 ID 为 {} 的瓦片未找到图块集。", gid);
-                index++;
+                const glm::ivec2 cell{static_cast<int>(index % map_size_.x), static_cast<int>(index / map_size_.x)};
+                const glm::ivec2 chunk_coord = cell * tile_size_ / chunk_size;
+                chunk_tiles[chunk_coord.y * chunk_count.x + chunk_coord.x].emplace_back(index, std::move(tile_info.value()));
                 continue;
             }
             // 使用生成器创建瓦片实体
             auto tile_entity = entity_builder_->configure(index, &tile_info.value())->build()->getEntityID();
             // 添加到vector中
             tiles.push_back(tile_entity);
-            index++;
+        }
+
+        // --- 烘焙各个区块，每个区块只生成一个实体 ---
+        size_t baked_count = 0;
+        for (size_t i = 0; i < chunk_tiles.size(); ++i)
+        {
+            auto &tiles_in_chunk = chunk_tiles[i];
+            if (tiles_in_chunk.empty())
+                continue;
+            const glm::ivec2 chunk_coord{static_cast<int>(i) % chunk_count.x, static_cast<int>(i) / chunk_count.x};
+            auto chunk_entity = bakeChunk(layer_name, chunk_coord, chunk_size, tiles_in_chunk);
+            if (chunk_entity != entt::null)
+            {
+                chunks.push_back(chunk_entity);
+                baked_count += tiles_in_chunk.size();
+                continue;
+            }
+            // 烘焙失败（例如渲染器不支持渲染目标），退回到逐瓦片创建实体
+            for (auto &[tile_index, tile_info] : tiles_in_chunk)
+            {
+                tiles.push_back(entity_builder_->configure(tile_index, &tile_info)->build()->getEntityID());
+            }
+        }
+        if (bake)
+        {
+            spdlog::info("图层 '{}' 烘焙完成: {} 个瓦片合并为 {} 个区块, 保留 {} 个瓦片实体", layer_name, baked_count, chunks.size(), tiles.size());
         }
 
         // 最后将瓦片层组件添加到图层实体中
-        registry.emplace<engine::component::TileLayerComponent>(layer_entity, tile_size_, map_size_, tiles);
+        registry.emplace<engine::component::TileLayerComponent>(layer_entity, tile_size_, map_size_, std::move(tiles), std::move(chunks));
 
         spdlog::info("加载图层: '{}' 完成", layer_name);
     }
 
+    bool LevelLoader::isBakeable(size_t index, const engine::component::TileInfo &tile_info, const glm::ivec2 &chunk_size) const
+    {
+        // 动画瓦片需要每帧更新，带自定义属性的瓦片可能会被游戏逻辑识别（如地点），它们都需要保留为实体
+        if (tile_info.animation_ || tile_info.properties_)
+            return false;
+        // 瓦片绘制在所在单元格的左上角，尺寸可能大于单元格（多图片图块集），超出所在区块的瓦片无法烘焙
+        const glm::ivec2 position{static_cast<int>(index % map_size_.x) * tile_size_.x, static_cast<int>(index / map_size_.x) * tile_size_.y};
+        const glm::ivec2 chunk_end = (position / chunk_size + glm::ivec2(1)) * chunk_size;
+        const glm::ivec2 tile_end = position + glm::ivec2(tile_info.sprite_.src_rect_.size);
+        return tile_end.x <= chunk_end.x && tile_end.y <= chunk_end.y;
+    }
+
+    entt::entity LevelLoader::bakeChunk(std::string_view layer_name,
+                                        const glm::ivec2 &chunk_coord,
+                                        const glm::ivec2 &chunk_size,
+                                        const std::vector<std::pair<size_t, engine::component::TileInfo>> &tiles)
+    {
+        auto &context = scene_->getContext();
+        auto &resource_manager = context.getResourceManager();
+        auto &renderer = context.getRenderer();
+        auto *sdl_renderer = renderer.getSDLRenderer();
+
+        // 区块纹理的ID由 地图路径 + 图层名称 + 区块坐标 决定，重新加载同一关卡时会替换旧的纹理
+        const glm::ivec2 origin = chunk_coord * chunk_size;
+        const glm::ivec2 size = glm::min(chunk_size, map_size_ * tile_size_ - origin);
+        const std::string chunk_name = map_path_ + "#" + std::string(layer_name) + "#" + std::to_string(chunk_coord.x) + "_" + std::to_string(chunk_coord.y);
+        const entt::id_type chunk_texture_id = entt::hashed_string(chunk_name.c_str());
+        auto *chunk_texture = resource_manager.createRenderTarget(chunk_texture_id, size.x, size.y);
+        if (!chunk_texture)
+            return entt::null;
+
+        // 先提交渲染器中尚未绘制的批次，再切换渲染目标
+        renderer.flush();
+        if (!SDL_SetRenderTarget(sdl_renderer, chunk_texture))
+        {
+            spdlog::error("无法切换到区块纹理 '{}': {}", chunk_name, SDL_GetError());
+            resource_manager.unloadTexture(chunk_texture_id);
+            return entt::null;
+        }
+        float r, g, b, a;
+        SDL_GetRenderDrawColorFloat(sdl_renderer, &r, &g, &b, &a);
+        SDL_SetRenderDrawColorFloat(sdl_renderer, 0.0f, 0.0f, 0.0f, 0.0f);
+        SDL_RenderClear(sdl_renderer);
+
+        // 按data顺序（即y坐标从小到大）绘制，与逐瓦片渲染时的深度顺序一致
+        for (const auto &[index, tile_info] : tiles)
+        {
+            const auto &sprite = tile_info.sprite_;
+            const auto region = resource_manager.getTextureRegion(sprite.texture_id_, tile_info.texture_path_);
+            auto *texture = region.texture_;
+            if (!texture)
+            {
+                spdlog::error("烘焙区块 '{}' 时无法获取纹理 ID: {}", chunk_name, sprite.texture_id_);
+                continue;
+            }
+            const glm::vec2 position{static_cast<float>(static_cast<int>(index % map_size_.x) * tile_size_.x - origin.x),
+                                     static_cast<float>(static_cast<int>(index / map_size_.x) * tile_size_.y - origin.y)};
+            SDL_FRect src_rect = {sprite.src_rect_.position.x + region.offset_.x, sprite.src_rect_.position.y + region.offset_.y,
+                                  sprite.src_rect_.size.x, sprite.src_rect_.size.y};
+            SDL_FRect dest_rect = {position.x, position.y, sprite.src_rect_.size.x, sprite.src_rect_.size.y};
+            SDL_SetTextureColorModFloat(texture, 1.0f, 1.0f, 1.0f);
+            SDL_SetTextureAlphaModFloat(texture, 1.0f);
+            SDL_RenderTextureRotated(sdl_renderer, texture, &src_rect, &dest_rect, 0.0, nullptr,
+                                     sprite.is_flipped_ ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE);
+        }
+
+        // 恢复默认渲染目标及绘制颜色
+        SDL_SetRenderTarget(sdl_renderer, nullptr);
+        SDL_SetRenderDrawColorFloat(sdl_renderer, r, g, b, a);
+
+        // 创建区块实体，渲染时与普通精灵无异（纹理已在ResourceManager中，因此用ID构造Sprite即可）
+        auto &registry = scene_->getRegistry();
+        auto entity = registry.create();
+        const std::string entity_name = std::string(layer_name) + "_chunk_" + std::to_string(chunk_coord.x) + "_" + std::to_string(chunk_coord.y);
+        registry.emplace<engine::component::NameComponent>(entity, entt::hashed_string(entity_name.c_str()).value(), entity_name);
+        registry.emplace<engine::component::TransformComponent>(entity, glm::vec2(origin));
+        registry.emplace<engine::component::SpriteComponent>(entity, engine::component::Sprite(chunk_texture_id, engine::utils::Rect{glm::vec2(0.0f), glm::vec2(size)},
+                                                                                             false, resource_manager.resolveTexture(chunk_texture_id)));
+        registry.emplace<engine::component::StaticRenderTag>(entity);
+        registry.emplace<engine::component::RenderComponent>(entity, current_layer_, static_cast<float>(origin.y));
+        spdlog::trace("烘焙区块 '{}' 完成，包含 {} 个瓦片", chunk_name, tiles.size());
+        return entity;
+    }
+
     void LevelLoader::loadObjectLayer(const nlohmann::json &layer_json)
     {
         if (!layer_json.contains("objects") || !layer_json["objects"].is_array())
@@ -419,6 +788,7 @@ namespace engine::loader
             auto texture_path = resolvePath(image_path, file_path);
             // 创建精灵，考虑水平翻转标志
             tile_info.sprite_ = engine::component::Sprite(texture_path, texture_rect, is_flipped_horizontally);
+            tile_info.texture_path_ = texture_path;
             tile_info.type_ = getTileTypeById(tileset, local_id); // 获取瓦片类型（只有瓦片id，还没找具体瓦片json）
             is_single_image = true;
         }
@@ -454,6 +824,7 @@ namespace engine::loader
                                                         glm::vec2(tile_json.value("x", 0.0f), tile_json.value("y", 0.0f)),
                                                         glm::vec2(tile_json.value("width", image_width), tile_json.value("height", image_height))};
                     tile_info.sprite_ = engine::component::Sprite(texture_path, texture_rect, is_flipped_horizontally);
+                    tile_info.texture_path_ = texture_path;
                     scene_->getContext().getResourceManager().loadTexture(entt::hashed_string(texture_path.c_str()), texture_path); // 确保纹理被加载
                     tile_info.type_ = getTileType(tile_json);                                                                       // 获取瓦片类型（已经有具体瓦片json了）
                 }
@@ -474,6 +845,7 @@ namespace engine::loader
                     }
                     // TODO: 未来可在Tiled中添加动画事件并解析，目前项目暂不需要，让事件为默认空
                     tile_info.animation_ = engine::component::Animation(std::move(animation_frames));
+                    tile_info.animation_key_ = engine::resource::AnimationLibrary::combineKey(entt::hashed_string(file_path.c_str()), static_cast<entt::id_type>(local_id));
                 }
                 // 补充属性信息
                 if (tile_json.contains("properties"))
@@ -1,6 +1,8 @@
 #pragma once
 #include "../utils/math.h"
 #include "basic_entity_builder.h"
+#include "cooked_level_format.h"
+#include <functional>
 #include <string>
 #include <string_view>
 #include <memory>
@@ -10,6 +12,8 @@
 #include <entt/entity/registry.hpp>
 #include <SDL3/SDL_rect.h>
 #include <map>
+#include <utility>
+#include <vector>
 
 namespace engine::component
 {
@@ -24,9 +28,16 @@ namespace engine::scene
 
 namespace engine::loader
 {
+    class CookedLevel;
 
     /**
      * 关卡加载器，负责加载关卡数据，并生成游戏实体
+     *
+     * 关卡有两种来源：
+     * - 烘焙关卡文件（.mwl，由 level_cooker 离线生成）：与地图同名、同目录，存在且没有过期时优先使用，
+     *   内存映射后直接读取，路径、纹理ID与瓦片信息都已经预先解析好；
+     * - Tiled 地图（.tmj + .tsj）：没有烘焙文件、烘焙文件无效或过期（源文件内容与烘焙时不同）时读取。
+     * 两种来源生成的实体相同（对象层的对象与瓦片属性仍以 json 的形式交给实体生成器），加载耗时会输出到日志。
      */
     class LevelLoader final
     {
@@ -45,6 +56,10 @@ namespace engine::loader
 
         int current_layer_ = 0; ///< @brief 当前图层序号（用于RenderComponent，决定渲染顺序）
 
+        bool bake_tile_layers_ = true; ///< @brief 是否将瓦片层中的静态瓦片烘焙到区块纹理中
+        int bake_chunk_size_ = 512;    ///< @brief 烘焙区块的边长(像素)
+        bool use_cooked_level_ = true; ///< @brief 是否优先使用烘焙关卡文件
+
     public:
         LevelLoader() = default; ///< @brief 默认构造函数
         ~LevelLoader();
@@ -53,7 +68,7 @@ namespace engine::loader
         void setEntityBuilder(std::unique_ptr<BasicEntityBuilder> builder);
 
         /**
-         * @brief 加载关卡数据，并生成游戏实体
+         * @brief 加载关卡数据，并生成游戏实体（有可用的烘焙关卡文件时读取烘焙文件，否则读取 JSON）
          * @param level_path 关卡文件路径（.tmj）
          * @param scene 场景指针（非拥有）
          * @return true 加载成功，false 加载失败
@@ -64,12 +79,84 @@ namespace engine::loader
         const glm::ivec2 &getMapSize() const { return map_size_; }
         const glm::ivec2 &getTileSize() const { return tile_size_; }
         int getCurrentLayer() const { return current_layer_; }
+        bool isBakeTileLayers() const { return bake_tile_layers_; }
+        int getBakeChunkSize() const { return bake_chunk_size_; }
+
+        /**
+         * @brief 设置是否烘焙瓦片层（默认开启）。
+         * @note 开启后，瓦片层中没有动画和自定义属性的瓦片会被预先绘制到若干区块纹理中，
+         *       每个区块只对应一个实体；单个图层也可以通过Tiled图层属性 "bake" = false 关闭烘焙。
+         */
+        void setBakeTileLayers(bool bake) { bake_tile_layers_ = bake; }
+        void setBakeChunkSize(int chunk_size) { bake_chunk_size_ = chunk_size; } ///< @brief 设置烘焙区块的边长(像素)
+        void setUseCookedLevel(bool use) { use_cooked_level_ = use; }           ///< @brief 设置是否优先使用烘焙关卡文件（默认开启，关闭时总是读取 JSON）
 
     private:
+        [[nodiscard]] bool loadJsonLevel(std::string_view level_path); ///< @brief 从 Tiled 地图（.tmj）加载
+
+        /**
+         * @brief 打开与地图同名的烘焙关卡文件（.mwl），并检查是否过期
+         * @param level_path 地图路径（.tmj）
+         * @param level 输出：打开的烘焙关卡
+         * @return true 烘焙文件可用，false 不存在、无效或已过期（应读取 JSON）
+         */
+        [[nodiscard]] bool openCookedLevel(std::string_view level_path, CookedLevel &level);
+        void loadCookedLevel(std::string_view level_path, const CookedLevel &level); ///< @brief 从烘焙关卡加载（已通过校验，不会失败）
+
+        /// @brief 把烘焙的瓦片描述转换为瓦片信息
+        engine::component::TileInfo makeTileInfo(const CookedLevel &level, const cooked::Tile &tile);
+        /// @brief 把烘焙的属性转换为与 Tiled 相同的 json 数组（[{"name", "type", "value"}]），供实体生成器使用
+        nlohmann::json makeProperties(const CookedLevel &level, const cooked::Range &range);
+        /// @brief 把烘焙的对象转换为与 Tiled 相同的 json 对象，供实体生成器使用
+        nlohmann::json makeObject(const CookedLevel &level, const cooked::Object &object);
+
         void loadImageLayer(const nlohmann::json &layer_json);  ///< @brief 加载图片图层
         void loadTileLayer(const nlohmann::json &layer_json);   ///< @brief 加载瓦片图层
         void loadObjectLayer(const nlohmann::json &layer_json); ///< @brief 加载对象图层
 
+        /**
+         * @brief 创建图片图层实体（两种来源共用）
+         * @param layer_name 图层名称
+         * @param texture_id 纹理ID
+         * @param texture_path 纹理路径
+         * @param offset 图层偏移
+         * @param scroll_factor 视差因子
+         * @param repeat 是否重复
+         */
+        void createImageLayer(const std::string &layer_name, entt::id_type texture_id, const std::string &texture_path,
+                              const glm::vec2 &offset, const glm::vec2 &scroll_factor, const glm::bvec2 &repeat);
+
+        /**
+         * @brief 创建瓦片图层（两种来源共用）：逐个单元格生成瓦片实体，或把静态瓦片烘焙到区块纹理中
+         * @param layer_name 图层名称
+         * @param bake_layer 图层是否允许烘焙（图层属性 "bake"）
+         * @param cell_count 单元格数量（图层 data 的长度）
+         * @param tile_at 按单元格索引获取瓦片信息，空单元格或无法解析时返回 std::nullopt
+         */
+        void createTileLayer(const std::string &layer_name, bool bake_layer, size_t cell_count,
+                             const std::function<std::optional<engine::component::TileInfo>(size_t)> &tile_at);
+
+        /**
+         * @brief 判断瓦片是否可以被烘焙（没有动画、没有自定义属性，且不会超出所在区块）
+         * @param index 瓦片在图层data数据中的索引
+         * @param tile_info 瓦片信息
+         * @param chunk_size 区块边长(像素)
+         */
+        bool isBakeable(size_t index, const engine::component::TileInfo &tile_info, const glm::ivec2 &chunk_size) const;
+
+        /**
+         * @brief 将一个区块内的静态瓦片绘制到渲染目标纹理中，并创建对应的区块实体
+         * @param layer_name 图层名称（用于生成区块纹理ID和实体名称）
+         * @param chunk_coord 区块坐标
+         * @param chunk_size 区块边长(像素)
+         * @param tiles 区块内的瓦片 (data索引, 瓦片信息)，按绘制顺序排列
+         * @return 区块实体，失败时返回 entt::null（调用者应退回到逐瓦片创建实体）
+         */
+        entt::entity bakeChunk(std::string_view layer_name,
+                               const glm::ivec2 &chunk_coord,
+                               const glm::ivec2 &chunk_size,
+                               const std::vector<std::pair<size_t, engine::component::TileInfo>> &tiles);
+
         /**
          * @brief 加载 Tiled tileset 文件 (.tsj)，数据保存到tileset_data_。
          * @param tileset_path Tileset 文件路径。
@@ -1,5 +1,6 @@
 #pragma once
 #include "../utils/math.h"
+#include "../resource/texture_handle.h"
 #include <SDL3/SDL_rect.h> // 用于 SDL_FRect
 #include <optional>        // 用于 std::optional 表示可选的源矩形
 #include <string>
@@ -24,6 +25,8 @@ namespace engine::render
         entt::id_type texture_id_{entt::null};           ///< @brief 纹理资源的标识符 (entt::null是推荐的初始化方式，表示无效的ID)
         std::optional<engine::utils::Rect> source_rect_; ///< @brief 可选：要绘制的纹理部分
         bool is_flipped_ = false;                        ///< @brief 是否水平翻转
+        /// @brief 纹理句柄缓存（UI图片不经过实体工厂，首次绘制时由Renderer解析并缓存，之后直接使用）
+        mutable engine::resource::TextureHandle texture_handle_{};
 
     public:
         /**
@@ -66,6 +69,8 @@ namespace engine::render
         entt::id_type getTextureId() const { return texture_id_; }                               ///< @brief 获取纹理 ID
         const std::optional<engine::utils::Rect> &getSourceRect() const { return source_rect_; } ///< @brief 获取源矩形 (如果使用整个纹理则为 std::nullopt)
         bool isFlipped() const { return is_flipped_; }                                           ///< @brief 获取是否水平翻转
+        engine::resource::TextureHandle getTextureHandle() const { return texture_handle_; }     ///< @brief 获取缓存的纹理句柄
+        void cacheTextureHandle(engine::resource::TextureHandle handle) const { texture_handle_ = handle; } ///< @brief 缓存纹理句柄（不影响Image的逻辑状态）
 
         /**
          * @brief 设置纹理路径同时更新纹理ID
@@ -75,9 +80,15 @@ namespace engine::render
         {
             texture_path_ = texture_path.data();
             texture_id_ = entt::hashed_string(texture_path.data());
+            texture_handle_ = {};
         }
 
-        void setTextureId(entt::id_type texture_id) { texture_id_ = texture_id; } ///< @brief 设置纹理ID (需确保已载入)
+        /// @brief 设置纹理ID (需确保已载入)
+        void setTextureId(entt::id_type texture_id)
+        {
+            texture_id_ = texture_id;
+            texture_handle_ = {};
+        }
 
         /**
          * @brief 设置源矩形 (如果使用整个纹理则为 std::nullopt)
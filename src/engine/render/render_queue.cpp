@@ -0,0 +1,135 @@
+#include "render_queue.h"
+#include "../component/render_component.h"
+#include <algorithm>
+#include <spdlog/spdlog.h>
+
+namespace engine::render
+{
+
+    RenderQueue::RenderQueue(entt::registry &registry) : registry_(registry)
+    {
+        registry_.on_construct<component::RenderComponent>().connect<&RenderQueue::onRenderConstruct>(this);
+        registry_.on_destroy<component::RenderComponent>().connect<&RenderQueue::onRenderDestroy>(this);
+
+        // 收录构造之前就已经存在的实体
+        for (auto entity : registry_.view<component::RenderComponent>())
+        {
+            onRenderConstruct(registry_, entity);
+        }
+        spdlog::trace("RenderQueue 构造完成，已收录 {} 个实体", pending_inserts_);
+    }
+
+    RenderQueue::~RenderQueue()
+    {
+        registry_.on_construct<component::RenderComponent>().disconnect<&RenderQueue::onRenderConstruct>(this);
+        registry_.on_destroy<component::RenderComponent>().disconnect<&RenderQueue::onRenderDestroy>(this);
+    }
+
+    void RenderQueue::update()
+    {
+        stats_ = {};
+        stats_.inserted_ = pending_inserts_;
+        pending_inserts_ = 0;
+
+        removeDestroyed();
+        mergePendingStatic();
+        refreshDynamic();
+
+        stats_.static_count_ = static_entries_.size();
+        stats_.dynamic_count_ = dynamic_entries_.size();
+        spdlog::trace("RenderQueue: 静态 {}, 动态 {}, 变化 {}, 重排 {}, 新增 {}, 移除 {}",
+                      stats_.static_count_, stats_.dynamic_count_, stats_.changed_, stats_.resorted_, stats_.inserted_, stats_.removed_);
+    }
+
+    void RenderQueue::onRenderConstruct(entt::registry &registry, entt::entity entity)
+    {
+        const auto &render = registry.get<component::RenderComponent>(entity);
+        const Entry entry{entity, render.layer, render.depth, next_serial_++};
+        live_serials_[entity] = entry.serial_; // 同一实体之前的条目（若尚未移除）随之失效
+        if (registry.all_of<component::StaticRenderTag>(entity))
+        {
+            pending_static_.push_back(entry);
+        }
+        else
+        {
+            // 追加到动态桶末尾，下次 update() 时由插入排序放到正确的位置
+            dynamic_entries_.push_back(entry);
+        }
+        ++pending_inserts_;
+    }
+
+    void RenderQueue::onRenderDestroy(entt::registry &, entt::entity entity)
+    {
+        live_serials_.erase(entity);
+        ++pending_removals_;
+    }
+
+    void RenderQueue::removeDestroyed()
+    {
+        if (pending_removals_ == 0)
+            return;
+
+        // 条目的序号不是实体当前的有效序号即已失效：组件已移除，或移除后又重新添加（此时新条目已单独加入）。
+        // 仅检查组件是否存在是不够的，重新添加后旧条目会被保留，导致同一实体被绘制两次（std::erase_if 保持剩余条目的顺序）
+        auto is_destroyed = [this](const Entry &entry)
+        {
+            const auto it = live_serials_.find(entry.entity_);
+            return it == live_serials_.end() || it->second != entry.serial_;
+        };
+
+        std::size_t removed = std::erase_if(dynamic_entries_, is_destroyed);
+        // 绝大多数被销毁的是动态实体，只有数量对不上时才需要检查静态桶
+        if (removed < pending_removals_)
+        {
+            removed += std::erase_if(pending_static_, is_destroyed);
+            removed += std::erase_if(static_entries_, is_destroyed);
+        }
+        stats_.removed_ = removed;
+        pending_removals_ = 0;
+    }
+
+    void RenderQueue::mergePendingStatic()
+    {
+        if (pending_static_.empty())
+            return;
+
+        // 新条目排序后与已有的静态桶归并，静态实体只会在加入时排序这一次
+        std::stable_sort(pending_static_.begin(), pending_static_.end());
+        const auto middle = static_entries_.insert(static_entries_.end(), pending_static_.begin(), pending_static_.end());
+        std::inplace_merge(static_entries_.begin(), middle, static_entries_.end());
+        pending_static_.clear();
+    }
+
+    void RenderQueue::refreshDynamic()
+    {
+        // 1. 只更新图层或深度发生变化的条目的排序键
+        const auto &storage = registry_.storage<component::RenderComponent>();
+        for (auto &entry : dynamic_entries_)
+        {
+            const auto &render = storage.get(entry.entity_);
+            if (render.layer != entry.layer_ || render.depth != entry.depth_)
+            {
+                entry.layer_ = render.layer;
+                entry.depth_ = render.depth;
+                ++stats_.changed_;
+            }
+        }
+
+        // 2. 插入排序：帧间顺序几乎不变，此时只有少数条目需要移动，复杂度接近O(n)
+        for (std::size_t i = 1; i < dynamic_entries_.size(); ++i)
+        {
+            if (!(dynamic_entries_[i] < dynamic_entries_[i - 1]))
+                continue;
+            const Entry entry = dynamic_entries_[i];
+            std::size_t j = i;
+            do
+            {
+                dynamic_entries_[j] = dynamic_entries_[j - 1];
+                --j;
+            } while (j > 0 && entry < dynamic_entries_[j - 1]);
+            dynamic_entries_[j] = entry;
+            ++stats_.resorted_;
+        }
+    }
+
+} // namespace engine::render
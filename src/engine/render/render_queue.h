@@ -0,0 +1,125 @@
+#pragma once
+#include <entt/entity/registry.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::render
+{
+
+    /// @brief 渲染队列的统计信息（每次 update() 后更新）
+    struct RenderQueueStats
+    {
+        std::size_t static_count_{0};  ///< @brief 静态桶中的条目数量
+        std::size_t dynamic_count_{0}; ///< @brief 动态桶中的条目数量
+        std::size_t changed_{0};       ///< @brief 本帧图层或深度发生变化的条目数量
+        std::size_t resorted_{0};      ///< @brief 本帧需要移动位置（重新排序）的条目数量
+        std::size_t inserted_{0};      ///< @brief 本帧新加入的条目数量
+        std::size_t removed_{0};       ///< @brief 本帧移除的条目数量
+    };
+
+    /**
+     * @brief 渲染队列，持久地维护所有 RenderComponent 的绘制顺序（先按图层，再按深度）。
+     *
+     * 通过监听 RenderComponent 的构造与销毁信号增量地维护两个有序的桶：
+     * - 静态桶：拥有 StaticRenderTag 的实体（如瓦片、图片图层），加入时排序一次，之后不再检查和排序；
+     * - 动态桶：其余实体，每帧只刷新图层或深度发生变化的条目，然后用插入排序修正顺序。
+     *   由于相邻两帧之间顺序变化很小，插入排序的开销接近线性。
+     *
+     * 遍历时对两个桶做归并，得到完整的绘制顺序（键相同时静态实体先绘制）。
+     * 每个条目带有加入时的序号，同一实体在两次 update() 之间被移除并重新添加 RenderComponent 时
+     * （如对象池回收后立即复用），旧条目会因序号不一致而被移除，不会重复绘制。
+     * @note StaticRenderTag 需要在 RenderComponent 之前添加，否则实体会被放入动态桶。
+     */
+    class RenderQueue final
+    {
+    private:
+        /// @brief 队列中的条目，缓存排序键以避免排序时访问组件
+        struct Entry
+        {
+            entt::entity entity_{entt::null};
+            int layer_{0};
+            float depth_{0.0f};
+            std::uint32_t serial_{0}; ///< @brief 加入队列时的序号
+
+            bool operator<(const Entry &other) const
+            {
+                return layer_ == other.layer_ ? depth_ < other.depth_ : layer_ < other.layer_;
+            }
+        };
+
+        entt::registry &registry_;
+        std::vector<Entry> static_entries_;  ///< @brief 静态桶（始终有序）
+        std::vector<Entry> dynamic_entries_; ///< @brief 动态桶（update()之后有序）
+        std::vector<Entry> pending_static_;  ///< @brief 新加入但尚未合并到静态桶的条目
+        std::unordered_map<entt::entity, std::uint32_t> live_serials_; ///< @brief 拥有 RenderComponent 的实体 -> 其有效条目的序号
+        std::uint32_t next_serial_{0};       ///< @brief 下一个条目的序号
+        std::size_t pending_removals_{0};    ///< @brief 已销毁但尚未从桶中移除的条目数量
+        std::size_t pending_inserts_{0};     ///< @brief 自上次 update() 以来新加入的条目数量
+        RenderQueueStats stats_;             ///< @brief 最近一次 update() 的统计信息
+
+    public:
+        /**
+         * @brief 构造函数，连接 RenderComponent 的构造/销毁信号，并收录已经存在的实体
+         * @param registry entt::registry 的引用
+         */
+        explicit RenderQueue(entt::registry &registry);
+        ~RenderQueue();
+
+        /**
+         * @brief 同步队列：移除已销毁的条目，合并新的静态条目，刷新并重新排序动态桶
+         * @note 需要在遍历之前调用（通常每帧一次，在YSortSystem之后）
+         */
+        void update();
+
+        /**
+         * @brief 按绘制顺序遍历所有条目
+         * @param func 回调函数，签名为 void(entt::entity)
+         */
+        template <typename Func>
+        void each(Func &&func) const;
+
+        const RenderQueueStats &getStats() const { return stats_; } ///< @brief 获取最近一次 update() 的统计信息
+        std::size_t size() const { return static_entries_.size() + dynamic_entries_.size(); }
+
+        // 禁用拷贝和移动语义（信号连接持有this指针）
+        RenderQueue(const RenderQueue &) = delete;
+        RenderQueue &operator=(const RenderQueue &) = delete;
+        RenderQueue(RenderQueue &&) = delete;
+        RenderQueue &operator=(RenderQueue &&) = delete;
+
+    private:
+        void onRenderConstruct(entt::registry &registry, entt::entity entity); ///< @brief RenderComponent 构造时加入队列
+        void onRenderDestroy(entt::registry &registry, entt::entity entity);   ///< @brief RenderComponent 销毁时记录，下次 update() 时移除
+        void removeDestroyed();                                                ///< @brief 从两个桶中移除已失效的条目（保持顺序）
+        void mergePendingStatic();                                             ///< @brief 将新的静态条目排序后合并到静态桶
+        void refreshDynamic();                                                 ///< @brief 刷新动态桶的排序键，并用插入排序恢复顺序
+    };
+
+    template <typename Func>
+    void RenderQueue::each(Func &&func) const
+    {
+        // 两个有序桶的归并遍历
+        auto static_it = static_entries_.begin();
+        auto dynamic_it = dynamic_entries_.begin();
+        while (static_it != static_entries_.end() && dynamic_it != dynamic_entries_.end())
+        {
+            if (*dynamic_it < *static_it)
+            {
+                func(dynamic_it->entity_);
+                ++dynamic_it;
+            }
+            else
+            {
+                func(static_it->entity_);
+                ++static_it;
+            }
+        }
+        for (; static_it != static_entries_.end(); ++static_it)
+            func(static_it->entity_);
+        for (; dynamic_it != dynamic_entries_.end(); ++dynamic_it)
+            func(dynamic_it->entity_);
+    }
+
+} // namespace engine::render
@@ -2,8 +2,11 @@
 #include "../resource/resource_manager.h"
 #include "camera.h"
 #include "image.h"
+#include "../debug/log.h"
 #include <SDL3/SDL.h>
+#include <cmath>
 #include <stdexcept> // For std::runtime_error
+#include <utility>
 #include <spdlog/spdlog.h>
 #include <entt/core/hashed_string.hpp>
 
@@ -33,12 +36,28 @@ namespace engine::render
     void Renderer::drawSprite(const Camera &camera, const component::Sprite &sprite, const glm::vec2 &position,
                               const glm::vec2 &size, const float rotation, const engine::utils::FColor &color)
     {
-        auto texture = resource_manager_->getTexture(sprite.texture_id_, sprite.texture_path_);
+        // 通过句柄获取纹理区域（如果纹理被打包进图集，需要对源矩形进行偏移）
+        auto region = resource_manager_->getTextureRegion(sprite.texture_handle_);
+        if (!region.texture_)
+        { // 句柄未解析或已失效（纹理被卸载/替换），退回到按ID查找（不会从磁盘加载）
+            // 每帧都会绘制同一个精灵，因此每个纹理只警告一次，之后的回退只在调试级别记录
+            region = resource_manager_->getTextureRegion(sprite.texture_id_);
+            if (warned_textures_.insert(sprite.texture_id_).second)
+            {
+                if (region.texture_)
+                    spdlog::warn("精灵的纹理句柄无效 (ID: {}, 槽位: {}, 代数: {})，退回到按ID查找（同一纹理不再重复警告）。",
+                                 sprite.texture_id_, sprite.texture_handle_.index_, sprite.texture_handle_.generation_);
+                else
+                    spdlog::error("无法为 ID {} 获取纹理（同一纹理不再重复报告）。", sprite.texture_id_);
+            }
+            else
+            {
+                ENGINE_LOG_DEBUG("精灵的纹理句柄无效 (ID: {})，按ID查找{}。", sprite.texture_id_, region.texture_ ? "" : "失败");
+            }
+        }
+        auto texture = region.texture_;
         if (!texture)
-        {
-            spdlog::error("无法为 ID {} 获取纹理。", sprite.texture_id_);
             return;
-        }
 
         // 应用相机变换
         glm::vec2 screen_position = camera.worldToScreen(position);
@@ -53,20 +72,35 @@ namespace engine::render
         if (!isRectInViewport(camera, dest_rect))
         { // 视口裁剪：如果精灵超出视口，则不绘制
             // spdlog::info("精灵超出视口范围，ID: {}", sprite.getTextureId());
+            ++stats_.culled_sprites_;
             return;
         }
 
         SDL_FRect src_rect = {
-            sprite.src_rect_.position.x,
-            sprite.src_rect_.position.y,
+            sprite.src_rect_.position.x + region.offset_.x,
+            sprite.src_rect_.position.y + region.offset_.y,
             sprite.src_rect_.size.x,
             sprite.src_rect_.size.y};
 
+        ++stats_.sprites_;
+
+        // 批处理：纹理相同则追加到当前批次，否则先提交之前的批次
+        if (batching_enabled_)
+        {
+            if (texture != batch_texture_)
+            {
+                beginBatch(texture);
+            }
+            appendQuad(src_rect, dest_rect, rotation, sprite.is_flipped_, color);
+            return;
+        }
+
         // 设置调整颜色与透明度
         SDL_SetTextureColorModFloat(texture, color.r, color.g, color.b);
         SDL_SetTextureAlphaModFloat(texture, color.a);
 
         // 执行绘制(默认旋转中心为精灵的中心点)
+        ++stats_.draw_calls_;
         if (!SDL_RenderTextureRotated(renderer_, texture, &src_rect, &dest_rect, rotation, NULL, sprite.is_flipped_ ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE))
         {
             spdlog::error("渲染旋转纹理失败（ID: {}）：{}", sprite.texture_id_, SDL_GetError());
@@ -76,19 +110,28 @@ namespace engine::render
     void Renderer::drawFilledCircle(const Camera &camera, const glm::vec2 &position, const float radius, const engine::utils::FColor &color)
     {
         // 获取引擎自带的圆形纹理
-        auto circle_texture = resource_manager_->getTexture("assets/textures/UI/circle.png"_hs);
+        auto circle_region = resource_manager_->getTextureRegion(circle_texture_handle_);
+        if (!circle_region.texture_)
+        { // 首次使用（或句柄失效）时解析句柄
+            circle_texture_handle_ = resource_manager_->resolveTexture("assets/textures/UI/circle.png"_hs, "assets/textures/UI/circle.png");
+            circle_region = resource_manager_->getTextureRegion(circle_texture_handle_);
+        }
+        auto circle_texture = circle_region.texture_;
         if (!circle_texture)
         {
             spdlog::error("无法获取引擎自带的圆形纹理。");
             return;
         }
+        flush();
         auto screen_position = camera.worldToScreen(position);
         // 设置颜色和透明度
         SDL_SetTextureColorModFloat(circle_texture, color.r, color.g, color.b);
         SDL_SetTextureAlphaModFloat(circle_texture, color.a);
         // 绘制
+        SDL_FRect src_rect = {circle_region.offset_.x, circle_region.offset_.y, circle_region.size_.x, circle_region.size_.y};
         SDL_FRect dest_rect = {screen_position.x - radius, screen_position.y - radius, radius * 2, radius * 2};
-        if (!SDL_RenderTextureRotated(renderer_, circle_texture, nullptr, &dest_rect, 0.0, nullptr, SDL_FLIP_NONE))
+        ++stats_.draw_calls_;
+        if (!SDL_RenderTextureRotated(renderer_, circle_texture, &src_rect, &dest_rect, 0.0, nullptr, SDL_FLIP_NONE))
         {
             spdlog::error("绘制填充圆形失败：{}", SDL_GetError());
         }
@@ -96,12 +139,14 @@ namespace engine::render
 
     void Renderer::drawFilledRect(const Camera &camera, const glm::vec2 &position, const glm::vec2 &size, const engine::utils::FColor &color)
     {
+        flush();
         // 应用相机变换
         auto screen_position = camera.worldToScreen(position);
         // 创建目标矩形
         SDL_FRect dest_rect = {screen_position.x, screen_position.y, size.x, size.y};
         // 设置颜色并绘制
         setDrawColorFloat(color.r, color.g, color.b, color.a);
+        ++stats_.draw_calls_;
         if (!SDL_RenderFillRect(renderer_, &dest_rect))
         {
             spdlog::error("绘制填充矩形失败：{}", SDL_GetError());
@@ -112,6 +157,7 @@ namespace engine::render
 
     void Renderer::drawRect(const Camera &camera, const glm::vec2 &position, const glm::vec2 &size, const engine::utils::FColor &color, const int thickness)
     {
+        flush();
         // 应用相机变换
         auto screen_position = camera.worldToScreen(position);
         // 创建目标矩形
@@ -120,6 +166,7 @@ namespace engine::render
         setDrawColorFloat(color.r, color.g, color.b, color.a);
         for (int i = 0; i < thickness; i++)
         {
+            ++stats_.draw_calls_;
             if (!SDL_RenderRect(renderer_, &dest_rect))
             {
                 spdlog::error("绘制矩形边框失败：{}", SDL_GetError());
@@ -135,19 +182,32 @@ namespace engine::render
 
     void Renderer::drawUIImage(const Image &image, const glm::vec2 &position, const std::optional<glm::vec2> &size)
     {
-        auto texture = resource_manager_->getTexture(image.getTextureId(), image.getTexturePath());
+        flush();
+        // 优先使用缓存的句柄；首次绘制（或句柄失效）时解析一次并缓存
+        auto region = resource_manager_->getTextureRegion(image.getTextureHandle());
+        if (!region.texture_)
+        {
+            image.cacheTextureHandle(resource_manager_->resolveTexture(image.getTextureId(), image.getTexturePath()));
+            region = resource_manager_->getTextureRegion(image.getTextureHandle());
+        }
+        auto texture = region.texture_;
         if (!texture)
         {
             spdlog::error("无法为 ID {} 获取纹理。", image.getTextureId());
             return;
         }
 
-        auto src_rect = getImageSrcRect(image);
+        auto src_rect = getImageSrcRect(image, region);
         if (!src_rect.has_value())
         {
             spdlog::error("无法获取精灵的源矩形，ID: {}", image.getTextureId());
             return;
         }
+        // 图集中的图片需要偏移源矩形；图集页被多张图片共享，绘制前需要重置调整颜色
+        src_rect->x += region.offset_.x;
+        src_rect->y += region.offset_.y;
+        SDL_SetTextureColorModFloat(texture, 1.0f, 1.0f, 1.0f);
+        SDL_SetTextureAlphaModFloat(texture, 1.0f);
 
         SDL_FRect dest_rect = {position.x, position.y, 0, 0}; // 首先确定目标矩形的左上角坐标
         if (size.has_value())
@@ -162,6 +222,7 @@ namespace engine::render
         }
 
         // 执行绘制(未考虑UI旋转)
+        ++stats_.draw_calls_;
         if (!SDL_RenderTextureRotated(renderer_, texture, &src_rect.value(), &dest_rect, 0.0, nullptr, image.isFlipped() ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE))
         {
             spdlog::error("渲染 UI Sprite 失败 (ID: {}): {}", image.getTextureId(), SDL_GetError());
@@ -195,8 +256,10 @@ namespace engine::render
 
     void Renderer::drawUIFilledRect(const engine::utils::Rect &rect, const engine::utils::FColor &color)
     {
+        flush();
         setDrawColorFloat(color.r, color.g, color.b, color.a);
         SDL_FRect sdl_rect = {rect.position.x, rect.position.y, rect.size.x, rect.size.y};
+        ++stats_.draw_calls_;
         if (!SDL_RenderFillRect(renderer_, &sdl_rect))
         {
             spdlog::error("绘制填充矩形失败：{}", SDL_GetError());
@@ -206,18 +269,103 @@ namespace engine::render
 
     void Renderer::present()
     {
+        flush();
         SDL_RenderPresent(renderer_);
+        // 保存本帧统计数据，并为下一帧重置
+        last_frame_stats_ = stats_;
+        stats_ = RenderStats{};
+        spdlog::trace("渲染统计: 绘制调用 {}, 批次 {}, 精灵 {}, 裁剪 {}", last_frame_stats_.draw_calls_, last_frame_stats_.batches_,
+                      last_frame_stats_.sprites_, last_frame_stats_.culled_sprites_);
     }
 
-    std::optional<SDL_FRect> Renderer::getImageSrcRect(const Image &image)
+    void Renderer::flush()
     {
-        SDL_Texture *texture = resource_manager_->getTexture(image.getTextureId());
-        if (!texture)
+        if (!batch_texture_ || batch_indices_.empty())
         {
-            spdlog::error("无法为 ID {} 获取纹理。", image.getTextureId());
-            return std::nullopt;
+            batch_texture_ = nullptr;
+            return;
+        }
+        // 颜色已经写入顶点，因此纹理自身的调整颜色需要恢复为白色（可能被其它绘制函数修改过）
+        SDL_SetTextureColorModFloat(batch_texture_, 1.0f, 1.0f, 1.0f);
+        SDL_SetTextureAlphaModFloat(batch_texture_, 1.0f);
+        ++stats_.draw_calls_;
+        ++stats_.batches_;
+        if (!SDL_RenderGeometry(renderer_, batch_texture_,
+                                batch_vertices_.data(), static_cast<int>(batch_vertices_.size()),
+                                batch_indices_.data(), static_cast<int>(batch_indices_.size())))
+        {
+            spdlog::error("提交精灵批次失败：{}", SDL_GetError());
         }
+        batch_vertices_.clear();
+        batch_indices_.clear();
+        batch_texture_ = nullptr; // 纹理可能在两帧之间被卸载，不跨越提交保留
+    }
+
+    void Renderer::setBatchingEnabled(bool enabled)
+    {
+        flush();
+        batching_enabled_ = enabled;
+        spdlog::info("精灵批处理: {}", enabled ? "启用" : "禁用");
+    }
 
+    void Renderer::beginBatch(SDL_Texture *texture)
+    {
+        flush();
+        batch_texture_ = texture;
+        float width = 0.0f;
+        float height = 0.0f;
+        if (!SDL_GetTextureSize(texture, &width, &height) || width <= 0.0f || height <= 0.0f)
+        {
+            spdlog::error("无法获取纹理尺寸：{}", SDL_GetError());
+            width = height = 1.0f;
+        }
+        batch_inv_texture_size_ = {1.0f / width, 1.0f / height};
+    }
+
+    void Renderer::appendQuad(const SDL_FRect &src_rect, const SDL_FRect &dest_rect, float rotation, bool is_flipped, const engine::utils::FColor &color)
+    {
+        // 纹理坐标（水平翻转时交换左右两侧）
+        float u0 = src_rect.x * batch_inv_texture_size_.x;
+        float u1 = (src_rect.x + src_rect.w) * batch_inv_texture_size_.x;
+        const float v0 = src_rect.y * batch_inv_texture_size_.y;
+        const float v1 = (src_rect.y + src_rect.h) * batch_inv_texture_size_.y;
+        if (is_flipped)
+        {
+            std::swap(u0, u1);
+        }
+
+        // 以精灵中心为旋转中心，计算四个角的屏幕坐标（与 SDL_RenderTextureRotated 一致，角度为顺时针）
+        const float half_w = dest_rect.w * 0.5f;
+        const float half_h = dest_rect.h * 0.5f;
+        const float center_x = dest_rect.x + half_w;
+        const float center_y = dest_rect.y + half_h;
+        float cos_r = 1.0f;
+        float sin_r = 0.0f;
+        if (rotation != 0.0f)
+        {
+            const float radians = rotation * (SDL_PI_F / 180.0f);
+            cos_r = std::cos(radians);
+            sin_r = std::sin(radians);
+        }
+        const SDL_FColor vertex_color = {color.r, color.g, color.b, color.a};
+        auto corner = [&](float local_x, float local_y, float u, float v)
+        {
+            return SDL_Vertex{
+                {center_x + local_x * cos_r - local_y * sin_r, center_y + local_x * sin_r + local_y * cos_r},
+                vertex_color,
+                {u, v}};
+        };
+
+        const int base = static_cast<int>(batch_vertices_.size());
+        batch_vertices_.push_back(corner(-half_w, -half_h, u0, v0)); // 左上
+        batch_vertices_.push_back(corner(half_w, -half_h, u1, v0));  // 右上
+        batch_vertices_.push_back(corner(half_w, half_h, u1, v1));   // 右下
+        batch_vertices_.push_back(corner(-half_w, half_h, u0, v1));  // 左下
+        batch_indices_.insert(batch_indices_.end(), {base, base + 1, base + 2, base + 2, base + 3, base});
+    }
+
+    std::optional<SDL_FRect> Renderer::getImageSrcRect(const Image &image, const engine::resource::TextureRegion &region)
+    {
         auto src_rect = image.getSourceRect();
         if (src_rect.has_value())
         { // 如果Image中存在指定rect，则判断尺寸是否有效
@@ -233,14 +381,14 @@ namespace engine::render
                 src_rect.value().size.y};
         }
         else
-        { // 否则获取纹理尺寸并返回整个纹理大小
-            SDL_FRect result = {0, 0, 0, 0};
-            if (!SDL_GetTextureSize(texture, &result.w, &result.h))
+        { // 否则返回整个纹理（对于图集中的图片，则是其原始尺寸）大小
+            const auto &size = region.size_;
+            if (size.x <= 0 || size.y <= 0)
             {
                 spdlog::error("无法获取纹理尺寸，ID: {}, path: {}", image.getTextureId(), image.getTexturePath());
                 return std::nullopt;
             }
-            return result;
+            return SDL_FRect{0, 0, size.x, size.y};
         }
     }
 
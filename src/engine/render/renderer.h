@@ -2,10 +2,12 @@
 #include "image.h"
 #include "../component/sprite_component.h"
 #include "../utils/math.h"
+#include "../resource/texture_handle.h"
+#include "../resource/texture_region.h"
+#include <SDL3/SDL_render.h>
 #include <optional>
-
-struct SDL_Renderer;
-struct SDL_FRect;
+#include <unordered_set>
+#include <vector>
 
 namespace engine::resource
 {
@@ -16,6 +18,17 @@ namespace engine::render
 {
     class Camera;
 
+    /**
+     * @brief 渲染统计数据（每帧）
+     */
+    struct RenderStats
+    {
+        int draw_calls_{0};     ///< @brief 向SDL提交的绘制调用次数（含批次与非批次绘制）
+        int batches_{0};        ///< @brief 精灵批次数量（每个批次对应一次 SDL_RenderGeometry）
+        int sprites_{0};        ///< @brief 实际绘制的精灵数量
+        int culled_sprites_{0}; ///< @brief 被视口裁剪掉的精灵数量
+    };
+
     /**
      * @brief 封装 SDL3 渲染操作
      *
@@ -30,6 +43,18 @@ namespace engine::render
         engine::resource::ResourceManager *resource_manager_ = nullptr; ///< @brief 指向 ResourceManager 的非拥有指针
 
         engine::utils::FColor background_color_{0.0f, 0.0f, 0.0f, 1.0f}; ///< @brief 清除屏幕的颜色（默认黑色），可调用setBgColorFloat设置
+        engine::resource::TextureHandle circle_texture_handle_{};          ///< @brief 引擎自带圆形纹理的句柄（首次使用时解析）
+
+        // --- 精灵批处理 ---
+        bool batching_enabled_ = true;              ///< @brief 是否启用精灵批处理
+        SDL_Texture *batch_texture_ = nullptr;      ///< @brief 当前批次使用的纹理
+        glm::vec2 batch_inv_texture_size_{};        ///< @brief 当前批次纹理尺寸的倒数（用于计算纹理坐标）
+        std::vector<SDL_Vertex> batch_vertices_;    ///< @brief 当前批次的顶点
+        std::vector<int> batch_indices_;            ///< @brief 当前批次的索引
+
+        RenderStats stats_;                         ///< @brief 当前帧的渲染统计
+        RenderStats last_frame_stats_;              ///< @brief 上一帧的渲染统计
+        std::unordered_set<entt::id_type> warned_textures_; ///< @brief 已报告过句柄无效/纹理缺失的纹理ID（每个只报告一次，避免每帧刷屏）
 
     public:
         /**
@@ -43,6 +68,8 @@ namespace engine::render
 
         /**
          * @brief 绘制一个精灵
+         * @note 启用批处理时，连续使用同一纹理的精灵会合并为一次 SDL_RenderGeometry 调用，
+         *       纹理切换或调用其他绘制函数时才会提交，因此绘制顺序保持不变。
          *
          * @param camera 游戏相机，用于坐标转换。
          * @param sprite 包含纹理ID、源矩形和翻转状态的 Sprite 对象。
@@ -102,6 +129,11 @@ namespace engine::render
 
         void present();     ///< @brief 更新屏幕，包装 SDL_RenderPresent 函数
         void clearScreen(); ///< @brief 清屏，包装 SDL_RenderClear 函数
+        void flush();       ///< @brief 提交当前批次中尚未绘制的精灵（直接使用SDL_Renderer绘制前需要调用）
+
+        void setBatchingEnabled(bool enabled);                                           ///< @brief 设置是否启用精灵批处理
+        [[nodiscard]] bool isBatchingEnabled() const { return batching_enabled_; }       ///< @brief 是否启用精灵批处理
+        [[nodiscard]] const RenderStats &getLastFrameStats() const { return last_frame_stats_; } ///< @brief 获取上一帧的渲染统计
 
         void setDrawColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a = 255);       ///< @brief 设置绘制颜色，包装 SDL_SetRenderDrawColor 函数，使用 Uint8 类型
         void setDrawColorFloat(float r, float g, float b, float a = 1.0f); ///< @brief 设置绘制颜色，包装 SDL_SetRenderDrawColorFloat 函数，使用 float 类型
@@ -117,8 +149,11 @@ namespace engine::render
         Renderer &operator=(Renderer &&) = delete;
 
     private:
-        std::optional<SDL_FRect> getImageSrcRect(const Image &image);       ///< @brief 获取Image的源矩形，用于具体绘制。出现错误则返回std::nullopt并跳过绘制
+        /// @brief 获取Image的源矩形（未加上图集偏移），用于具体绘制。出现错误则返回std::nullopt并跳过绘制
+        std::optional<SDL_FRect> getImageSrcRect(const Image &image, const engine::resource::TextureRegion &region);
         bool isRectInViewport(const Camera &camera, const SDL_FRect &rect); ///< @brief 判断矩形是否在视口中，用于视口裁剪
+        void beginBatch(SDL_Texture *texture);                              ///< @brief 开始一个新批次（会先提交之前的批次）
+        void appendQuad(const SDL_FRect &src_rect, const SDL_FRect &dest_rect, float rotation, bool is_flipped, const engine::utils::FColor &color); ///< @brief 向当前批次添加一个四边形
     };
 
 } // namespace engine::render
\ No newline at end of file
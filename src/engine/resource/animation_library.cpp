@@ -0,0 +1,65 @@
+#include "animation_library.h"
+#include <spdlog/spdlog.h>
+
+namespace engine::resource {
+
+entt::id_type AnimationLibrary::combineKey(entt::id_type a, entt::id_type b) {
+    // 参考 boost::hash_combine
+    return a ^ (b + 0x9e3779b9u + (a << 6) + (a >> 2));
+}
+
+AnimationSetId AnimationLibrary::findSet(entt::id_type key) const {
+    auto it = set_lookup_.find(key);
+    return it != set_lookup_.end() ? it->second : INVALID_ANIMATION_ID;
+}
+
+AnimationSetId AnimationLibrary::createSet(entt::id_type key) {
+    auto [it, inserted] = set_lookup_.try_emplace(key, static_cast<AnimationSetId>(sets_.size()));
+    if (inserted) {
+        sets_.emplace_back();
+    }
+    return it->second;
+}
+
+AnimationClipId AnimationLibrary::addClip(AnimationSetId set, entt::id_type animation_id, engine::component::Animation clip) {
+    if (set >= sets_.size()) {
+        spdlog::error("AnimationLibrary: 无效的动画集合索引 {}", set);
+        return INVALID_ANIMATION_ID;
+    }
+    if (auto existing = findClip(set, animation_id); existing != INVALID_ANIMATION_ID) {
+        return existing;
+    }
+    auto clip_id = static_cast<AnimationClipId>(clips_.size());
+    clips_.push_back(std::move(clip));
+    sets_[set].clips_.emplace_back(animation_id, clip_id);
+    return clip_id;
+}
+
+AnimationClipId AnimationLibrary::findClip(AnimationSetId set, entt::id_type animation_id) const {
+    if (set >= sets_.size()) {
+        return INVALID_ANIMATION_ID;
+    }
+    for (const auto& [id, clip] : sets_[set].clips_) {
+        if (id == animation_id) {
+            return clip;
+        }
+    }
+    return INVALID_ANIMATION_ID;
+}
+
+std::size_t AnimationLibrary::getMemoryUsage() const {
+    std::size_t bytes = clips_.capacity() * sizeof(engine::component::Animation) +
+                        sets_.capacity() * sizeof(AnimationSet);
+    for (const auto& clip : clips_) {
+        bytes += clip.frames_.capacity() * sizeof(engine::component::AnimationFrame);
+        // 事件 map 按节点（指针 + 键值对）与桶数组粗略估算
+        bytes += clip.events_.size() * (sizeof(void*) + sizeof(std::pair<const int, entt::id_type>)) +
+                 clip.events_.bucket_count() * sizeof(void*);
+    }
+    for (const auto& set : sets_) {
+        bytes += set.clips_.capacity() * sizeof(std::pair<entt::id_type, AnimationClipId>);
+    }
+    return bytes;
+}
+
+} // namespace engine::resource
@@ -0,0 +1,80 @@
+#pragma once
+#include "../component/animation_component.h"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <entt/core/fwd.hpp>
+
+namespace engine::resource {
+
+using AnimationSetId = std::uint32_t;   ///< @brief 动画集合在 AnimationLibrary 中的索引
+using AnimationClipId = std::uint32_t;  ///< @brief 动画片段在 AnimationLibrary 中的索引
+inline constexpr std::uint32_t INVALID_ANIMATION_ID = std::numeric_limits<std::uint32_t>::max();
+
+/**
+ * @brief 动画库：所有动画片段（帧列表、事件、默认循环方式）只存储一份，实体通过索引引用。
+ *
+ * 片段按“动画集合”组织，一个集合对应一类实体（如某个职业/敌人类型、某个动画图块），
+ * 集合内用动画ID（"idle"_hs、"walk"_hs……）查找片段。同类实体共享同一个集合，
+ * AnimationComponent 中只保存集合与当前片段的索引，不再各自拷贝一份动画 map。
+ *
+ * 集合与片段在加载阶段（创建实体工厂、加载关卡）登记，之后只读，系统可以并行读取；
+ * 集合以键（通常是类型ID与种类组合的哈希）去重，重复加载同一关卡不会重复登记。
+ * 已登记的内容在程序运行期间一直有效（索引不会失效）。
+ */
+class AnimationLibrary final {
+private:
+    /// @brief 动画集合：动画ID -> 片段索引（每类实体只有少量动画，线性查找即可）
+    struct AnimationSet {
+        std::vector<std::pair<entt::id_type, AnimationClipId>> clips_;
+    };
+
+    std::vector<engine::component::Animation> clips_;               ///< @brief 所有动画片段
+    std::vector<AnimationSet> sets_;                                ///< @brief 所有动画集合
+    std::unordered_map<entt::id_type, AnimationSetId> set_lookup_;  ///< @brief 集合键 -> 集合索引
+
+public:
+    AnimationLibrary() = default;
+
+    AnimationLibrary(const AnimationLibrary&) = delete;
+    AnimationLibrary& operator=(const AnimationLibrary&) = delete;
+    AnimationLibrary(AnimationLibrary&&) = delete;
+    AnimationLibrary& operator=(AnimationLibrary&&) = delete;
+
+    /// @brief 组合两个ID生成集合键（例如 类型ID + "enemy"_hs）
+    [[nodiscard]] static entt::id_type combineKey(entt::id_type a, entt::id_type b);
+
+    /// @brief 查找集合，不存在时返回 INVALID_ANIMATION_ID
+    [[nodiscard]] AnimationSetId findSet(entt::id_type key) const;
+
+    /**
+     * @brief 创建集合
+     * @param key 集合键
+     * @return 新集合的索引；键已存在时返回已有集合（不会清空其中的片段）
+     */
+    AnimationSetId createSet(entt::id_type key);
+
+    /**
+     * @brief 向集合中添加动画片段
+     * @param set 集合索引
+     * @param animation_id 动画ID
+     * @param clip 动画片段
+     * @return 片段索引；集合中已有同ID的片段时不添加，返回已有片段
+     */
+    AnimationClipId addClip(AnimationSetId set, entt::id_type animation_id, engine::component::Animation clip);
+
+    /// @brief 在集合中查找动画片段，不存在时返回 INVALID_ANIMATION_ID
+    [[nodiscard]] AnimationClipId findClip(AnimationSetId set, entt::id_type animation_id) const;
+
+    /// @brief 通过索引获取动画片段（索引必须有效）
+    [[nodiscard]] const engine::component::Animation& getClip(AnimationClipId clip) const { return clips_[clip]; }
+
+    [[nodiscard]] std::size_t getSetCount() const { return sets_.size(); }    ///< @brief 集合数量
+    [[nodiscard]] std::size_t getClipCount() const { return clips_.size(); }  ///< @brief 片段数量
+    [[nodiscard]] std::size_t getMemoryUsage() const;                         ///< @brief 估算动画数据占用的内存（字节）
+};
+
+} // namespace engine::resource
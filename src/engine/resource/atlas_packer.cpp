@@ -0,0 +1,67 @@
+#include "atlas_packer.h"
+#include <glm/common.hpp>
+#include <algorithm>
+#include <numeric>
+
+namespace engine::resource {
+
+AtlasPacker::AtlasPacker(int page_size, int padding)
+    : page_size_(std::max(page_size, 1)), padding_(std::max(padding, 0)) {}
+
+std::vector<AtlasPacker::Placement> AtlasPacker::pack(const std::vector<glm::ivec2>& sizes) {
+    std::vector<Placement> placements(sizes.size());
+
+    // 按高度（其次宽度）从大到小排序，货架算法在这种顺序下浪费最少
+    std::vector<std::size_t> order(sizes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&sizes](std::size_t a, std::size_t b) {
+        return sizes[a].y != sizes[b].y ? sizes[a].y > sizes[b].y : sizes[a].x > sizes[b].x;
+    });
+
+    for (auto index : order) {
+        const auto& size = sizes[index];
+        const glm::ivec2 padded_size = size + glm::ivec2(padding_);
+        // 超过页面尺寸的矩形无法放入图集
+        if (size.x <= 0 || size.y <= 0 || padded_size.x > page_size_ || padded_size.y > page_size_) {
+            continue;
+        }
+
+        glm::ivec2 position{0};
+        std::size_t page_index = 0;
+        while (page_index < pages_.size() && !tryPlace(pages_[page_index], padded_size, position)) {
+            ++page_index;
+        }
+        if (page_index == pages_.size()) {
+            pages_.emplace_back();
+            tryPlace(pages_.back(), padded_size, position);    // 空页一定能放下
+        }
+
+        auto& info = pages_[page_index].info_;
+        info.used_size_ = glm::max(info.used_size_, position + size);
+        info.used_area_ += static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y);
+        ++info.rect_count_;
+        placements[index] = Placement{static_cast<int>(page_index), position};
+    }
+    return placements;
+}
+
+bool AtlasPacker::tryPlace(Page& page, const glm::ivec2& padded_size, glm::ivec2& position) {
+    // 1. 先尝试已有的货架
+    for (auto& shelf : page.shelves_) {
+        if (padded_size.y <= shelf.height_ && shelf.cursor_x_ + padded_size.x <= page_size_) {
+            position = {shelf.cursor_x_, shelf.y_};
+            shelf.cursor_x_ += padded_size.x;
+            return true;
+        }
+    }
+    // 2. 在页面底部开辟新货架
+    const int next_y = page.shelves_.empty() ? 0 : page.shelves_.back().y_ + page.shelves_.back().height_;
+    if (next_y + padded_size.y > page_size_) {
+        return false;
+    }
+    page.shelves_.push_back(Shelf{next_y, padded_size.y, padded_size.x});
+    position = {0, next_y};
+    return true;
+}
+
+} // namespace engine::resource
@@ -0,0 +1,70 @@
+#pragma once
+#include <glm/vec2.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace engine::resource {
+
+/**
+ * @brief 图集装箱器，使用“货架”(shelf)算法把若干矩形排列到固定尺寸的图集页中。
+ *
+ * 矩形按高度从大到小依次放置：每一页由若干水平“货架”组成，矩形放在第一个高度足够且剩余宽度足够的货架上，
+ * 放不下时在当前页开辟新货架，当前页也放不下时开辟新页。
+ * 它只负责计算位置，不涉及任何SDL资源，纹理的复制由 TextureManager 完成。
+ */
+class AtlasPacker final {
+public:
+    /// @brief 单个矩形的放置结果
+    struct Placement {
+        int page_{-1};          ///< @brief 所在图集页序号，-1 表示矩形超过了页面尺寸，无法放入
+        glm::ivec2 position_{}; ///< @brief 在图集页中的左上角坐标(不含间距)
+    };
+
+    /// @brief 图集页的使用情况
+    struct PageInfo {
+        glm::ivec2 used_size_{0};   ///< @brief 实际用到的尺寸(包围所有货架)
+        std::size_t used_area_{0};  ///< @brief 所有矩形(不含间距)的面积之和
+        std::size_t rect_count_{0}; ///< @brief 矩形数量
+    };
+
+private:
+    /// @brief 货架：高度固定的一行
+    struct Shelf {
+        int y_{0};
+        int height_{0};
+        int cursor_x_{0};
+    };
+
+    struct Page {
+        std::vector<Shelf> shelves_;
+        PageInfo info_;
+    };
+
+    int page_size_;             ///< @brief 图集页边长
+    int padding_;               ///< @brief 矩形之间的间距（防止采样时颜色渗入相邻纹理）
+    std::vector<Page> pages_;   ///< @brief 已开辟的图集页
+
+public:
+    /**
+     * @brief 构造函数
+     * @param page_size 图集页边长(像素)
+     * @param padding 矩形之间的间距(像素)
+     */
+    AtlasPacker(int page_size, int padding);
+
+    /**
+     * @brief 装箱一组矩形
+     * @param sizes 各矩形尺寸
+     * @return 与 sizes 一一对应的放置结果
+     */
+    std::vector<Placement> pack(const std::vector<glm::ivec2>& sizes);
+
+    std::size_t getPageCount() const { return pages_.size(); }
+    const PageInfo& getPageInfo(std::size_t page) const { return pages_[page].info_; }
+    int getPageSize() const { return page_size_; }
+
+private:
+    bool tryPlace(Page& page, const glm::ivec2& padded_size, glm::ivec2& position);   ///< @brief 尝试在某一页中放置矩形
+};
+
+} // namespace engine::resource
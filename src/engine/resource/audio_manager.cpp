@@ -1,4 +1,5 @@
 #include "audio_manager.h"
+#include "../debug/profiler.h"
 #include <SDL3_mixer/SDL_mixer.h>
 #include <spdlog/spdlog.h>
 #include <stdexcept>
@@ -50,6 +51,7 @@ Mix_Chunk* AudioManager::loadSound(entt::id_type id, std::string_view file_path)
 
     // 加载音效块
     spdlog::debug("加载音效: {}", id);
+    ENGINE_PROFILE_SCOPE_DETAIL("AudioManager::loadSound", file_path);
     Mix_Chunk* raw_chunk = Mix_LoadWAV(file_path.data());
     if (!raw_chunk) {
         spdlog::error("加载音效失败: '{}': {}", id, SDL_GetError());
@@ -112,6 +114,7 @@ Mix_Music* AudioManager::loadMusic(entt::id_type id, std::string_view file_path)
 
     // 加载音乐
     spdlog::debug("加载音乐: {}", id);
+    ENGINE_PROFILE_SCOPE_DETAIL("AudioManager::loadMusic", file_path);
     Mix_Music* raw_music = Mix_LoadMUS(file_path.data());
     if (!raw_music) {
         spdlog::error("加载音乐失败: '{}': {}", id, SDL_GetError());
@@ -1,4 +1,5 @@
 #include "font_manager.h"
+#include "../debug/profiler.h"
 #include <spdlog/spdlog.h>
 #include <stdexcept>
 #include <entt/core/hashed_string.hpp>
@@ -39,6 +40,7 @@ TTF_Font* FontManager::loadFont(entt::id_type id, int point_size, std::string_vi
 
     // 缓存中不存在，则判断是否提供了
     spdlog::debug("正在加载字体：{} ({}pt)", id, point_size);
+    ENGINE_PROFILE_SCOPE_DETAIL("FontManager::loadFont", file_path);
     TTF_Font* raw_font = TTF_OpenFont(file_path.data(), point_size);
     if (!raw_font) {
         spdlog::error("加载字体 '{}' ({}pt) 失败：{}", id, point_size, SDL_GetError());
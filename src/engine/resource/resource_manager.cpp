@@ -2,8 +2,14 @@
 #include "texture_manager.h"
 #include "audio_manager.h"
 #include "font_manager.h" 
+#include "animation_library.h"
+#include "../debug/profiler.h"
 #include <fstream>
 #include <filesystem>
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
 #include <SDL3_mixer/SDL_mixer.h>
 #include <SDL3_ttf/SDL_ttf.h> 
 #include <glm/glm.hpp>
@@ -20,6 +26,7 @@ ResourceManager::ResourceManager(SDL_Renderer* renderer) {
     texture_manager_ = std::make_unique<TextureManager>(renderer);
     audio_manager_ = std::make_unique<AudioManager>();
     font_manager_ = std::make_unique<FontManager>();
+    animation_library_ = std::make_unique<AnimationLibrary>();
 
     spdlog::trace("ResourceManager 构造成功。");
     // RAII: 构造成功即代表资源管理器可以正常工作，无需再初始化，无需检查指针是否为空
@@ -33,6 +40,7 @@ void ResourceManager::clear() {
 }
 
 void ResourceManager::loadResources(std::string_view file_path) {
+    ENGINE_PROFILE_SCOPE_DETAIL("ResourceManager::loadResources", file_path);
     std::filesystem::path path(file_path);
     if (!std::filesystem::exists(path)) {
         spdlog::warn("资源映射文件不存在: {}", file_path);
@@ -42,6 +50,10 @@ void ResourceManager::loadResources(std::string_view file_path) {
     nlohmann::json json;
     file >> json;
     try {
+        // 图集需要最先构建，这样之后按id加载的纹理会直接指向图集页
+        if (json.contains("atlas")) {
+            buildAtlas(json["atlas"]);
+        }
         if (json.contains("sound")) {
             for (const auto& [key, value] : json["sound"].items()) {
                 loadSound(entt::hashed_string(key.c_str()), value.get<std::string>());
@@ -67,6 +79,43 @@ void ResourceManager::loadResources(std::string_view file_path) {
     }
 }
 
+void ResourceManager::buildAtlas(const nlohmann::json& atlas_json) {
+    const int page_size = atlas_json.value("page_size", 2048);
+    const int padding = atlas_json.value("padding", 2);
+
+    // 收集所有需要打包的图片：指定目录(递归)下的png + 单独列出的图片。id为文件路径的哈希值，与其它地方的用法一致
+    std::vector<std::pair<entt::id_type, std::string>> textures;
+    auto add_texture = [&textures](std::string path) {
+        entt::id_type id = entt::hashed_string(path.c_str());
+        textures.emplace_back(id, std::move(path));
+    };
+    if (atlas_json.contains("directories")) {
+        for (const auto& directory : atlas_json["directories"]) {
+            std::filesystem::path dir_path(directory.get<std::string>());
+            if (!std::filesystem::is_directory(dir_path)) {
+                spdlog::warn("图集目录不存在: {}", dir_path.string());
+                continue;
+            }
+            std::vector<std::string> paths;
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(dir_path)) {
+                if (entry.is_regular_file() && entry.path().extension() == ".png") {
+                    paths.push_back(entry.path().generic_string());
+                }
+            }
+            std::sort(paths.begin(), paths.end());  // 保证每次运行的打包结果一致
+            for (auto& path : paths) {
+                add_texture(std::move(path));
+            }
+        }
+    }
+    if (atlas_json.contains("textures")) {
+        for (const auto& path : atlas_json["textures"]) {
+            add_texture(path.get<std::string>());
+        }
+    }
+    texture_manager_->buildAtlas(textures, page_size, padding);
+}
+
 // --- 纹理接口实现 ---
 SDL_Texture* ResourceManager::loadTexture(entt::id_type id, std::string_view file_path) {
     // 构造函数已经确保了 texture_manager_ 不为空，因此不需要再进行if检查，以免性能浪费
@@ -93,6 +142,26 @@ glm::vec2 ResourceManager::getTextureSize(entt::hashed_string str_hs) {
     return texture_manager_->getTextureSize(str_hs);
 }
 
+TextureRegion ResourceManager::getTextureRegion(entt::id_type id, std::string_view file_path) {
+    return texture_manager_->getTextureRegion(id, file_path);
+}
+
+TextureRegion ResourceManager::getTextureRegion(TextureHandle handle) const {
+    return texture_manager_->getTextureRegion(handle);
+}
+
+TextureHandle ResourceManager::resolveTexture(entt::id_type id, std::string_view file_path) {
+    return texture_manager_->resolveTexture(id, file_path);
+}
+
+bool ResourceManager::isTextureHandleValid(TextureHandle handle) const {
+    return texture_manager_->isHandleValid(handle);
+}
+
+SDL_Texture* ResourceManager::createRenderTarget(entt::id_type id, int width, int height) {
+    return texture_manager_->createRenderTarget(id, width, height);
+}
+
 void ResourceManager::unloadTexture(entt::id_type id) {
     texture_manager_->unloadTexture(id);
 }
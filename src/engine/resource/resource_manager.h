@@ -1,4 +1,6 @@
 #pragma once
+#include "texture_handle.h"
+#include "texture_region.h"
 #include <memory> // 用于 std::unique_ptr
 #include <string_view> // 用于 std::string_view
 #include <glm/glm.hpp>
@@ -18,6 +20,7 @@ namespace engine::resource {
 class TextureManager;
 class AudioManager;
 class FontManager;
+class AnimationLibrary;
 
 /**
  * @brief 作为访问各种资源管理器的中央控制点（外观模式 Facade）。
@@ -29,6 +32,7 @@ private:
     std::unique_ptr<TextureManager> texture_manager_;
     std::unique_ptr<AudioManager> audio_manager_;
     std::unique_ptr<FontManager> font_manager_;
+    std::unique_ptr<AnimationLibrary> animation_library_;   ///< @brief 共享动画库（不随 clear() 清空，已发出的索引一直有效）
 
 public:
     /**
@@ -50,12 +54,22 @@ public:
     // 加载资源
     void loadResources(std::string_view file_path);
 
+private:
+    void buildAtlas(const nlohmann::json& atlas_json);   ///< @brief 根据资源映射文件中的 "atlas" 字段构建纹理图集
+
+public:
+
     // --- 统一资源访问接口 ---
     // -- Texture --
     SDL_Texture* loadTexture(entt::id_type id, std::string_view file_path);         ///< @brief 载入纹理资源(通过id + 文件路径)
     SDL_Texture* loadTexture(entt::hashed_string str_hs);                           ///< @brief 载入纹理资源(通过字符串哈希值)
     SDL_Texture* getTexture(entt::id_type id, std::string_view file_path = "");     ///< @brief 尝试获取已加载纹理的指针，如果未加载则尝试加载(通过id + 文件路径)
     SDL_Texture* getTexture(entt::hashed_string str_hs);                            ///< @brief 尝试获取已加载纹理的指针，如果未加载则尝试加载(通过字符串哈希值)
+    TextureRegion getTextureRegion(entt::id_type id, std::string_view file_path = "");   ///< @brief 获取纹理区域(图集中的图片会返回图集页及偏移)
+    TextureRegion getTextureRegion(TextureHandle handle) const;                     ///< @brief 通过纹理句柄获取纹理区域(无哈希查找)，句柄失效时 texture_ 为 nullptr
+    TextureHandle resolveTexture(entt::id_type id, std::string_view file_path = ""); ///< @brief 解析纹理句柄(未加载且提供路径时先加载)，应在创建实体时调用
+    bool isTextureHandleValid(TextureHandle handle) const;                          ///< @brief 检查纹理句柄是否仍然有效(纹理未被卸载)
+    SDL_Texture* createRenderTarget(entt::id_type id, int width, int height);       ///< @brief 创建可作为渲染目标的空白纹理(已存在同id纹理时会替换)
     void unloadTexture(entt::id_type id);                                           ///< @brief 卸载指定的纹理资源
     glm::vec2 getTextureSize(entt::id_type id, std::string_view file_path = "");    ///< @brief 获取指定纹理的尺寸(通过id + 文件路径)
     glm::vec2 getTextureSize(entt::hashed_string str_hs);                           ///< @brief 获取指定纹理的尺寸(通过字符串哈希值)
@@ -84,6 +98,10 @@ public:
     TTF_Font* getFont(entt::hashed_string str_hs, int point_size);                        ///< @brief 尝试获取已加载字体的指针，如果未加载则尝试加载(通过字符串哈希值)
     void unloadFont(entt::id_type id, int point_size);                              ///< @brief 卸载指定的字体资源
     void clearFonts();                                                              ///< @brief 清空所有字体资源
+
+    // -- Animations --
+    AnimationLibrary& getAnimationLibrary() { return *animation_library_; }             ///< @brief 获取共享动画库(动画片段只存储一份，实体通过索引引用)
+    const AnimationLibrary& getAnimationLibrary() const { return *animation_library_; } ///< @brief 获取共享动画库(只读)
 };
 
 } // namespace engine::resource
@@ -0,0 +1,24 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+
+namespace engine::resource {
+
+/**
+ * @brief 纹理句柄：TextureManager 内部纹理槽位的索引 + 代数(generation)。
+ *
+ * 在创建实体时解析一次（ResourceManager::resolveTexture），之后绘制时直接通过索引访问，
+ * 不需要哈希查找，也不需要保存纹理路径字符串。
+ * 纹理被卸载（或被替换）时槽位的代数会增加，旧句柄因此失效，可以被检测出来。
+ */
+struct TextureHandle {
+    static constexpr std::uint32_t INVALID_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+    std::uint32_t index_{INVALID_INDEX};    ///< @brief 槽位索引
+    std::uint32_t generation_{0};           ///< @brief 解析时槽位的代数（有效代数从1开始）
+
+    bool isNull() const { return index_ == INVALID_INDEX; }    ///< @brief 是否从未解析
+    bool operator==(const TextureHandle&) const = default;
+};
+
+} // namespace engine::resource
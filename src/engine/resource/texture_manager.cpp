@@ -1,7 +1,11 @@
 #include "texture_manager.h"
+#include "atlas_packer.h"
+#include "../debug/profiler.h"
 #include <SDL3_image/SDL_image.h> // 用于 IMG_LoadTexture, IMG_Init, IMG_Quit
 #include <spdlog/spdlog.h>
+#include <algorithm>
 #include <stdexcept>
+#include <string>
 #include <entt/core/hashed_string.hpp>
 
 namespace engine::resource {
@@ -15,6 +19,10 @@ TextureManager::TextureManager(SDL_Renderer* renderer) : renderer_(renderer) {
 }
 
 SDL_Texture* TextureManager::loadTexture(entt::id_type id, std::string_view file_path) {
+    // 已打包进图集的图片，返回所在的图集页
+    if (auto region_it = atlas_regions_.find(id); region_it != atlas_regions_.end()) {
+        return textures_[region_it->second.page_id_].get();
+    }
     // 检查是否已加载
     auto it = textures_.find(id);
     if (it != textures_.end()) {
@@ -22,6 +30,7 @@ SDL_Texture* TextureManager::loadTexture(entt::id_type id, std::string_view file
     }
 
     // 如果没加载则尝试加载纹理
+    ENGINE_PROFILE_SCOPE_DETAIL("TextureManager::loadTexture", file_path);
     SDL_Texture* raw_texture = IMG_LoadTexture(renderer_, file_path.data());
 
     // 载入纹理时，设置纹理缩放模式为最邻近插值(必不可少，否则TileLayer渲染中会出现边缘空隙/模糊)
@@ -46,6 +55,10 @@ SDL_Texture* TextureManager::loadTexture(entt::hashed_string str_hs) {
 }
 
 SDL_Texture* TextureManager::getTexture(entt::id_type id, std::string_view file_path) {
+    // 已打包进图集的图片，返回所在的图集页
+    if (auto region_it = atlas_regions_.find(id); region_it != atlas_regions_.end()) {
+        return textures_[region_it->second.page_id_].get();
+    }
     // 查找现有纹理
     auto it = textures_.find(id);
     if (it != textures_.end()) {
@@ -67,6 +80,10 @@ SDL_Texture* TextureManager::getTexture(entt::hashed_string str_hs) {
 }
 
 glm::vec2 TextureManager::getTextureSize(entt::id_type id, std::string_view file_path) {
+    // 图集中的图片返回其原始尺寸，而不是图集页的尺寸
+    if (auto region_it = atlas_regions_.find(id); region_it != atlas_regions_.end()) {
+        return region_it->second.size_;
+    }
     // 获取纹理
     SDL_Texture* texture = getTexture(id, file_path);
     if (!texture) {
@@ -87,7 +104,199 @@ glm::vec2 TextureManager::getTextureSize(entt::hashed_string str_hs) {
     return getTextureSize(str_hs.value(), str_hs.data());
 }
 
+TextureRegion TextureManager::getTextureRegion(entt::id_type id, std::string_view file_path) {
+    if (auto region_it = atlas_regions_.find(id); region_it != atlas_regions_.end()) {
+        const auto& region = region_it->second;
+        return TextureRegion{textures_[region.page_id_].get(), region.offset_, region.size_};
+    }
+    TextureRegion result;
+    result.texture_ = getTexture(id, file_path);
+    if (result.texture_) {
+        SDL_GetTextureSize(result.texture_, &result.size_.x, &result.size_.y);
+    }
+    return result;
+}
+
+TextureHandle TextureManager::resolveTexture(entt::id_type id, std::string_view file_path) {
+    if (auto it = slot_indices_.find(id); it != slot_indices_.end()) {
+        return TextureHandle{it->second, slots_[it->second].generation_};
+    }
+    auto region = getTextureRegion(id, file_path);
+    if (!region.texture_) {
+        return {};
+    }
+
+    // 分配槽位（优先复用空闲槽位，代数保留，保证旧句柄不会误匹配）
+    std::uint32_t index;
+    if (!free_slots_.empty()) {
+        index = free_slots_.back();
+        free_slots_.pop_back();
+    } else {
+        index = static_cast<std::uint32_t>(slots_.size());
+        slots_.push_back(TextureSlot{entt::null, {}, 1});
+    }
+    auto& slot = slots_[index];
+    slot.id_ = id;
+    slot.region_ = region;
+    slot_indices_[id] = index;
+    return TextureHandle{index, slot.generation_};
+}
+
+void TextureManager::releaseSlot(entt::id_type id) {
+    auto it = slot_indices_.find(id);
+    if (it == slot_indices_.end()) {
+        return;
+    }
+    auto& slot = slots_[it->second];
+    slot.id_ = entt::null;
+    slot.region_ = {};
+    ++slot.generation_;
+    free_slots_.push_back(it->second);
+    slot_indices_.erase(it);
+}
+
+void TextureManager::buildAtlas(const std::vector<std::pair<entt::id_type, std::string>>& textures, int page_size, int padding) {
+    ENGINE_PROFILE_SCOPE("TextureManager::buildAtlas");
+    // 图集页不能超过渲染器支持的最大纹理尺寸
+    auto max_size = SDL_GetNumberProperty(SDL_GetRendererProperties(renderer_), SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, 0);
+    if (max_size > 0 && page_size > max_size) {
+        spdlog::warn("图集页尺寸 {} 超过渲染器支持的最大纹理尺寸 {}，已自动调整。", page_size, max_size);
+        page_size = static_cast<int>(max_size);
+    }
+
+    // 1. 把图片载入到内存中（统一转换为 RGBA32 格式，方便复制）
+    struct SurfaceDeleter {
+        void operator()(SDL_Surface* surface) const { SDL_DestroySurface(surface); }
+    };
+    using SurfacePtr = std::unique_ptr<SDL_Surface, SurfaceDeleter>;
+    std::vector<SurfacePtr> surfaces;
+    std::vector<entt::id_type> ids;
+    std::vector<glm::ivec2> sizes;
+    for (const auto& [id, file_path] : textures) {
+        if (textures_.contains(id) || atlas_regions_.contains(id)) {
+            continue;   // 已经作为独立纹理或已在图集中，跳过
+        }
+        SurfacePtr loaded(IMG_Load(file_path.c_str()));
+        if (!loaded) {
+            spdlog::error("加载图集图片失败: '{}': {}", file_path, SDL_GetError());
+            continue;
+        }
+        SurfacePtr converted(SDL_ConvertSurface(loaded.get(), SDL_PIXELFORMAT_RGBA32));
+        if (!converted) {
+            spdlog::error("转换图集图片格式失败: '{}': {}", file_path, SDL_GetError());
+            continue;
+        }
+        sizes.emplace_back(converted->w, converted->h);
+        ids.push_back(id);
+        surfaces.push_back(std::move(converted));
+    }
+    if (surfaces.empty()) {
+        return;
+    }
+
+    // 2. 计算每张图片在图集中的位置
+    AtlasPacker packer(page_size, padding);
+    auto placements = packer.pack(sizes);
+
+    // 3. 为每一页创建内存表面（只分配实际用到的区域），复制图片后再上传为纹理
+    std::vector<entt::id_type> page_ids(packer.getPageCount(), entt::null);
+    std::vector<SurfacePtr> page_surfaces(packer.getPageCount());
+    for (std::size_t page = 0; page < packer.getPageCount(); ++page) {
+        const auto& used_size = packer.getPageInfo(page).used_size_;
+        page_surfaces[page].reset(SDL_CreateSurface(used_size.x, used_size.y, SDL_PIXELFORMAT_RGBA32));
+        if (!page_surfaces[page]) {
+            spdlog::error("创建图集页表面失败 ({}x{}): {}", used_size.x, used_size.y, SDL_GetError());
+            continue;
+        }
+        SDL_FillSurfaceRect(page_surfaces[page].get(), nullptr, 0);   // 透明背景（间距部分保持透明）
+    }
+    for (std::size_t i = 0; i < surfaces.size(); ++i) {
+        const auto& placement = placements[i];
+        if (placement.page_ < 0 || !page_surfaces[placement.page_]) {
+            continue;
+        }
+        SDL_Rect dest_rect = {placement.position_.x, placement.position_.y, sizes[i].x, sizes[i].y};
+        SDL_SetSurfaceBlendMode(surfaces[i].get(), SDL_BLENDMODE_NONE);   // 原样复制像素（包括透明度）
+        if (!SDL_BlitSurface(surfaces[i].get(), nullptr, page_surfaces[placement.page_].get(), &dest_rect)) {
+            spdlog::error("复制图片到图集页失败: {}", SDL_GetError());
+        }
+    }
+
+    std::size_t packed_count = 0;
+    std::size_t total_used_area = 0;
+    std::size_t total_page_area = 0;
+    for (std::size_t page = 0; page < packer.getPageCount(); ++page) {
+        if (!page_surfaces[page]) {
+            continue;
+        }
+        SDL_Texture* page_texture = SDL_CreateTextureFromSurface(renderer_, page_surfaces[page].get());
+        if (!page_texture) {
+            spdlog::error("创建图集页纹理失败: {}", SDL_GetError());
+            continue;
+        }
+        if (!SDL_SetTextureScaleMode(page_texture, SDL_SCALEMODE_NEAREST)) {
+            spdlog::warn("无法设置纹理缩放模式为最邻近插值");
+        }
+        const std::string page_name = "atlas#" + std::to_string(atlas_page_count_++);
+        page_ids[page] = entt::hashed_string(page_name.c_str());
+        textures_[page_ids[page]] = std::unique_ptr<SDL_Texture, SDLTextureDeleter>(page_texture);
+
+        // 报告占用率：图片面积 / 图集页面积，其余为浪费（间距 + 货架剩余空间）
+        const auto& info = packer.getPageInfo(page);
+        const auto page_area = static_cast<std::size_t>(page_surfaces[page]->w) * static_cast<std::size_t>(page_surfaces[page]->h);
+        const float occupancy = page_area > 0 ? static_cast<float>(info.used_area_) / static_cast<float>(page_area) : 0.0f;
+        spdlog::info("图集页 '{}': {}x{}, {} 张图片, 占用率 {:.1f}%, 浪费 {:.1f}%", page_name, page_surfaces[page]->w, page_surfaces[page]->h,
+                     info.rect_count_, occupancy * 100.0f, (1.0f - occupancy) * 100.0f);
+        total_used_area += info.used_area_;
+        total_page_area += page_area;
+    }
+
+    // 4. 记录每张图片所在的区域
+    for (std::size_t i = 0; i < surfaces.size(); ++i) {
+        const auto& placement = placements[i];
+        if (placement.page_ < 0 || page_ids[placement.page_] == entt::null) {
+            spdlog::debug("图片 id = {} ({}x{}) 未打包进图集，将作为独立纹理加载。", ids[i], sizes[i].x, sizes[i].y);
+            continue;
+        }
+        atlas_regions_[ids[i]] = AtlasRegion{page_ids[placement.page_], glm::vec2(placement.position_), glm::vec2(sizes[i])};
+        ++packed_count;
+    }
+
+    const float total_occupancy = total_page_area > 0 ? static_cast<float>(total_used_area) / static_cast<float>(total_page_area) : 0.0f;
+    spdlog::info("图集构建完成: {}/{} 张图片打包进 {} 页, 总占用率 {:.1f}%, 浪费 {:.2f} MB", packed_count, surfaces.size(),
+                 packer.getPageCount(), total_occupancy * 100.0f,
+                 static_cast<float>((total_page_area - total_used_area) * 4) / (1024.0f * 1024.0f));
+}
+
+SDL_Texture* TextureManager::createRenderTarget(entt::id_type id, int width, int height) {
+    SDL_Texture* raw_texture = SDL_CreateTexture(renderer_, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+    if (!raw_texture) {
+        spdlog::error("创建渲染目标纹理失败 ({}x{}): {}", width, height, SDL_GetError());
+        return nullptr;
+    }
+    // 与普通纹理一致，使用最邻近插值
+    if (!SDL_SetTextureScaleMode(raw_texture, SDL_SCALEMODE_NEAREST)) {
+        spdlog::warn("无法设置纹理缩放模式为最邻近插值");
+    }
+    // 在透明背景上按普通混合绘制后，纹理中的颜色已经预乘了透明度，因此绘制时需要使用预乘混合模式
+    if (!SDL_SetTextureBlendMode(raw_texture, SDL_BLENDMODE_BLEND_PREMULTIPLIED)) {
+        spdlog::warn("无法设置渲染目标纹理的混合模式: {}", SDL_GetError());
+    }
+
+    // 如果已存在同id的纹理，unique_ptr 会负责销毁旧纹理，旧纹理的句柄也随之失效
+    releaseSlot(id);
+    textures_[id] = std::unique_ptr<SDL_Texture, SDLTextureDeleter>(raw_texture);
+    spdlog::debug("成功创建渲染目标纹理: id = {}, 尺寸: {}x{}", id, width, height);
+    return raw_texture;
+}
+
 void TextureManager::unloadTexture(entt::id_type id) {
+    // 图集中的图片只移除区域记录（图集页被其它图片共享）
+    releaseSlot(id);
+    if (atlas_regions_.erase(id) > 0) {
+        spdlog::debug("移除图集图片: id = {}", id);
+        return;
+    }
     auto it = textures_.find(id);
     if (it != textures_.end()) {
         spdlog::debug("卸载纹理: id = {}", id);
@@ -102,6 +311,16 @@ void TextureManager::clearTextures() {
         spdlog::debug("正在清除所有 {} 个缓存的纹理。", textures_.size());
         textures_.clear(); // unique_ptr 处理所有元素的删除
     }
+    atlas_regions_.clear();
+    // 所有句柄失效
+    for (const auto& [id, index] : slot_indices_) {
+        auto& slot = slots_[index];
+        slot.id_ = entt::null;
+        slot.region_ = {};
+        ++slot.generation_;
+        free_slots_.push_back(index);
+    }
+    slot_indices_.clear();
 }
 
 } // namespace engine::resource
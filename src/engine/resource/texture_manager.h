@@ -1,7 +1,13 @@
 #pragma once
 #include <memory>
+#include <cstdint>
 #include <unordered_map>
+#include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
+#include "texture_handle.h"
+#include "texture_region.h"
 #include <SDL3/SDL_render.h>
 #include <glm/glm.hpp>
 #include <entt/core/fwd.hpp>
@@ -13,6 +19,9 @@ namespace engine::resource {
  *
  * 在构造时初始化。使用文件路径作为键，确保纹理只加载一次并正确释放。
  * 依赖于一个有效的 SDL_Renderer，构造失败会抛出异常。
+ * 支持把一组图片打包成若干图集页(buildAtlas)，之后这些图片的id都指向所在的图集页，
+ * 绘制时通过 getTextureRegion() 获取偏移即可，对调用者透明。
+ * 已加载的纹理可以解析为纹理句柄(TextureHandle)，通过句柄获取纹理区域只需一次数组访问。
  */
 class TextureManager final{
     friend class ResourceManager;
@@ -30,6 +39,26 @@ private:
     // 存储文件路径和指向管理纹理的 unique_ptr 的映射。(容器的键不可使用entt::hashed_string)
     std::unordered_map<entt::id_type, std::unique_ptr<SDL_Texture, SDLTextureDeleter>> textures_;
 
+    /// @brief 图集中的一张图片
+    struct AtlasRegion {
+        entt::id_type page_id_;     ///< @brief 所在图集页的纹理id（存放在 textures_ 中）
+        glm::vec2 offset_;          ///< @brief 在图集页中的左上角坐标
+        glm::vec2 size_;            ///< @brief 原始尺寸
+    };
+    // 打包进图集的图片id -> 图集区域
+    std::unordered_map<entt::id_type, AtlasRegion> atlas_regions_;
+    int atlas_page_count_ = 0;          ///< @brief 已创建的图集页数量（用于生成页id）
+
+    /// @brief 纹理槽位，纹理句柄通过索引访问
+    struct TextureSlot {
+        entt::id_type id_;          ///< @brief 纹理id（空闲槽位为entt::null）
+        TextureRegion region_;      ///< @brief 解析好的纹理区域
+        std::uint32_t generation_;  ///< @brief 代数，槽位被释放时加1，使旧句柄失效
+    };
+    std::vector<TextureSlot> slots_;                                    ///< @brief 槽位数组
+    std::vector<std::uint32_t> free_slots_;                             ///< @brief 空闲槽位索引
+    std::unordered_map<entt::id_type, std::uint32_t> slot_indices_;     ///< @brief 纹理id -> 槽位索引
+
     SDL_Renderer* renderer_ = nullptr; // 指向主渲染器的非拥有指针
 
 public:
@@ -104,9 +133,65 @@ private: // 仅供 ResourceManager 访问的方法
      */
     glm::vec2 getTextureSize(entt::hashed_string str_hs);
 
+    /**
+     * @brief 获取纹理区域（绘制时使用，自动处理图集偏移）
+     * @param id 纹理的唯一标识符, 通过entt::hashed_string生成
+     * @param file_path 纹理文件的路径（未加载时用于加载）
+     * @return 纹理区域，获取失败时 texture_ 为 nullptr
+     */
+    TextureRegion getTextureRegion(entt::id_type id, std::string_view file_path = "");
+
+    /**
+     * @brief 通过纹理句柄获取纹理区域（绘制时使用，不做哈希查找）
+     * @param handle 纹理句柄
+     * @return 纹理区域，句柄无效或已失效时 texture_ 为 nullptr
+     */
+    TextureRegion getTextureRegion(TextureHandle handle) const {
+        if (handle.index_ >= slots_.size() || slots_[handle.index_].generation_ != handle.generation_) {
+            return {};
+        }
+        return slots_[handle.index_].region_;
+    }
+
+    /**
+     * @brief 解析纹理句柄（如果纹理未加载且提供了file_path，则先加载）
+     * @param id 纹理的唯一标识符, 通过entt::hashed_string生成
+     * @param file_path 纹理文件的路径
+     * @return 纹理句柄，失败时返回空句柄
+     */
+    TextureHandle resolveTexture(entt::id_type id, std::string_view file_path = "");
+
+    /**
+     * @brief 检查纹理句柄是否仍然有效
+     */
+    bool isHandleValid(TextureHandle handle) const {
+        return handle.index_ < slots_.size() && slots_[handle.index_].generation_ == handle.generation_;
+    }
+
+    /**
+     * @brief 把一组图片打包进图集页
+     * @param textures (纹理id, 文件路径) 列表，已经加载过的纹理会被跳过
+     * @param page_size 图集页边长（会被限制在渲染器支持的最大纹理尺寸之内）
+     * @param padding 图片之间的间距
+     * @note 超过页面尺寸的图片不会打包，仍然在需要时作为独立纹理加载
+     */
+    void buildAtlas(const std::vector<std::pair<entt::id_type, std::string>>& textures, int page_size, int padding);
+
+    /**
+     * @brief 创建一个可作为渲染目标的空白纹理（例如用于烘焙瓦片层）
+     * @param id 纹理的唯一标识符, 通过entt::hashed_string生成
+     * @param width 纹理宽度
+     * @param height 纹理高度
+     * @return 创建的纹理的指针，失败返回nullptr
+     * @note 如果该id已存在纹理，则先将其销毁再重新创建
+     * @note 纹理内容为预乘透明度(premultiplied alpha)，混合模式为 SDL_BLENDMODE_BLEND_PREMULTIPLIED
+     */
+    SDL_Texture* createRenderTarget(entt::id_type id, int width, int height);
+
     /**
      * @brief 卸载纹理
      * @param id 纹理的唯一标识符, 通过entt::hashed_string生成
+     * @note 对于图集中的图片只移除其区域记录，图集页本身保留
      */
     void unloadTexture(entt::id_type id);
 
@@ -114,6 +199,11 @@ private: // 仅供 ResourceManager 访问的方法
      * @brief 清空所有纹理资源
      */
     void clearTextures();
+
+    /**
+     * @brief 释放纹理id对应的槽位（纹理被卸载或替换时调用），已解析的句柄随之失效
+     */
+    void releaseSlot(entt::id_type id);
 };
 
 } // namespace engine::resource
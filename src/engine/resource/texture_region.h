@@ -0,0 +1,18 @@
+#pragma once
+#include <glm/vec2.hpp>
+
+struct SDL_Texture;
+
+namespace engine::resource {
+
+/**
+ * @brief 纹理区域：纹理指针 + 原始图片在该纹理中的位置。
+ * 对于打包进图集的纹理，texture_ 是图集页，offset_ 是原始图片在页中的左上角；普通纹理的 offset_ 为0。
+ */
+struct TextureRegion {
+    SDL_Texture* texture_ = nullptr;    ///< @brief 实际用于绘制的纹理
+    glm::vec2 offset_{0.0f};            ///< @brief 原始图片在纹理中的偏移(源矩形需要加上此偏移)
+    glm::vec2 size_{0.0f};              ///< @brief 原始图片的尺寸
+};
+
+} // namespace engine::resource
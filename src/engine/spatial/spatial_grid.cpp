@@ -0,0 +1,114 @@
+#include "spatial_grid.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <spdlog/spdlog.h>
+
+namespace engine::spatial
+{
+
+    SpatialGrid::SpatialGrid(float cell_size, std::size_t bucket_count)
+        : cell_size_(cell_size > 0.0f ? cell_size : 64.0f),
+          inv_cell_size_(1.0f / cell_size_),
+          bucket_mask_(std::bit_ceil(std::max<std::size_t>(bucket_count, 1)) - 1),
+          bucket_start_(bucket_mask_ + 2, 0)
+    {
+        spdlog::trace("SpatialGrid 构造完成，单元格边长: {}, 哈希桶数量: {}", cell_size_, bucket_mask_ + 1);
+    }
+
+    void SpatialGrid::clear()
+    {
+        pending_.clear();
+        entries_.clear();
+        std::fill(bucket_start_.begin(), bucket_start_.end(), 0);
+    }
+
+    void SpatialGrid::insert(entt::entity entity, const glm::vec2 &position, std::uint32_t mask)
+    {
+        pending_.push_back({entity, position, mask, toCell(position.x), toCell(position.y)});
+    }
+
+    void SpatialGrid::build()
+    {
+        // --- 计数排序：先统计每个桶的条目数量，再计算前缀和得到起始索引，最后分发条目 ---
+        std::fill(bucket_start_.begin(), bucket_start_.end(), 0);
+        for (const auto &entry : pending_)
+        {
+            ++bucket_start_[bucketIndex(entry.cell_x_, entry.cell_y_) + 1];
+        }
+        for (std::size_t i = 1; i < bucket_start_.size(); ++i)
+        {
+            bucket_start_[i] += bucket_start_[i - 1];
+        }
+
+        entries_.resize(pending_.size());
+        // 直接把起始索引当作写入游标使用（避免额外分配），分发完成后再恢复
+        for (const auto &entry : pending_)
+        {
+            const auto bucket = bucketIndex(entry.cell_x_, entry.cell_y_);
+            entries_[bucket_start_[bucket]++] = entry;
+        }
+        // 分发之后 bucket_start_[i] 变成了第i个桶的结束索引，整体右移一位即可恢复为起始索引
+        for (std::size_t i = bucket_start_.size() - 1; i > 0; --i)
+        {
+            bucket_start_[i] = bucket_start_[i - 1];
+        }
+        bucket_start_[0] = 0;
+        pending_.clear();
+    }
+
+    std::size_t SpatialGrid::queryRadius(const glm::vec2 &center, float radius, std::uint32_t mask, std::vector<entt::entity> &out) const
+    {
+        out.clear();
+        forEachInRadius(center, radius, mask, [&out](entt::entity entity, const glm::vec2 &, float)
+                        {
+            out.push_back(entity);
+            return true; });
+        return out.size();
+    }
+
+    std::size_t SpatialGrid::queryNearest(const glm::vec2 &center, std::size_t k, float max_radius, std::uint32_t mask, std::vector<Neighbor> &out) const
+    {
+        out.clear();
+        if (k == 0)
+            return 0;
+        forEachInRadius(center, max_radius, mask, [&out](entt::entity entity, const glm::vec2 &, float distance_squared)
+                        {
+            out.push_back({entity, distance_squared});
+            return true; });
+        // 只需要前k个，部分排序即可
+        const auto count = std::min(k, out.size());
+        std::partial_sort(out.begin(), out.begin() + count, out.end(), [](const Neighbor &a, const Neighbor &b)
+                          { return a.distance_squared_ < b.distance_squared_; });
+        out.resize(count);
+        return count;
+    }
+
+    entt::entity SpatialGrid::findNearest(const glm::vec2 &center, float max_radius, std::uint32_t mask) const
+    {
+        entt::entity nearest = entt::null;
+        float nearest_distance_squared = max_radius * max_radius;
+        forEachInRadius(center, max_radius, mask, [&](entt::entity entity, const glm::vec2 &, float distance_squared)
+                        {
+            if (nearest == entt::null || distance_squared < nearest_distance_squared)
+            {
+                nearest = entity;
+                nearest_distance_squared = distance_squared;
+            }
+            return true; });
+        return nearest;
+    }
+
+    std::int32_t SpatialGrid::toCell(float value) const
+    {
+        return static_cast<std::int32_t>(std::floor(value * inv_cell_size_));
+    }
+
+    std::size_t SpatialGrid::bucketIndex(std::int32_t cell_x, std::int32_t cell_y) const
+    {
+        // 经典的空间哈希：两个大质数与坐标相乘后异或
+        const auto hash = (static_cast<std::uint32_t>(cell_x) * 73856093u) ^ (static_cast<std::uint32_t>(cell_y) * 19349663u);
+        return static_cast<std::size_t>(hash) & bucket_mask_;
+    }
+
+} // namespace engine::spatial
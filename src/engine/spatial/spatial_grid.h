@@ -0,0 +1,144 @@
+#pragma once
+#include <entt/entity/entity.hpp>
+#include <glm/vec2.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace engine::spatial
+{
+
+    /**
+     * @brief 均匀网格空间哈希，用于快速的邻近查询（半径查询、K近邻查询）。
+     *
+     * 使用方式：每帧先 clear()，再 insert() 所有参与查询的实体，最后 build()。
+     * build() 通过计数排序把条目按哈希桶连续存放，查询时只访问与查询圆相交的单元格，
+     * 因此单次查询的开销只与附近的实体数量相关，而与场景中的实体总数无关。
+     *
+     * 每个条目都带有一个掩码(mask)，其含义由使用者定义（如“玩家”、“敌人”、“阻挡者”），
+     * 查询时只返回掩码有交集的条目。
+     */
+    class SpatialGrid final
+    {
+    public:
+        /// @brief 网格中的条目
+        struct Entry
+        {
+            entt::entity entity_{entt::null}; ///< @brief 实体
+            glm::vec2 position_{};            ///< @brief 插入时的位置
+            std::uint32_t mask_{0};           ///< @brief 条目掩码
+            std::int32_t cell_x_{0};          ///< @brief 所在单元格x坐标
+            std::int32_t cell_y_{0};          ///< @brief 所在单元格y坐标
+        };
+
+        /// @brief K近邻查询的结果
+        struct Neighbor
+        {
+            entt::entity entity_{entt::null}; ///< @brief 实体
+            float distance_squared_{0.0f};    ///< @brief 与查询中心距离的平方
+        };
+
+    private:
+        float cell_size_;                          ///< @brief 单元格边长
+        float inv_cell_size_;                      ///< @brief 单元格边长的倒数（避免查询时做除法）
+        std::size_t bucket_mask_;                  ///< @brief 哈希桶掩码（桶数量为2的幂）
+        std::vector<Entry> pending_;               ///< @brief 本帧插入但尚未整理的条目
+        std::vector<Entry> entries_;               ///< @brief 按哈希桶连续存放的条目
+        std::vector<std::uint32_t> bucket_start_;  ///< @brief 每个桶在 entries_ 中的起始索引（长度为桶数量+1）
+
+    public:
+        /**
+         * @brief 构造函数
+         * @param cell_size 单元格边长，建议与常见的查询半径处于同一量级
+         * @param bucket_count 哈希桶数量，会向上取整为2的幂
+         */
+        explicit SpatialGrid(float cell_size = 64.0f, std::size_t bucket_count = 1024);
+
+        void clear();                                                                        ///< @brief 清空所有条目（保留已分配的内存）
+        void insert(entt::entity entity, const glm::vec2 &position, std::uint32_t mask);     ///< @brief 插入条目（build()之后才能被查询到）
+        void build();                                                                        ///< @brief 整理本帧插入的条目，使其可以被查询
+
+        /**
+         * @brief 遍历半径内（包含边界）所有与掩码匹配的条目
+         * @param center 查询中心
+         * @param radius 查询半径
+         * @param mask 查询掩码，与条目掩码有交集才会被返回
+         * @param func 回调函数，签名为 bool(entt::entity, const glm::vec2& position, float distance_squared)，返回false时提前结束遍历
+         */
+        template <typename Func>
+        void forEachInRadius(const glm::vec2 &center, float radius, std::uint32_t mask, Func &&func) const;
+
+        /**
+         * @brief 查询半径内（包含边界）所有与掩码匹配的实体
+         * @param out 输出的实体列表（会先被清空）
+         * @return 找到的实体数量
+         */
+        std::size_t queryRadius(const glm::vec2 &center, float radius, std::uint32_t mask, std::vector<entt::entity> &out) const;
+
+        /**
+         * @brief 查询半径内距离最近的k个实体
+         * @param out 输出的结果列表（会先被清空），按距离从近到远排列
+         * @return 找到的实体数量（不超过k）
+         */
+        std::size_t queryNearest(const glm::vec2 &center, std::size_t k, float max_radius, std::uint32_t mask, std::vector<Neighbor> &out) const;
+
+        /**
+         * @brief 查询半径内距离最近的实体
+         * @return 距离最近的实体，如果没有则返回 entt::null
+         */
+        [[nodiscard]] entt::entity findNearest(const glm::vec2 &center, float max_radius, std::uint32_t mask) const;
+
+        [[nodiscard]] std::size_t size() const { return entries_.size(); }
+        [[nodiscard]] float getCellSize() const { return cell_size_; }
+
+    private:
+        [[nodiscard]] std::int32_t toCell(float value) const;
+        [[nodiscard]] std::size_t bucketIndex(std::int32_t cell_x, std::int32_t cell_y) const;
+    };
+
+    template <typename Func>
+    void SpatialGrid::forEachInRadius(const glm::vec2 &center, float radius, std::uint32_t mask, Func &&func) const
+    {
+        const float radius_squared = radius * radius;
+        const auto min_x = toCell(center.x - radius);
+        const auto max_x = toCell(center.x + radius);
+        const auto min_y = toCell(center.y - radius);
+        const auto max_y = toCell(center.y + radius);
+
+        // 查询范围覆盖的单元格数量超过条目数量时，直接线性扫描更快
+        const auto cell_count = static_cast<std::size_t>(max_x - min_x + 1) * static_cast<std::size_t>(max_y - min_y + 1);
+        if (cell_count >= entries_.size())
+        {
+            for (const auto &entry : entries_)
+            {
+                if ((entry.mask_ & mask) == 0)
+                    continue;
+                const glm::vec2 diff = entry.position_ - center;
+                const float distance_squared = diff.x * diff.x + diff.y * diff.y;
+                if (distance_squared <= radius_squared && !func(entry.entity_, entry.position_, distance_squared))
+                    return;
+            }
+            return;
+        }
+
+        for (auto cell_y = min_y; cell_y <= max_y; ++cell_y)
+        {
+            for (auto cell_x = min_x; cell_x <= max_x; ++cell_x)
+            {
+                const auto bucket = bucketIndex(cell_x, cell_y);
+                for (auto i = bucket_start_[bucket]; i < bucket_start_[bucket + 1]; ++i)
+                {
+                    const auto &entry = entries_[i];
+                    // 不同的单元格可能落在同一个桶里，需要核对单元格坐标，避免重复返回
+                    if (entry.cell_x_ != cell_x || entry.cell_y_ != cell_y || (entry.mask_ & mask) == 0)
+                        continue;
+                    const glm::vec2 diff = entry.position_ - center;
+                    const float distance_squared = diff.x * diff.x + diff.y * diff.y;
+                    if (distance_squared <= radius_squared && !func(entry.entity_, entry.position_, distance_squared))
+                        return;
+                }
+            }
+        }
+    }
+
+} // namespace engine::spatial
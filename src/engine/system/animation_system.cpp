@@ -1,14 +1,27 @@
 #include "animation_system.h"
 #include "../component/animation_component.h"
 #include "../component/sprite_component.h"
+#include "../core/context.h"
+#include "../core/event_stager.h"
+#include "../core/job_system.h"
+#include "../debug/profiler.h"
+#include "../resource/animation_library.h"
+#include "../resource/resource_manager.h"
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
+#include <spdlog/spdlog.h>
+#include <cmath>
+#include <cstddef>
 
 namespace engine::system
 {
 
-    AnimationSystem::AnimationSystem(entt::registry &registry, entt::dispatcher &dispatcher)
-        : registry_(registry), dispatcher_(dispatcher)
+    AnimationSystem::AnimationSystem(entt::registry &registry, engine::core::Context &context)
+        : registry_(registry),
+          dispatcher_(context.getDispatcher()),
+          event_stager_(context.getEventStager()),
+          job_system_(context.getJobSystem()),
+          animation_library_(context.getResourceManager().getAnimationLibrary())
     {
         dispatcher_.sink<engine::utils::PlayAnimationEvent>().connect<&AnimationSystem::onPlayAnimationEvent>(this);
     }
@@ -21,78 +34,93 @@ namespace engine::system
     void AnimationSystem::update(float dt)
     {
         auto view = registry_.view<engine::component::AnimationComponent, engine::component::SpriteComponent>();
-        for (auto entity : view)
-        {
-            auto &anim_component = view.get<engine::component::AnimationComponent>(entity);
-            auto &sprite_component = view.get<engine::component::SpriteComponent>(entity);
-
+        // 每个实体只读写自己的组件，可以并行处理；事件写入当前线程的暂存区
+        job_system_.parallelForEach(view, [this, dt](entt::entity entity,
+                                                     engine::component::AnimationComponent &anim_component,
+                                                     engine::component::SpriteComponent &sprite_component)
+                                    {
             // 如果动画不存在，则跳过
-            auto it = anim_component.animations_.find(anim_component.current_animation_id_);
-            if (it == anim_component.animations_.end())
+            if (anim_component.current_clip_ == engine::resource::INVALID_ANIMATION_ID)
             {
-                continue;
+                return;
             }
 
-            // 获取当前动画
-            auto &current_animation = it->second;
+            // 获取当前动画（共享动画库中的片段）
+            const auto &current_animation = animation_library_.getClip(anim_component.current_clip_);
             // 如果没有帧，则跳过
-            if (current_animation.frames_.empty())
+            if (current_animation.frames_.empty() || current_animation.total_duration_ms_ <= 0.0f)
             {
-                continue;
+                return;
             }
 
-            // 更新当前播放时间 (推进计时器)
-            anim_component.current_time_ms_ += dt * 1000.0f * anim_component.speed_;
-
-            // 获取当前帧
-            const auto &current_frame = current_animation.frames_[anim_component.current_frame_index_];
-
-            // 检查是否需要切换到下一帧
-            if (anim_component.current_time_ms_ >= current_frame.duration_ms_)
+            const auto frame_count = current_animation.frames_.size();
+            const auto previous_frame = static_cast<std::size_t>(anim_component.current_frame_index_);
+            // 发送帧索引对应的动画事件
+            auto emit_event = [&](std::size_t frame_index)
             {
-                anim_component.current_time_ms_ -= current_frame.duration_ms_;
-                anim_component.current_frame_index_++;
+                event_stager_.enqueue(engine::utils::AnimationEvent{entity,
+                                                                    current_animation.events_.at(static_cast<int>(frame_index)),
+                                                                    anim_component.current_animation_id_});
+            };
 
-                // 检查是否要发送动画事件
-                if (current_animation.events_.find(anim_component.current_frame_index_) != current_animation.events_.end())
+            // 推进动画内的播放时间，按时间采样当前帧（一次推进可以跨越多帧，dt 较大或加速播放时不会落后）
+            float time_ms = anim_component.current_time_ms_ + dt * 1000.0f * anim_component.speed_;
+            std::size_t frame = previous_frame;
+            if (time_ms < current_animation.total_duration_ms_)
+            {
+                frame = current_animation.frameAt(time_ms);
+                // 本次跨越的帧上的事件
+                current_animation.forEachEvent(previous_frame + 1, frame, emit_event);
+            }
+            else if (anim_component.loop_)
+            {
+                // 播放到结尾并回到开头：本轮剩余的帧、中间完整的轮次、新一轮已经进入的帧，事件依次全部发送
+                const auto cycles = static_cast<std::size_t>(time_ms / current_animation.total_duration_ms_);
+                time_ms = std::fmod(time_ms, current_animation.total_duration_ms_);
+                frame = current_animation.frameAt(time_ms);
+                current_animation.forEachEvent(previous_frame + 1, frame_count, emit_event);
+                for (std::size_t i = 1; i < cycles; ++i)
                 {
-                    dispatcher_.enqueue(engine::utils::AnimationEvent{entity,
-                                                                      current_animation.events_.at(anim_component.current_frame_index_),
-                                                                      anim_component.current_animation_id_});
+                    current_animation.forEachEvent(1, frame_count, emit_event);
                 }
-
-                // 处理动画播放完成
-                if (anim_component.current_frame_index_ >= current_animation.frames_.size())
+                current_animation.forEachEvent(1, frame, emit_event);
+            }
+            else
+            {
+                // 动画播放完毕且不循环，停在最后一帧，播放完成事件只发送一次
+                if (anim_component.current_time_ms_ < current_animation.total_duration_ms_)
                 {
-                    if (current_animation.loop_)
-                    {
-                        anim_component.current_frame_index_ = 0;
-                    }
-                    else
-                    {
-                        // 动画播放完毕且不循环，停在最后一帧
-                        anim_component.current_frame_index_ = current_animation.frames_.size() - 1;
-                        // 发送动画播放完成事件
-                        dispatcher_.enqueue(engine::utils::AnimationFinishedEvent{entity, anim_component.current_animation_id_});
-                    }
+                    current_animation.forEachEvent(previous_frame + 1, frame_count, emit_event);
+                    event_stager_.enqueue(engine::utils::AnimationFinishedEvent{entity, anim_component.current_animation_id_});
                 }
+                time_ms = current_animation.total_duration_ms_;
+                frame = frame_count - 1;
             }
+            anim_component.current_time_ms_ = time_ms;
+            anim_component.current_frame_index_ = static_cast<std::uint32_t>(frame);
 
             // 更新 SpriteComponent 的源矩形 （根据当前动画帧的源矩形信息）
-            const auto &next_frame = current_animation.frames_[anim_component.current_frame_index_];
-            sprite_component.sprite_.src_rect_ = next_frame.src_rect_;
-        }
+            sprite_component.sprite_.src_rect_ = current_animation.frames_[frame].src_rect_; });
     }
 
     void AnimationSystem::onPlayAnimationEvent(const engine::utils::PlayAnimationEvent &event)
     {
+        ENGINE_PROFILE_SCOPE("AnimationSystem::onPlayAnimationEvent");
         // 使用try_get方法来安全获取可能存在的组件。如果不存在则返回nullptr
         if (auto anim = registry_.try_get<engine::component::AnimationComponent>(event.entity_); anim)
         {
+            // 切换动画时解析一次片段索引，之后逐帧更新直接按索引访问
+            auto clip = animation_library_.findClip(anim->set_id_, event.animation_id_);
+            if (clip == engine::resource::INVALID_ANIMATION_ID)
+            {
+                spdlog::warn("实体 {} 的动画集合中没有动画 {}", entt::to_integral(event.entity_), event.animation_id_);
+                return;
+            }
             anim->current_animation_id_ = event.animation_id_; // 替换动画ID
+            anim->current_clip_ = clip;
             anim->current_frame_index_ = 0;
             anim->current_time_ms_ = 0.0f;
-            anim->animations_.at(event.animation_id_).loop_ = event.loop_;
+            anim->loop_ = event.loop_;
         }
     }
 
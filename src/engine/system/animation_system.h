@@ -3,6 +3,18 @@
 #include <entt/entity/fwd.hpp>
 #include <entt/signal/fwd.hpp>
 
+namespace engine::core
+{
+    class Context;
+    class EventStager;
+    class JobSystem;
+}
+
+namespace engine::resource
+{
+    class AnimationLibrary;
+}
+
 namespace engine::system
 {
 
@@ -10,18 +22,24 @@ namespace engine::system
      * @brief 动画系统
      *
      * 负责更新实体的动画组件，并同步到精灵组件。
+     * 各实体互不影响，update 使用 JobSystem 并行遍历，动画事件通过 EventStager 暂存。
+     * 动画数据从共享的 AnimationLibrary 按索引读取，更新期间动画库只读。
+     * 播放按动画内时间采样帧（见 Animation::frameAt），一次更新可以跨越多帧，跨越的动画事件全部发送。
      */
     class AnimationSystem
     {
         // 将依赖保存为成员变量，方便回调函数使用
         entt::registry &registry_;
         entt::dispatcher &dispatcher_;
+        engine::core::EventStager &event_stager_;
+        engine::core::JobSystem &job_system_;
+        const engine::resource::AnimationLibrary &animation_library_; ///< @brief 共享动画库（只读）
 
     public:
-        AnimationSystem(entt::registry &registry, entt::dispatcher &dispatcher);
+        AnimationSystem(entt::registry &registry, engine::core::Context &context);
         ~AnimationSystem();
 
-        void update(float dt); ///< @brief 现在更新函数只需要传入dt，注册表和dispatcher在构造函数中传入
+        void update(float dt); ///< @brief 现在更新函数只需要传入dt，注册表和其它依赖在构造函数中传入
 
     private:
         void onPlayAnimationEvent(const engine::utils::PlayAnimationEvent &event); ///< @brief 播放动画事件处理函数
@@ -2,10 +2,11 @@
 #include "../core/context.h"
 #include "../component/audio_component.h"
 #include "../audio/audio_player.h"
+#include "../debug/log.h"
+#include "../debug/profiler.h"
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
 #include <entt/core/hashed_string.hpp>
-#include <spdlog/spdlog.h>
 
 using namespace entt::literals;
 
@@ -27,10 +28,11 @@ namespace engine::system
 
     void AudioSystem::onPlaySoundEvent(const engine::utils::PlaySoundEvent &event)
     {
+        ENGINE_PROFILE_SCOPE("AudioSystem::onPlaySoundEvent");
         // 如果没有传入目标实体，则直接播放全局音效
         if (event.entity_ == entt::null)
         {
-            spdlog::info("播放全局音效: {}", event.sound_id_);
+            ENGINE_LOG_INFO("播放全局音效: {}", event.sound_id_);
             context_.getAudioPlayer().playSound(event.sound_id_);
         }
         // 如果有传入目标实体，且实体有音效组件
@@ -40,20 +42,20 @@ namespace engine::system
             // 先尝试在目标实体的音效集合中查找
             if (it != audio_component->sounds_.end())
             {
-                spdlog::info("实体 ID: {} 中找到了音效: {}", entt::to_integral(event.entity_), it->second);
+                ENGINE_LOG_INFO("实体 ID: {} 中找到了音效: {}", entt::to_integral(event.entity_), it->second);
                 context_.getAudioPlayer().playSound(it->second);
                 // 如果没找到，则播放全局音效
             }
             else
             {
-                spdlog::info("实体 ID: {} 中没有找到音效: {}", entt::to_integral(event.entity_), event.sound_id_);
+                ENGINE_LOG_INFO("实体 ID: {} 中没有找到音效: {}", entt::to_integral(event.entity_), event.sound_id_);
                 context_.getAudioPlayer().playSound(event.sound_id_);
             }
         }
         // 如果有传入目标实体，但实体没有音效组件，也尝试播放全局音效
         else
         {
-            spdlog::info("实体 ID: {} 中没有音效组件，尝试播放全局音效: {}", entt::to_integral(event.entity_), event.sound_id_);
+            ENGINE_LOG_INFO("实体 ID: {} 中没有音效组件，尝试播放全局音效: {}", entt::to_integral(event.entity_), event.sound_id_);
             context_.getAudioPlayer().playSound(event.sound_id_);
         }
     }
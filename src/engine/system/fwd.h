@@ -10,5 +10,8 @@ namespace engine::system
     class MovementSystem;
     class YSortSystem;
     class AudioSystem;
+    class InterpolationSystem;
+    class SystemScheduler;
+    class ParticleSystem;
 
 } // namespace engine::system
\ No newline at end of file
@@ -0,0 +1,20 @@
+#include "interpolation_system.h"
+#include "../component/interpolation_component.h"
+#include "../component/transform_component.h"
+#include <entt/entity/registry.hpp>
+
+namespace engine::system
+{
+
+    void InterpolationSystem::update(entt::registry &registry)
+    {
+        auto view = registry.view<component::InterpolationComponent, const component::TransformComponent>();
+        for (auto entity : view)
+        {
+            auto &interpolation = view.get<component::InterpolationComponent>(entity);
+            const auto &transform = view.get<const component::TransformComponent>(entity);
+            interpolation.previous_position_ = transform.position_;
+        }
+    }
+
+} // namespace engine::system
@@ -0,0 +1,19 @@
+#pragma once
+#include <entt/entity/fwd.hpp>
+
+namespace engine::system
+{
+
+    /**
+     * @brief 渲染插值系统
+     *
+     * 在每个模拟tick开始时，把 TransformComponent 的位置快照到 InterpolationComponent 中，
+     * 供渲染阶段在上一个与当前tick的状态之间插值。必须在所有会修改位置的系统之前调用。
+     */
+    class InterpolationSystem
+    {
+    public:
+        void update(entt::registry &registry);
+    };
+
+} // namespace engine::system
@@ -1,12 +1,12 @@
 #include "movement_system.h"
 #include "../component/velocity_component.h"
 #include "../component/transform_component.h"
-#include <spdlog/spdlog.h>
+#include "../debug/log.h"
 
 namespace engine::system {
 
 void MovementSystem::update(entt::registry& registry, float delta_time) {
-    spdlog::trace("MovementSystem::update");
+    ENGINE_LOG_TRACE("MovementSystem::update");
     // 获取感兴趣的实体 view
     auto view = registry.view<engine::component::VelocityComponent, engine::component::TransformComponent>();
 
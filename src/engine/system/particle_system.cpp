@@ -0,0 +1,179 @@
+#include "particle_system.h"
+#include "../render/renderer.h"
+#include "../render/camera.h"
+#include "../resource/animation_library.h"
+#include "../debug/profiler.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstddef>
+
+namespace engine::system
+{
+
+    ParticleSystem::ParticleSystem(const engine::resource::AnimationLibrary &animation_library, std::size_t capacity)
+        : animation_library_(animation_library), capacity_(capacity)
+    {
+        positions_.resize(capacity_);
+        ages_ms_.resize(capacity_);
+        effect_ids_.resize(capacity_);
+        frames_.resize(capacity_);
+        flipped_.resize(capacity_);
+        draw_list_.reserve(capacity_);
+        spdlog::trace("粒子系统已创建，容量: {}", capacity_);
+    }
+
+    ParticleEffectId ParticleSystem::registerEffect(entt::id_type key, const ParticleEffectDesc &desc)
+    {
+        if (auto existing = findEffect(key); existing != INVALID_PARTICLE_EFFECT)
+        {
+            return existing;
+        }
+        if (desc.clip_ == engine::resource::INVALID_ANIMATION_ID)
+        {
+            spdlog::error("ParticleSystem: 特效 {} 的动画片段无效，不会登记", key);
+            return INVALID_PARTICLE_EFFECT;
+        }
+        const auto &clip = animation_library_.getClip(desc.clip_);
+        if (clip.frames_.empty() || clip.total_duration_ms_ <= 0.0f)
+        {
+            spdlog::error("ParticleSystem: 特效 {} 的动画片段没有帧，不会登记", key);
+            return INVALID_PARTICLE_EFFECT;
+        }
+        if (effects_.size() >= INVALID_PARTICLE_EFFECT)
+        {
+            spdlog::error("ParticleSystem: 特效数量已达上限，特效 {} 不会登记", key);
+            return INVALID_PARTICLE_EFFECT;
+        }
+
+        const auto effect = static_cast<ParticleEffectId>(effects_.size());
+        effects_.push_back(desc);
+        effect_durations_ms_.push_back(clip.total_duration_ms_);
+        effect_lookup_.emplace(key, effect);
+        // 按纹理ID插入绘制顺序，使同一纹理的特效相邻
+        auto pos = std::upper_bound(draw_order_.begin(), draw_order_.end(), effect, [this](ParticleEffectId a, ParticleEffectId b)
+                                    { return effects_[a].sprite_.texture_id_ < effects_[b].sprite_.texture_id_; });
+        draw_order_.insert(pos, effect);
+        effect_offsets_.resize(effects_.size() + 1);
+        return effect;
+    }
+
+    ParticleEffectId ParticleSystem::findEffect(entt::id_type key) const
+    {
+        auto it = effect_lookup_.find(key);
+        return it != effect_lookup_.end() ? it->second : INVALID_PARTICLE_EFFECT;
+    }
+
+    void ParticleSystem::emit(ParticleEffectId effect, const glm::vec2 &position, bool is_flipped)
+    {
+        if (effect >= effects_.size() || capacity_ == 0)
+        {
+            return;
+        }
+        std::size_t slot;
+        if (size_ < capacity_)
+        {
+            slot = (head_ + size_) % capacity_;
+            ++size_;
+        }
+        else
+        {
+            // 缓冲区已满：覆盖最旧的粒子，最旧位置后移一格
+            slot = head_;
+            head_ = (head_ + 1) % capacity_;
+            ++stats_.evicted_;
+        }
+        positions_[slot] = position;
+        ages_ms_[slot] = 0.0f;
+        effect_ids_[slot] = effect;
+        frames_[slot] = 0;
+        flipped_[slot] = is_flipped ? 1 : 0;
+        ++stats_.emitted_;
+    }
+
+    void ParticleSystem::update(float delta_time)
+    {
+        if (size_ == 0)
+        {
+            return;
+        }
+        const float dt_ms = delta_time * 1000.0f;
+        // 按从旧到新的顺序遍历，存活的粒子就地前移（保持环形缓冲区中的先后顺序）
+        std::size_t write = head_;
+        std::size_t alive = 0;
+        std::size_t read = head_;
+        for (std::size_t i = 0; i < size_; ++i)
+        {
+            const auto effect = effect_ids_[read];
+            const float age = ages_ms_[read] + dt_ms;
+            if (age < effect_durations_ms_[effect])
+            {
+                if (write != read)
+                {
+                    positions_[write] = positions_[read];
+                    effect_ids_[write] = effect;
+                    flipped_[write] = flipped_[read];
+                }
+                ages_ms_[write] = age;
+                frames_[write] = static_cast<std::uint16_t>(animation_library_.getClip(effects_[effect].clip_).frameAt(age));
+                write = write + 1 == capacity_ ? 0 : write + 1;
+                ++alive;
+            }
+            read = read + 1 == capacity_ ? 0 : read + 1;
+        }
+        stats_.expired_ += size_ - alive;
+        size_ = alive;
+    }
+
+    void ParticleSystem::render(engine::render::Renderer &renderer, const engine::render::Camera &camera)
+    {
+        if (size_ == 0)
+        {
+            return;
+        }
+        ENGINE_PROFILE_SCOPE("ParticleSystem::render");
+        // 计数排序：按特效分组，组内保持从旧到新的顺序（新粒子绘制在上面）
+        std::fill(effect_offsets_.begin(), effect_offsets_.end(), 0u);
+        for (std::size_t i = 0, slot = head_; i < size_; ++i, slot = slot + 1 == capacity_ ? 0 : slot + 1)
+        {
+            ++effect_offsets_[effect_ids_[slot] + 1];
+        }
+        for (std::size_t e = 1; e < effect_offsets_.size(); ++e)
+        {
+            effect_offsets_[e] += effect_offsets_[e - 1];
+        }
+        draw_list_.resize(size_);
+        for (std::size_t i = 0, slot = head_; i < size_; ++i, slot = slot + 1 == capacity_ ? 0 : slot + 1)
+        {
+            draw_list_[effect_offsets_[effect_ids_[slot]]++] = static_cast<std::uint32_t>(slot);
+        }
+        // 经过上面的递增，effect_offsets_[e] 为特效 e 的结束位置，e - 1 的结束位置即 e 的起始位置
+
+        // 按纹理顺序遍历特效，同一纹理的粒子连续绘制，由 Renderer 合并为一个批次
+        for (auto effect : draw_order_)
+        {
+            const auto begin = effect == 0 ? 0u : effect_offsets_[effect - 1];
+            const auto end = effect_offsets_[effect];
+            if (begin == end)
+            {
+                continue;
+            }
+            const auto &desc = effects_[effect];
+            const auto &clip = animation_library_.getClip(desc.clip_);
+            auto sprite = desc.sprite_;
+            for (auto i = begin; i < end; ++i)
+            {
+                const auto slot = draw_list_[i];
+                sprite.src_rect_ = clip.frames_[frames_[slot]].src_rect_;
+                sprite.is_flipped_ = flipped_[slot] != 0;
+                renderer.drawSprite(camera, sprite, positions_[slot] + desc.offset_, desc.size_);
+            }
+        }
+    }
+
+    void ParticleSystem::clear()
+    {
+        head_ = 0;
+        size_ = 0;
+    }
+
+} // namespace engine::system
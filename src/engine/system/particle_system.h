@@ -0,0 +1,126 @@
+#pragma once
+#include "../component/sprite_component.h"
+#include <glm/vec2.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+#include <entt/core/fwd.hpp>
+
+namespace engine::render
+{
+    class Renderer;
+    class Camera;
+}
+
+namespace engine::resource
+{
+    class AnimationLibrary;
+}
+
+namespace engine::system
+{
+
+    using ParticleEffectId = std::uint16_t; ///< @brief 粒子特效在 ParticleSystem 中的索引
+    inline constexpr ParticleEffectId INVALID_PARTICLE_EFFECT = std::numeric_limits<ParticleEffectId>::max();
+
+    /**
+     * @brief 粒子特效描述：一段只播放一次的动画片段，以及绘制所需的精灵信息（同种特效的所有粒子共享）
+     */
+    struct ParticleEffectDesc
+    {
+        engine::component::Sprite sprite_; ///< @brief 精灵（纹理句柄需要已解析，源矩形由动画帧决定）
+        glm::vec2 size_{0.0f};             ///< @brief 绘制大小
+        glm::vec2 offset_{0.0f};           ///< @brief 相对粒子位置的偏移
+        std::uint32_t clip_{};             ///< @brief 动画片段（AnimationLibrary 中的索引），播放完毕粒子即消失
+    };
+
+    /**
+     * @brief 粒子系统：短命的视觉特效（死亡、命中……）不创建实体，按 SoA 存放在固定容量的环形缓冲区中。
+     *
+     * - 粒子只有位置、年龄、特效与翻转状态，update 中顺序遍历几个连续数组，推进年龄、计算当前帧、移除播放完毕的粒子；
+     * - 容量是硬上限：缓冲区满时新粒子覆盖最旧的粒子（最旧的粒子最接近结束，丢掉它最不明显），
+     *   大量敌人同时死亡时开销不会超过容量对应的上限；
+     * - 绘制时按纹理分组，同一纹理的粒子连续绘制，由 Renderer 合并为一个批次（每种纹理一次绘制调用）。
+     *
+     * 特效在加载阶段登记，之后只读。非线程安全：emit/render 在主线程调用，update 可由调度器放到工作线程（声明资源 "particles"）。
+     */
+    class ParticleSystem final
+    {
+    public:
+        /// @brief 粒子系统的统计数据
+        struct Stats
+        {
+            std::size_t emitted_{0}; ///< @brief 累计发射的粒子数量
+            std::size_t evicted_{0}; ///< @brief 累计因容量已满被覆盖的粒子数量
+            std::size_t expired_{0}; ///< @brief 累计播放完毕的粒子数量
+        };
+
+    private:
+        const engine::resource::AnimationLibrary &animation_library_; ///< @brief 共享动画库（只读）
+
+        // --- 特效 ---
+        std::vector<ParticleEffectDesc> effects_;                         ///< @brief 已登记的特效
+        std::vector<float> effect_durations_ms_;                          ///< @brief 各特效的总时长（毫秒）
+        std::vector<ParticleEffectId> draw_order_;                        ///< @brief 按纹理排序的特效索引（同纹理的特效相邻）
+        std::unordered_map<entt::id_type, ParticleEffectId> effect_lookup_; ///< @brief 特效键 -> 特效索引
+
+        // --- 粒子（SoA 环形缓冲区，head_ 处为最旧的粒子） ---
+        std::size_t capacity_;
+        std::size_t head_{0};
+        std::size_t size_{0};
+        std::vector<glm::vec2> positions_;         ///< @brief 位置
+        std::vector<float> ages_ms_;               ///< @brief 年龄（毫秒）
+        std::vector<ParticleEffectId> effect_ids_; ///< @brief 所属特效
+        std::vector<std::uint16_t> frames_;        ///< @brief 当前帧索引（update 中计算）
+        std::vector<std::uint8_t> flipped_;        ///< @brief 是否翻转
+
+        // --- 绘制时的临时数组（复用，避免每帧分配） ---
+        std::vector<std::uint32_t> effect_offsets_; ///< @brief 计数排序用的各特效在 draw_list_ 中的偏移
+        std::vector<std::uint32_t> draw_list_;      ///< @brief 按特效分组的粒子槽位
+
+        Stats stats_;
+
+    public:
+        /**
+         * @brief 构造函数
+         * @param animation_library 共享动画库
+         * @param capacity 粒子数量上限（0 表示禁用粒子）
+         */
+        ParticleSystem(const engine::resource::AnimationLibrary &animation_library, std::size_t capacity);
+
+        ParticleSystem(const ParticleSystem &) = delete;
+        ParticleSystem &operator=(const ParticleSystem &) = delete;
+        ParticleSystem(ParticleSystem &&) = delete;
+        ParticleSystem &operator=(ParticleSystem &&) = delete;
+
+        /**
+         * @brief 登记特效
+         * @param key 特效键
+         * @param desc 特效描述
+         * @return 特效索引；键已存在时返回已有特效；动画片段无效时返回 INVALID_PARTICLE_EFFECT
+         */
+        ParticleEffectId registerEffect(entt::id_type key, const ParticleEffectDesc &desc);
+
+        /// @brief 查找特效，不存在时返回 INVALID_PARTICLE_EFFECT
+        [[nodiscard]] ParticleEffectId findEffect(entt::id_type key) const;
+
+        /**
+         * @brief 发射一个粒子（缓冲区满时覆盖最旧的粒子）
+         * @param effect 特效索引（无效时忽略）
+         * @param position 位置
+         * @param is_flipped 是否翻转
+         */
+        void emit(ParticleEffectId effect, const glm::vec2 &position, bool is_flipped = false);
+
+        void update(float delta_time);                                                         ///< @brief 推进粒子年龄，移除播放完毕的粒子
+        void render(engine::render::Renderer &renderer, const engine::render::Camera &camera); ///< @brief 按纹理分组绘制所有粒子
+        void clear();                                                                          ///< @brief 移除所有粒子（统计数据保留）
+
+        [[nodiscard]] std::size_t size() const { return size_; }         ///< @brief 当前存活的粒子数量
+        [[nodiscard]] std::size_t capacity() const { return capacity_; } ///< @brief 粒子数量上限
+        [[nodiscard]] const Stats &getStats() const { return stats_; }   ///< @brief 获取统计数据
+    };
+
+} // namespace engine::system
@@ -1,34 +1,69 @@
 #include "render_system.h"
 #include "../render/renderer.h"
 #include "../render/camera.h"
+#include "../render/render_queue.h"
 #include "../component/transform_component.h"
 #include "../component/sprite_component.h"
 #include "../component/render_component.h"
-#include <spdlog/spdlog.h>
+#include "../component/interpolation_component.h"
+#include "../debug/log.h"
+#include <glm/common.hpp>
+#include <algorithm>
 
 namespace engine::system
 {
 
-    void RenderSystem::update(entt::registry &registry, render::Renderer &renderer, const render::Camera &camera)
+    RenderSystem::RenderSystem(entt::registry &registry)
+        : registry_(registry), render_queue_(std::make_unique<render::RenderQueue>(registry))
     {
-        spdlog::trace("RenderSystem::update");
+    }
+
+    RenderSystem::~RenderSystem() = default;
+
+    void RenderSystem::update(render::Renderer &renderer, const render::Camera &camera, float alpha)
+    {
+        ENGINE_LOG_TRACE("RenderSystem::update");
 
-        // 对RenderComponent进行排序 (需要自定义RenderComponent的比较运算符)
-        registry.sort<component::RenderComponent>([](const auto &lhs, const auto &rhs)
-                                                  { return lhs < rhs; });
+        // 同步渲染队列（只对图层或深度发生变化的动态实体重新排序）
+        render_queue_->update();
 
-        // 执行渲染，注意排序组件RenderComponent必须放在最前面
-        auto view = registry.view<component::RenderComponent, component::TransformComponent, component::SpriteComponent>();
-        for (auto entity : view)
+        // 按渲染队列的顺序执行渲染
+        auto view = registry_.view<component::RenderComponent, component::TransformComponent, component::SpriteComponent>();
+        const auto &interpolation_storage = registry_.storage<component::InterpolationComponent>();
+        // 绘制图层小于 layer 的附加绘制（即在它们图层的实体全部绘制之后）
+        std::size_t next_overlay = 0;
+        auto draw_overlays_before = [&](int layer)
         {
+            for (; next_overlay < overlays_.size() && overlays_[next_overlay].first < layer; ++next_overlay)
+                overlays_[next_overlay].second(renderer, camera);
+        };
+        render_queue_->each([&](entt::entity entity)
+                            {
+            if (!view.contains(entity))
+                return;
             const auto &render = view.get<component::RenderComponent>(entity);
+            draw_overlays_before(render.layer);
             const auto &transform = view.get<component::TransformComponent>(entity);
             const auto &sprite = view.get<component::SpriteComponent>(entity);
             auto position = transform.position_ + sprite.offset_; // 位置 = 变换组件的位置 + 精灵的偏移
+            if (interpolation_storage.contains(entity))           // 固定步长模拟时，在上一个与当前tick的位置之间插值
+                position = glm::mix(interpolation_storage.get(entity).previous_position_, transform.position_, alpha) + sprite.offset_;
             auto size = sprite.size_ * transform.scale_;          // 大小 = 精灵的大小 * 变换组件的缩放
             // 绘制时应用Render组件中的颜色调整参数
-            renderer.drawSprite(camera, sprite.sprite_, position, size, transform.rotation_, render.color_);
-        }
+            renderer.drawSprite(camera, sprite.sprite_, position, size, transform.rotation_, render.color_); });
+        // 剩余的附加绘制（图层在所有实体之后）
+        for (; next_overlay < overlays_.size(); ++next_overlay)
+            overlays_[next_overlay].second(renderer, camera);
+        // 提交最后一个批次，保证之后直接使用SDL绘制的内容（如文字）不会被精灵覆盖
+        renderer.flush();
+    }
+
+    void RenderSystem::addLayerOverlay(int layer, LayerOverlay overlay)
+    {
+        // 插入到同一图层已有附加绘制之后，保持登记顺序
+        auto pos = std::upper_bound(overlays_.begin(), overlays_.end(), layer, [](int value, const auto &entry)
+                                    { return value < entry.first; });
+        overlays_.emplace(pos, layer, std::move(overlay));
     }
 
 } // namespace engine::system
\ No newline at end of file
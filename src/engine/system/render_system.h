@@ -1,9 +1,14 @@
 #pragma once
 #include <entt/entt.hpp>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
 
 namespace engine::render {
     class Renderer;
     class Camera;
+    class RenderQueue;
 }
 
 namespace engine::system {
@@ -13,17 +18,40 @@ namespace engine::system {
  * 
  * 负责遍历所有带有 TransformComponent 和 SpriteComponent 的实体，
  * 并使用 Renderer 将它们绘制到屏幕上。
+ * 绘制顺序由渲染队列(RenderQueue)增量维护，不再每帧对整个 RenderComponent 存储排序。
+ * 不是实体的可绘制内容（如粒子）可以登记为图层附加绘制，在指定图层的实体之后绘制。
  */
 class RenderSystem {
 public:
+    /// @brief 图层附加绘制函数
+    using LayerOverlay = std::function<void(render::Renderer&, const render::Camera&)>;
+
+private:
+    entt::registry& registry_;
+    std::unique_ptr<render::RenderQueue> render_queue_;   ///< @brief 渲染队列，维护绘制顺序
+    std::vector<std::pair<int, LayerOverlay>> overlays_;  ///< @brief 图层附加绘制（按图层排序）
+
+public:
+    explicit RenderSystem(entt::registry& registry);
+    ~RenderSystem();
+
     /**
      * @brief 更新渲染系统
      * 
-     * @param registry entt::registry 的引用
      * @param renderer Renderer 的引用
      * @param camera Camera 的引用
+     * @param alpha 渲染插值系数，带有 InterpolationComponent 的实体将绘制在上一个与当前tick位置之间（默认1.0，即当前位置）
      */
-    void update(entt::registry& registry, render::Renderer& renderer, const render::Camera& camera);
+    void update(render::Renderer& renderer, const render::Camera& camera, float alpha = 1.0f);
+
+    /**
+     * @brief 登记图层附加绘制
+     * @param layer 图层ID，在该图层的所有实体之后、下一个图层的实体之前绘制（同一图层按登记顺序）
+     * @param overlay 绘制函数
+     */
+    void addLayerOverlay(int layer, LayerOverlay overlay);
+
+    const render::RenderQueue& getRenderQueue() const { return *render_queue_; }   ///< @brief 获取渲染队列（可查询排序统计信息）
 };
 
 } // namespace engine::system 
\ No newline at end of file
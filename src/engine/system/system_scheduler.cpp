@@ -0,0 +1,347 @@
+#include "system_scheduler.h"
+#include "../debug/profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <spdlog/spdlog.h>
+
+namespace engine::system
+{
+
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        bool containsAccess(const auto &accesses, entt::id_type id)
+        {
+            return std::any_of(accesses.begin(), accesses.end(), [id](const auto &access)
+                               { return access.id_ == id; });
+        }
+    }
+
+    SystemScheduler::SystemScheduler(engine::core::JobSystem &job_system)
+        : job_system_(job_system)
+    {
+    }
+
+    SystemScheduler::~SystemScheduler() = default;
+
+    SystemScheduler::SystemBuilder SystemScheduler::add(const char *name, SystemFunc func)
+    {
+        if (built_)
+        {
+            spdlog::warn("SystemScheduler: 在 build() 之后注册系统 '{}'，将按注册顺序串行执行", name);
+            built_ = false;
+        }
+        auto &entry = systems_.emplace_back();
+        entry.name_ = name;
+        entry.func_ = std::move(func);
+        entry.zone_id_ = engine::debug::Profiler::zoneId(name);
+        return SystemBuilder(entry);
+    }
+
+    bool SystemScheduler::build(entt::registry &registry)
+    {
+        const auto count = systems_.size();
+        // before[a][b] != 0 表示 a 必须在 b 之前执行（含传递关系）
+        std::vector<std::vector<char>> before(count, std::vector<char>(count, 0));
+
+        auto find_system = [this](std::string_view name)
+        {
+            for (std::size_t i = 0; i < systems_.size(); ++i)
+            {
+                if (name == systems_[i].name_)
+                    return i;
+            }
+            return systems_.size();
+        };
+
+        // --- 显式约束 ---
+        bool ok = true;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const auto &system = systems_[i];
+            if (find_system(system.name_) != i)
+            {
+                spdlog::error("SystemScheduler: 系统名称 '{}' 重复", system.name_);
+                ok = false;
+            }
+            for (auto name : system.after_)
+            {
+                const auto j = find_system(name);
+                if (j == count || j == i)
+                {
+                    spdlog::error("SystemScheduler: 系统 '{}' 的约束 after('{}') 无效", system.name_, name);
+                    ok = false;
+                    continue;
+                }
+                before[j][i] = 1;
+            }
+            for (auto name : system.before_)
+            {
+                const auto j = find_system(name);
+                if (j == count || j == i)
+                {
+                    spdlog::error("SystemScheduler: 系统 '{}' 的约束 before('{}') 无效", system.name_, name);
+                    ok = false;
+                    continue;
+                }
+                before[i][j] = 1;
+            }
+            // 互斥系统按注册顺序把前后的系统分隔开
+            if (system.exclusive_)
+            {
+                for (std::size_t j = 0; j < count; ++j)
+                {
+                    if (j < i)
+                        before[j][i] = 1;
+                    else if (j > i)
+                        before[i][j] = 1;
+                }
+            }
+        }
+
+        // --- 传递闭包，检测环 ---
+        for (std::size_t k = 0; k < count; ++k)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (!before[i][k])
+                    continue;
+                for (std::size_t j = 0; j < count; ++j)
+                {
+                    if (before[k][j])
+                        before[i][j] = 1;
+                }
+            }
+        }
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (before[i][i])
+            {
+                spdlog::error("SystemScheduler: 系统 '{}' 处于顺序约束的环中", systems_[i].name_);
+                ok = false;
+            }
+        }
+        if (!ok)
+        {
+            spdlog::error("SystemScheduler: 依赖图构建失败，按注册顺序串行执行");
+            buildSerialFallback();
+            return false;
+        }
+
+        // --- 冲突但没有顺序约束的系统：按注册顺序执行 ---
+        std::size_t unordered_conflicts = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            for (std::size_t j = i + 1; j < count; ++j)
+            {
+                std::string_view resource;
+                if (before[i][j] || before[j][i] || !conflicts(systems_[i], systems_[j], resource))
+                    continue;
+#ifndef NDEBUG
+                spdlog::error("SystemScheduler: 系统 '{}' 与 '{}' 的声明冲突（'{}' 被写入），但没有顺序约束，按注册顺序执行",
+                              systems_[i].name_, systems_[j].name_, resource);
+#endif
+                ++unordered_conflicts;
+                // 加入 i -> j 并更新传递闭包
+                for (std::size_t x = 0; x < count; ++x)
+                {
+                    if (x != i && !before[x][i])
+                        continue;
+                    for (std::size_t y = 0; y < count; ++y)
+                    {
+                        if (y == j || before[j][y])
+                            before[x][y] = 1;
+                    }
+                }
+            }
+        }
+
+        // --- 传递约简：只保留直接前驱，减少每帧的依赖登记 ---
+        for (std::size_t j = 0; j < count; ++j)
+        {
+            auto &dependencies = systems_[j].dependencies_;
+            dependencies.clear();
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (!before[i][j])
+                    continue;
+                bool direct = true;
+                for (std::size_t k = 0; k < count && direct; ++k)
+                {
+                    direct = !(before[i][k] && before[k][j]);
+                }
+                if (direct)
+                    dependencies.push_back(i);
+            }
+        }
+
+        // 拓扑顺序：前驱越多越靠后（a 在 b 之前时，b 的前驱严格包含 a 的前驱），相同时按注册顺序
+        std::vector<std::size_t> ancestors(count, 0);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            for (std::size_t j = 0; j < count; ++j)
+                ancestors[j] += before[i][j];
+        }
+        order_.resize(count);
+        std::iota(order_.begin(), order_.end(), std::size_t{0});
+        std::stable_sort(order_.begin(), order_.end(), [&ancestors](std::size_t a, std::size_t b)
+                         { return ancestors[a] < ancestors[b]; });
+
+        // 预先创建所有声明的组件存储，避免并行执行时 view 惰性创建存储造成数据竞争
+        for (const auto &system : systems_)
+        {
+            for (auto prepare : system.preparers_)
+                prepare(registry);
+        }
+
+        computeStages();
+        built_ = true;
+        spdlog::info("SystemScheduler: 依赖图构建完成，{} 个系统，{} 层，最大宽度 {}",
+                     stats_.system_count_, stats_.stage_count_, stats_.max_width_);
+        if (unordered_conflicts > 0)
+        {
+            spdlog::warn("SystemScheduler: {} 处冲突缺少顺序约束，已按注册顺序执行", unordered_conflicts);
+        }
+        for (auto index : order_)
+        {
+            spdlog::debug("SystemScheduler: 第 {} 层: {}", systems_[index].stage_, systems_[index].name_);
+        }
+        return true;
+    }
+
+    void SystemScheduler::run(float delta_time)
+    {
+        if (!built_)
+        {
+            buildSerialFallback();
+        }
+
+        const auto start = Clock::now();
+        peak_running_.store(0, std::memory_order_relaxed);
+
+        if (job_system_.getWorkerCount() == 0)
+        {
+            // 没有工作线程时直接按拓扑顺序执行，省去任务调度的开销
+            for (auto index : order_)
+                runSystem(systems_[index], delta_time);
+        }
+        else
+        {
+            handles_.assign(systems_.size(), engine::core::JobHandle{});
+            std::vector<engine::core::JobHandle> dependencies;
+            for (auto index : order_)
+            {
+                auto &system = systems_[index];
+                dependencies.clear();
+                for (auto dependency : system.dependencies_)
+                    dependencies.push_back(handles_[dependency]);
+
+                auto task = [this, index, delta_time]()
+                { runSystem(systems_[index], delta_time); };
+                handles_[index] = system.main_thread_ ? job_system_.runOnMainThread(std::move(task), dependencies)
+                                                      : job_system_.submit(std::move(task), dependencies);
+            }
+            job_system_.waitAll(handles_);
+        }
+
+        const std::chrono::duration<double, std::milli> wall = Clock::now() - start;
+        stats_.wall_ms_ = wall.count();
+        stats_.serial_ms_ = 0.0;
+        for (const auto &system : systems_)
+            stats_.serial_ms_ += system.elapsed_ms_;
+        stats_.peak_running_ = peak_running_.load(std::memory_order_relaxed);
+
+        if (auto *profiler = engine::debug::Profiler::current())
+        {
+            profiler->setCounter("Sched stages", static_cast<std::int64_t>(stats_.stage_count_));
+            profiler->setCounter("Sched max width", static_cast<std::int64_t>(stats_.max_width_));
+            profiler->setCounter("Sched peak running", static_cast<std::int64_t>(stats_.peak_running_));
+            profiler->setCounter("Sched speedup x100", static_cast<std::int64_t>(stats_.getSpeedup() * 100.0f));
+        }
+    }
+
+    void SystemScheduler::runSystem(SystemEntry &system, float delta_time)
+    {
+        const auto running = running_.fetch_add(1, std::memory_order_relaxed) + 1;
+        auto peak = peak_running_.load(std::memory_order_relaxed);
+        while (running > peak && !peak_running_.compare_exchange_weak(peak, running, std::memory_order_relaxed))
+        {
+        }
+
+        const auto start = Clock::now();
+        {
+            // 以注册序号作为顺序键，系统内产生的数据（如暂存的事件）按系统顺序合并，与执行线程无关
+            const engine::core::JobSystem::OrderScope order_scope(static_cast<std::uint32_t>(&system - systems_.data()) + 1);
+#ifndef ENGINE_DISABLE_PROFILER
+            const engine::debug::ProfileScope scope(engine::debug::Profiler::current(), system.zone_id_, system.name_);
+#endif
+            system.func_(delta_time);
+        }
+        const std::chrono::duration<double, std::milli> elapsed = Clock::now() - start;
+        system.elapsed_ms_ = elapsed.count();
+
+        running_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void SystemScheduler::buildSerialFallback()
+    {
+        order_.resize(systems_.size());
+        std::iota(order_.begin(), order_.end(), std::size_t{0});
+        for (std::size_t i = 0; i < systems_.size(); ++i)
+        {
+            systems_[i].dependencies_.clear();
+            if (i > 0)
+                systems_[i].dependencies_.push_back(i - 1);
+        }
+        computeStages();
+        built_ = true;
+    }
+
+    void SystemScheduler::computeStages()
+    {
+        std::vector<std::size_t> widths;
+        for (auto index : order_)
+        {
+            auto &system = systems_[index];
+            system.stage_ = 0;
+            for (auto dependency : system.dependencies_)
+                system.stage_ = std::max(system.stage_, systems_[dependency].stage_ + 1);
+            if (system.stage_ >= widths.size())
+                widths.resize(system.stage_ + 1, 0);
+            ++widths[system.stage_];
+        }
+        stats_.system_count_ = systems_.size();
+        stats_.stage_count_ = widths.size();
+        stats_.max_width_ = widths.empty() ? 0 : *std::max_element(widths.begin(), widths.end());
+        stats_.avg_width_ = widths.empty() ? 0.0f : static_cast<float>(systems_.size()) / static_cast<float>(widths.size());
+    }
+
+    bool SystemScheduler::conflicts(const SystemEntry &a, const SystemEntry &b, std::string_view &resource)
+    {
+        if (a.exclusive_ || b.exclusive_)
+        {
+            resource = "exclusive";
+            return true;
+        }
+        for (const auto &write : a.writes_)
+        {
+            if (containsAccess(b.writes_, write.id_) || containsAccess(b.reads_, write.id_))
+            {
+                resource = write.name_;
+                return true;
+            }
+        }
+        for (const auto &write : b.writes_)
+        {
+            if (containsAccess(a.reads_, write.id_))
+            {
+                resource = write.name_;
+                return true;
+            }
+        }
+        return false;
+    }
+
+} // namespace engine::system
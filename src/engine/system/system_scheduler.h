@@ -0,0 +1,201 @@
+#pragma once
+#include "../core/job_system.h"
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <vector>
+#include <entt/core/hashed_string.hpp>
+#include <entt/core/type_info.hpp>
+#include <entt/entity/registry.hpp>
+
+namespace engine::system
+{
+
+    /**
+     * @brief 系统调度器：根据各系统声明的读写集合与顺序约束构建依赖图(DAG)，每帧把互不冲突的系统并行执行。
+     *
+     * 每个系统需要声明：
+     * - 读/写的组件类型（reads<T...>() / writes<T...>()），添加或移除某种组件也算写该组件；
+     * - 读/写的上下文资源（readsResource() / writesResource()），如 "dispatcher"、"spatial_grid"；
+     * - 显式的顺序约束（after() / before()）；
+     * - 会创建/销毁实体的系统标记为 exclusive()，它与所有系统互斥，按注册顺序成为前后系统的分界；
+     * - 只能在主线程执行的系统（如 UI、读取输入）标记为 mainThread()。
+     *
+     * 两个系统冲突：任一方为 exclusive，或一方写了另一方读/写的组件或资源。
+     * 冲突的系统之间必须能通过显式约束确定先后顺序，否则调试构建下报错，并按注册顺序执行。
+     *
+     * 依赖图在 build() 时构建一次；run() 每帧把系统作为任务提交给 JobSystem，
+     * 系统只等待它的直接前驱，因此没有依赖关系的系统会被不同的线程同时执行。
+     * 每个系统在顺序键 {注册序号 + 1, 0} 下执行（见 JobSystem::OrderKey）。
+     */
+    class SystemScheduler final
+    {
+    public:
+        using SystemFunc = std::function<void(float)>;
+
+        /// @brief 上一帧的并行统计数据
+        struct FrameStats
+        {
+            std::size_t system_count_{0}; ///< @brief 系统数量
+            std::size_t stage_count_{0};  ///< @brief 依赖图的层数（关键路径上的系统数）
+            std::size_t max_width_{0};    ///< @brief 单层最多的系统数量（理论最大并行度）
+            float avg_width_{0.0f};       ///< @brief 平均每层的系统数量
+            std::size_t peak_running_{0}; ///< @brief 本帧实际同时运行的系统数量峰值
+            double serial_ms_{0.0};       ///< @brief 所有系统耗时之和（串行执行所需时间）
+            double wall_ms_{0.0};         ///< @brief 实际经过的时间
+
+            /// @brief 加速比（串行耗时 / 实际耗时）
+            [[nodiscard]] float getSpeedup() const { return wall_ms_ > 0.0 ? static_cast<float>(serial_ms_ / wall_ms_) : 1.0f; }
+        };
+
+    private:
+        /// @brief 读写的组件或资源
+        struct Access
+        {
+            entt::id_type id_;      ///< @brief 组件类型哈希或资源名哈希
+            std::string_view name_; ///< @brief 用于日志
+        };
+
+        /// @brief 注册的系统
+        struct SystemEntry
+        {
+            const char *name_;                                   ///< @brief 系统名称（同时作为分析器区域名）
+            SystemFunc func_;                                    ///< @brief 系统的更新函数
+            std::size_t zone_id_{0};                             ///< @brief 分析器区域编号
+            std::vector<Access> reads_;                          ///< @brief 读取的组件/资源
+            std::vector<Access> writes_;                         ///< @brief 写入的组件/资源
+            std::vector<std::string_view> after_;                ///< @brief 必须在这些系统之后执行
+            std::vector<std::string_view> before_;               ///< @brief 必须在这些系统之前执行
+            std::vector<void (*)(entt::registry &)> preparers_;  ///< @brief 预先创建组件存储（避免并行时惰性创建）
+            bool exclusive_{false};                              ///< @brief 是否与所有系统互斥
+            bool main_thread_{false};                            ///< @brief 是否只能在主线程执行
+
+            std::vector<std::size_t> dependencies_; ///< @brief 直接前驱（build 后有效，已做传递约简）
+            std::size_t stage_{0};                  ///< @brief 所在层
+            double elapsed_ms_{0.0};                ///< @brief 上一帧的耗时
+        };
+
+    public:
+        /// @brief 用于链式声明系统的读写集合与约束
+        class SystemBuilder
+        {
+            friend class SystemScheduler;
+            SystemEntry &entry_;
+
+            explicit SystemBuilder(SystemEntry &entry) : entry_(entry) {}
+
+        public:
+            template <typename... Components>
+            SystemBuilder &reads()
+            {
+                (addComponent<Components>(entry_.reads_), ...);
+                return *this;
+            }
+
+            template <typename... Components>
+            SystemBuilder &writes()
+            {
+                (addComponent<Components>(entry_.writes_), ...);
+                return *this;
+            }
+
+            /// @param name 资源名称，必须是静态生命周期的字符串
+            SystemBuilder &readsResource(std::string_view name)
+            {
+                entry_.reads_.push_back({entt::hashed_string::value(name.data(), name.size()), name});
+                return *this;
+            }
+
+            /// @param name 资源名称，必须是静态生命周期的字符串
+            SystemBuilder &writesResource(std::string_view name)
+            {
+                entry_.writes_.push_back({entt::hashed_string::value(name.data(), name.size()), name});
+                return *this;
+            }
+
+            SystemBuilder &after(std::string_view system_name)  ///< @brief 在指定系统之后执行
+            {
+                entry_.after_.push_back(system_name);
+                return *this;
+            }
+
+            SystemBuilder &before(std::string_view system_name) ///< @brief 在指定系统之前执行
+            {
+                entry_.before_.push_back(system_name);
+                return *this;
+            }
+
+            SystemBuilder &exclusive()  ///< @brief 会创建/销毁实体：与所有系统互斥
+            {
+                entry_.exclusive_ = true;
+                return *this;
+            }
+
+            SystemBuilder &mainThread() ///< @brief 只能在主线程执行
+            {
+                entry_.main_thread_ = true;
+                return *this;
+            }
+
+        private:
+            template <typename Component>
+            void addComponent(std::vector<Access> &accesses)
+            {
+                accesses.push_back({entt::type_hash<Component>::value(), entt::type_name<Component>::value()});
+                entry_.preparers_.push_back(+[](entt::registry &registry)
+                                            { registry.storage<Component>(); });
+            }
+        };
+
+    private:
+        engine::core::JobSystem &job_system_;
+        std::vector<SystemEntry> systems_;  ///< @brief 按注册顺序排列
+        std::vector<std::size_t> order_;    ///< @brief 拓扑排序后的执行顺序
+        std::vector<engine::core::JobHandle> handles_; ///< @brief 本帧各系统的任务句柄（按注册顺序索引）
+        bool built_{false};
+
+        FrameStats stats_;
+        std::atomic<std::size_t> running_{0};      ///< @brief 正在运行的系统数量
+        std::atomic<std::size_t> peak_running_{0}; ///< @brief 本帧同时运行的系统数量峰值
+
+    public:
+        explicit SystemScheduler(engine::core::JobSystem &job_system);
+        ~SystemScheduler();
+
+        SystemScheduler(const SystemScheduler &) = delete;
+        SystemScheduler &operator=(const SystemScheduler &) = delete;
+        SystemScheduler(SystemScheduler &&) = delete;
+        SystemScheduler &operator=(SystemScheduler &&) = delete;
+
+        /**
+         * @brief 注册系统（应在 build() 之前调用，之后注册会使调度器退化为串行执行）
+         * @param name 系统名称，必须是静态生命周期的字符串（如字符串字面量），同时作为分析器的区域名
+         * @param func 系统的更新函数，参数为 delta_time
+         * @return 用于声明读写集合与约束的构建器（只在当前语句中有效）
+         */
+        SystemBuilder add(const char *name, SystemFunc func);
+
+        /**
+         * @brief 构建依赖图，并预先创建所有声明的组件存储
+         * @param registry 系统使用的注册表
+         * @return 是否成功（约束中有未知系统或存在环时失败，此时按注册顺序串行执行）
+         */
+        [[nodiscard]] bool build(entt::registry &registry);
+
+        /**
+         * @brief 执行所有系统，阻塞直到全部完成（只能在主线程调用）
+         * @param delta_time 增量时间
+         */
+        void run(float delta_time);
+
+        const FrameStats &getFrameStats() const { return stats_; } ///< @brief 获取上一帧的并行统计数据
+
+    private:
+        void runSystem(SystemEntry &system, float delta_time); ///< @brief 执行单个系统并记录耗时
+        void buildSerialFallback();                            ///< @brief 构建失败时退化为按注册顺序串行执行
+        void computeStages();                                  ///< @brief 计算每个系统所在的层与层宽度统计
+        [[nodiscard]] static bool conflicts(const SystemEntry &a, const SystemEntry &b, std::string_view &resource);
+    };
+
+} // namespace engine::system
@@ -8,13 +8,15 @@ namespace engine::system
 
     void YSortSystem::update(entt::registry &registry)
     {
-        // 让RenderComponent的深度depth等于TransformComponent的y坐标
-        auto view = registry.view<component::RenderComponent, const component::TransformComponent>();
+        // 让RenderComponent的深度depth等于TransformComponent的y坐标（静态实体不会移动，跳过）
+        auto view = registry.view<component::RenderComponent, const component::TransformComponent>(entt::exclude<component::StaticRenderTag>);
         for (auto entity : view)
         {
             auto &render = view.get<component::RenderComponent>(entity);
             const auto &transform = view.get<const component::TransformComponent>(entity);
-            render.depth = transform.position_.y;
+            // 只在深度确实变化时写入，避免无谓的写操作
+            if (render.depth != transform.position_.y)
+                render.depth = transform.position_.y;
         }
     }
 
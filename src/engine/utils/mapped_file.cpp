@@ -0,0 +1,152 @@
+#include "mapped_file.h"
+#include <string>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace engine::utils
+{
+
+    MappedFile::~MappedFile()
+    {
+        close();
+    }
+
+    MappedFile::MappedFile(MappedFile &&other) noexcept
+    {
+        swap(other);
+    }
+
+    MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            swap(other);
+        }
+        return *this;
+    }
+
+    void MappedFile::swap(MappedFile &other) noexcept
+    {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(is_open_, other.is_open_);
+#ifdef _WIN32
+        std::swap(file_handle_, other.file_handle_);
+        std::swap(mapping_handle_, other.mapping_handle_);
+#endif
+    }
+
+#ifdef _WIN32
+
+    bool MappedFile::open(std::string_view path)
+    {
+        close();
+        // 路径为 UTF-8，转换为宽字符后打开，以支持非 ASCII 路径
+        const int length = MultiByteToWideChar(CP_UTF8, 0, path.data(), static_cast<int>(path.size()), nullptr, 0);
+        std::wstring wide_path(static_cast<std::size_t>(length), L'\0');
+        MultiByteToWideChar(CP_UTF8, 0, path.data(), static_cast<int>(path.size()), wide_path.data(), length);
+
+        HANDLE file = CreateFileW(wide_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+        LARGE_INTEGER file_size{};
+        if (!GetFileSizeEx(file, &file_size))
+        {
+            CloseHandle(file);
+            return false;
+        }
+        file_handle_ = file;
+        is_open_ = true;
+        if (file_size.QuadPart == 0)
+            return true; // 空文件不能创建映射
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr)
+        {
+            close();
+            return false;
+        }
+        mapping_handle_ = mapping;
+        data_ = static_cast<const std::byte *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        if (data_ == nullptr)
+        {
+            close();
+            return false;
+        }
+        size_ = static_cast<std::size_t>(file_size.QuadPart);
+        return true;
+    }
+
+    void MappedFile::close()
+    {
+        if (data_)
+            UnmapViewOfFile(data_);
+        if (mapping_handle_)
+            CloseHandle(static_cast<HANDLE>(mapping_handle_));
+        if (file_handle_)
+            CloseHandle(static_cast<HANDLE>(file_handle_));
+        data_ = nullptr;
+        size_ = 0;
+        is_open_ = false;
+        mapping_handle_ = nullptr;
+        file_handle_ = nullptr;
+    }
+
+#else
+
+    bool MappedFile::open(std::string_view path)
+    {
+        close();
+        const int fd = ::open(std::string(path).c_str(), O_RDONLY);
+        if (fd < 0)
+            return false;
+        struct stat file_stat{};
+        if (::fstat(fd, &file_stat) != 0)
+        {
+            ::close(fd);
+            return false;
+        }
+        if (file_stat.st_size > 0)
+        {
+            void *address = ::mmap(nullptr, static_cast<std::size_t>(file_stat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (address == MAP_FAILED)
+            {
+                ::close(fd);
+                return false;
+            }
+            data_ = static_cast<const std::byte *>(address);
+            size_ = static_cast<std::size_t>(file_stat.st_size);
+        }
+        ::close(fd); // 映射建立后不再需要文件描述符
+        is_open_ = true;
+        return true;
+    }
+
+    void MappedFile::close()
+    {
+        if (data_)
+            ::munmap(const_cast<std::byte *>(data_), size_);
+        data_ = nullptr;
+        size_ = 0;
+        is_open_ = false;
+    }
+
+#endif
+
+} // namespace engine::utils
@@ -0,0 +1,48 @@
+#pragma once
+#include <cstddef>
+#include <string_view>
+
+namespace engine::utils
+{
+
+    /**
+     * @brief 只读内存映射文件：把整个文件映射到进程地址空间，由操作系统按需读入页面，不需要复制到缓冲区。
+     *
+     * 只支持移动，析构时解除映射。空文件可以打开，但 data() 为空指针。
+     */
+    class MappedFile final
+    {
+        const std::byte *data_{nullptr};
+        std::size_t size_{0};
+        bool is_open_{false};
+#ifdef _WIN32
+        void *file_handle_{nullptr};    ///< @brief 文件句柄（HANDLE）
+        void *mapping_handle_{nullptr}; ///< @brief 文件映射句柄（HANDLE）
+#endif
+
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+        MappedFile(MappedFile &&other) noexcept;
+        MappedFile &operator=(MappedFile &&other) noexcept;
+
+        /**
+         * @brief 映射文件（会先关闭之前映射的文件）
+         * @param path 文件路径
+         * @return true 成功，false 失败（文件不存在或无法映射）
+         */
+        [[nodiscard]] bool open(std::string_view path);
+        void close(); ///< @brief 解除映射
+
+        [[nodiscard]] bool isOpen() const { return is_open_; }
+        [[nodiscard]] const std::byte *data() const { return data_; }
+        [[nodiscard]] std::size_t size() const { return size_; }
+
+    private:
+        void swap(MappedFile &other) noexcept;
+    };
+
+} // namespace engine::utils
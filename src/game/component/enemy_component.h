@@ -1,12 +1,13 @@
 #pragma once
+#include <cstdint>
 
 namespace game::component {
 
 /**
- * @brief 敌人组件，包含目标节点ID和自身速度。
+ * @brief 敌人组件，包含目标节点索引和自身速度。
  */
 struct EnemyComponent {
-    int target_waypoint_id_;
+    std::uint32_t target_waypoint_index_;   ///< @brief 目标节点在路径图（WaypointGraph）中的索引
     float speed_;
 };
 
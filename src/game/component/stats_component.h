@@ -6,7 +6,7 @@ namespace game::component
     /**
      * @brief 属性组件
      * 用于存储角色的属性，包括生命值、攻击力、防御力、
-     * 攻击范围、攻击间隔、攻击计时器、等级和稀有度。
+     * 攻击范围、攻击间隔、等级和稀有度。（攻击冷却的计时由 TimerSystem 的定时器调度器负责）
      */
     struct StatsComponent
     {
@@ -16,7 +16,6 @@ namespace game::component
         float def_{};
         float range_{};        // 攻击范围（射程）
         float atk_interval_{}; // 攻击间隔（决定攻速）
-        float atk_timer_{};    // 攻击计时器
         int level_{1};
         int rarity_{1}; // 稀有度，从1开始（例如1:普通，2:稀有，3:史诗，4:传说，5:神话...）
     };
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstdint>
+
+namespace game::component
+{
+
+    using UnitStateFlags = std::uint8_t; ///< @brief 单位状态位集合
+
+    /**
+     * @brief 单位状态组件，用位标志存储高频切换的瞬时状态（可攻击、动作锁定、受伤）。
+     *
+     * 这些状态每秒会在每个单位上切换多次，如果用标签组件表示，每次切换都是一次稀疏集合的插入/删除
+     * （交换元素位置、打乱存储顺序）；改为位标志后切换只是修改一个字节，存储保持不变。
+     * 所有拥有 StatsComponent 的单位都会同时拥有该组件（见 EntityFactory::addStatsComponent）。
+     * 按状态筛选实体可使用 game/utils/unit_state_view.h 中的辅助函数。
+     *
+     * 注：死亡只发生一次且需要被大量 view 排除，仍使用 DeadTag 标签。
+     */
+    struct UnitStateComponent
+    {
+        static constexpr UnitStateFlags ATTACK_READY = 1u << 0; ///< @brief 可攻击（攻击冷却完毕）
+        static constexpr UnitStateFlags ACTION_LOCK = 1u << 1;  ///< @brief 动作锁定，播放完当前动画再进行下一步动作（硬直）
+        static constexpr UnitStateFlags INJURED = 1u << 2;      ///< @brief 受伤（有HP损失）
+
+        UnitStateFlags flags_{0};
+
+        [[nodiscard]] bool has(UnitStateFlags flags) const { return (flags_ & flags) == flags; } ///< @brief 是否包含全部指定状态
+        [[nodiscard]] bool hasAny(UnitStateFlags flags) const { return (flags_ & flags) != 0; } ///< @brief 是否包含任一指定状态
+        void set(UnitStateFlags flags) { flags_ |= flags; }                                    ///< @brief 添加状态
+        void clear(UnitStateFlags flags) { flags_ &= static_cast<UnitStateFlags>(~flags); }    ///< @brief 移除状态
+    };
+
+} // namespace game::component
@@ -0,0 +1,254 @@
+#include "projectile_store.h"
+#include "../component/projectile_component.h"
+#include <entt/entity/registry.hpp>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MW_PROJECTILE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace game::data
+{
+
+    namespace
+    {
+        constexpr float PI = 3.14159265358979f;
+        constexpr float HALF_PI = 1.57079632679490f;
+        constexpr float RAD_TO_DEG = 57.2957795130823f;
+
+        // sin(πt)，t ∈ [0, 1]：令 x = π(t - 0.5) ∈ [-π/2, π/2]，sin(πt) = cos(x)，用泰勒展开到 x^8
+        constexpr float COS_C2 = -1.0f / 2.0f;
+        constexpr float COS_C4 = 1.0f / 24.0f;
+        constexpr float COS_C6 = -1.0f / 720.0f;
+        constexpr float COS_C8 = 1.0f / 40320.0f;
+
+        // atan(a)，a ∈ [0, 1] 的多项式近似（奇函数，系数为极小化最大误差拟合）
+        constexpr float ATAN_C1 = 0.99997726f;
+        constexpr float ATAN_C3 = -0.33262347f;
+        constexpr float ATAN_C5 = 0.19354346f;
+        constexpr float ATAN_C7 = -0.11643287f;
+        constexpr float ATAN_C9 = 0.05265332f;
+        constexpr float ATAN_C11 = -0.01172120f;
+
+        /// @brief 避免 0/0（方向为零向量时朝向为0，与 atan2(0, 0) 相同）
+        constexpr float MIN_DENOMINATOR = 1e-30f;
+
+        inline float sinPi(float t)
+        {
+            const float x = PI * (t - 0.5f);
+            const float x2 = x * x;
+            return 1.0f + x2 * (COS_C2 + x2 * (COS_C4 + x2 * (COS_C6 + x2 * COS_C8)));
+        }
+
+        inline float atan2Degrees(float y, float x)
+        {
+            const float ax = std::abs(x);
+            const float ay = std::abs(y);
+            const float a = std::min(ax, ay) / std::max(std::max(ax, ay), MIN_DENOMINATOR);
+            const float s = a * a;
+            float r = a * (ATAN_C1 + s * (ATAN_C3 + s * (ATAN_C5 + s * (ATAN_C7 + s * (ATAN_C9 + s * ATAN_C11)))));
+            if (ay > ax)
+                r = HALF_PI - r;
+            if (x < 0.0f)
+                r = PI - r;
+            if (y < 0.0f)
+                r = -r;
+            return r * RAD_TO_DEG;
+        }
+
+#ifdef MW_PROJECTILE_SSE2
+        inline __m128 select(__m128 mask, __m128 a, __m128 b) ///< @brief mask ? a : b
+        {
+            return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+        }
+
+        inline __m128 sinPi4(__m128 t)
+        {
+            const __m128 x = _mm_mul_ps(_mm_set1_ps(PI), _mm_sub_ps(t, _mm_set1_ps(0.5f)));
+            const __m128 x2 = _mm_mul_ps(x, x);
+            __m128 r = _mm_add_ps(_mm_set1_ps(COS_C6), _mm_mul_ps(x2, _mm_set1_ps(COS_C8)));
+            r = _mm_add_ps(_mm_set1_ps(COS_C4), _mm_mul_ps(x2, r));
+            r = _mm_add_ps(_mm_set1_ps(COS_C2), _mm_mul_ps(x2, r));
+            return _mm_add_ps(_mm_set1_ps(1.0f), _mm_mul_ps(x2, r));
+        }
+
+        inline __m128 atan2Degrees4(__m128 y, __m128 x)
+        {
+            const __m128 sign_bit = _mm_set1_ps(-0.0f);
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 ax = _mm_andnot_ps(sign_bit, x);
+            const __m128 ay = _mm_andnot_ps(sign_bit, y);
+            const __m128 a = _mm_div_ps(_mm_min_ps(ax, ay), _mm_max_ps(_mm_max_ps(ax, ay), _mm_set1_ps(MIN_DENOMINATOR)));
+            const __m128 s = _mm_mul_ps(a, a);
+            __m128 r = _mm_add_ps(_mm_set1_ps(ATAN_C9), _mm_mul_ps(s, _mm_set1_ps(ATAN_C11)));
+            r = _mm_add_ps(_mm_set1_ps(ATAN_C7), _mm_mul_ps(s, r));
+            r = _mm_add_ps(_mm_set1_ps(ATAN_C5), _mm_mul_ps(s, r));
+            r = _mm_add_ps(_mm_set1_ps(ATAN_C3), _mm_mul_ps(s, r));
+            r = _mm_mul_ps(a, _mm_add_ps(_mm_set1_ps(ATAN_C1), _mm_mul_ps(s, r)));
+            r = select(_mm_cmpgt_ps(ay, ax), _mm_sub_ps(_mm_set1_ps(HALF_PI), r), r);
+            r = select(_mm_cmplt_ps(x, zero), _mm_sub_ps(_mm_set1_ps(PI), r), r);
+            r = select(_mm_cmplt_ps(y, zero), _mm_xor_ps(r, sign_bit), r);
+            return _mm_mul_ps(r, _mm_set1_ps(RAD_TO_DEG));
+        }
+#endif
+    }
+
+    ProjectileStore::ProjectileStore(entt::registry &registry) : registry_(registry)
+    {
+        registry_.on_construct<game::component::ProjectileComponent>().connect<&ProjectileStore::onProjectileConstruct>(this);
+        registry_.on_destroy<game::component::ProjectileComponent>().connect<&ProjectileStore::onProjectileDestroy>(this);
+
+        // 收录构造之前就已经存在的投射物
+        for (auto entity : registry_.view<game::component::ProjectileComponent>())
+        {
+            onProjectileConstruct(registry_, entity);
+        }
+    }
+
+    ProjectileStore::~ProjectileStore()
+    {
+        registry_.on_construct<game::component::ProjectileComponent>().disconnect<&ProjectileStore::onProjectileConstruct>(this);
+        registry_.on_destroy<game::component::ProjectileComponent>().disconnect<&ProjectileStore::onProjectileDestroy>(this);
+    }
+
+    void ProjectileStore::advance(float delta_time, std::vector<std::uint32_t> &hits)
+    {
+        hits.clear();
+        const auto count = static_cast<std::uint32_t>(entities_.size());
+        std::uint32_t i = 0;
+#ifdef MW_PROJECTILE_SSE2
+        const __m128 dt = _mm_set1_ps(delta_time);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 elapsed = _mm_add_ps(_mm_loadu_ps(&elapsed_[i]), dt);
+            _mm_storeu_ps(&elapsed_[i], elapsed);
+            // 飞行时间结束即命中，命中的投射物保持原来的位置与朝向
+            const __m128 hit = _mm_cmpge_ps(elapsed, _mm_loadu_ps(&flight_time_[i]));
+            if (int hit_bits = _mm_movemask_ps(hit); hit_bits != 0)
+            {
+                for (std::uint32_t lane = 0; lane < 4; ++lane)
+                    if (hit_bits & (1 << lane))
+                        hits.push_back(i + lane);
+            }
+
+            // 飞行进度 t ∈ [0, 1]：水平方向线性插值，垂直方向减去 sin(πt) * 弧高（Y轴向下为正，减去偏移使其向上拱起）
+            const __m128 t = _mm_min_ps(_mm_max_ps(_mm_mul_ps(elapsed, _mm_loadu_ps(&inv_flight_time_[i])), zero), one);
+            const __m128 x = _mm_add_ps(_mm_loadu_ps(&start_x_[i]), _mm_mul_ps(_mm_loadu_ps(&delta_x_[i]), t));
+            const __m128 y = _mm_sub_ps(_mm_add_ps(_mm_loadu_ps(&start_y_[i]), _mm_mul_ps(_mm_loadu_ps(&delta_y_[i]), t)),
+                                        _mm_mul_ps(sinPi4(t), _mm_loadu_ps(&arc_height_[i])));
+
+            // 朝向由上一位置指向当前位置
+            const __m128 previous_x = _mm_loadu_ps(&position_x_[i]);
+            const __m128 previous_y = _mm_loadu_ps(&position_y_[i]);
+            const __m128 rotation = atan2Degrees4(_mm_sub_ps(y, previous_y), _mm_sub_ps(x, previous_x));
+
+            _mm_storeu_ps(&position_x_[i], select(hit, previous_x, x));
+            _mm_storeu_ps(&position_y_[i], select(hit, previous_y, y));
+            _mm_storeu_ps(&rotation_[i], select(hit, _mm_loadu_ps(&rotation_[i]), rotation));
+        }
+#endif
+        // 剩余的（或不支持 SSE2 时全部）逐个计算，公式与上面相同
+        for (; i < count; ++i)
+        {
+            elapsed_[i] += delta_time;
+            if (elapsed_[i] >= flight_time_[i])
+            {
+                hits.push_back(i);
+                continue;
+            }
+            const float t = std::clamp(elapsed_[i] * inv_flight_time_[i], 0.0f, 1.0f);
+            const float x = start_x_[i] + delta_x_[i] * t;
+            const float y = start_y_[i] + delta_y_[i] * t - sinPi(t) * arc_height_[i];
+            rotation_[i] = atan2Degrees(y - position_y_[i], x - position_x_[i]);
+            position_x_[i] = x;
+            position_y_[i] = y;
+        }
+    }
+
+    void ProjectileStore::removeHits(const std::vector<std::uint32_t> &hits)
+    {
+        // 从后往前移除：被移来填补空位的最后一个条目不会是尚未处理的命中条目
+        for (auto it = hits.rbegin(); it != hits.rend(); ++it)
+        {
+            removeAt(*it);
+        }
+    }
+
+    void ProjectileStore::onProjectileConstruct(entt::registry &registry, entt::entity entity)
+    {
+        const auto &projectile = registry.get<game::component::ProjectileComponent>(entity);
+        const auto entity_index = static_cast<std::size_t>(entt::to_entity(entity));
+        if (entity_index >= sparse_.size())
+        {
+            sparse_.resize(entity_index + 1, INVALID_INDEX);
+        }
+        if (sparse_[entity_index] != INVALID_INDEX)
+        {
+            spdlog::warn("ProjectileStore: 实体 {} 已在存储中，忽略重复添加", entt::to_integral(entity));
+            return;
+        }
+        sparse_[entity_index] = static_cast<std::uint32_t>(entities_.size());
+        entities_.push_back(entity);
+        start_x_.push_back(projectile.start_position_.x);
+        start_y_.push_back(projectile.start_position_.y);
+        delta_x_.push_back(projectile.target_position_.x - projectile.start_position_.x);
+        delta_y_.push_back(projectile.target_position_.y - projectile.start_position_.y);
+        arc_height_.push_back(projectile.arc_height_);
+        flight_time_.push_back(projectile.total_flight_time_);
+        inv_flight_time_.push_back(projectile.total_flight_time_ > 0.0f ? 1.0f / projectile.total_flight_time_ : 0.0f);
+        elapsed_.push_back(0.0f);
+        position_x_.push_back(projectile.start_position_.x);
+        position_y_.push_back(projectile.start_position_.y);
+        rotation_.push_back(0.0f);
+    }
+
+    void ProjectileStore::onProjectileDestroy(entt::registry &, entt::entity entity)
+    {
+        // 命中的条目已经在 removeHits() 中移除
+        const auto entity_index = static_cast<std::size_t>(entt::to_entity(entity));
+        if (entity_index < sparse_.size() && sparse_[entity_index] != INVALID_INDEX)
+        {
+            removeAt(sparse_[entity_index]);
+        }
+    }
+
+    void ProjectileStore::removeAt(std::uint32_t index)
+    {
+        const auto last = static_cast<std::uint32_t>(entities_.size() - 1);
+        sparse_[static_cast<std::size_t>(entt::to_entity(entities_[index]))] = INVALID_INDEX;
+        if (index != last)
+        {
+            entities_[index] = entities_[last];
+            start_x_[index] = start_x_[last];
+            start_y_[index] = start_y_[last];
+            delta_x_[index] = delta_x_[last];
+            delta_y_[index] = delta_y_[last];
+            arc_height_[index] = arc_height_[last];
+            flight_time_[index] = flight_time_[last];
+            inv_flight_time_[index] = inv_flight_time_[last];
+            elapsed_[index] = elapsed_[last];
+            position_x_[index] = position_x_[last];
+            position_y_[index] = position_y_[last];
+            rotation_[index] = rotation_[last];
+            sparse_[static_cast<std::size_t>(entt::to_entity(entities_[index]))] = index;
+        }
+        entities_.pop_back();
+        start_x_.pop_back();
+        start_y_.pop_back();
+        delta_x_.pop_back();
+        delta_y_.pop_back();
+        arc_height_.pop_back();
+        flight_time_.pop_back();
+        inv_flight_time_.pop_back();
+        elapsed_.pop_back();
+        position_x_.pop_back();
+        position_y_.pop_back();
+        rotation_.pop_back();
+    }
+
+} // namespace game::data
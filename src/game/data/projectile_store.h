@@ -0,0 +1,75 @@
+#pragma once
+#include <entt/entity/fwd.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace game::data
+{
+
+    /**
+     * @brief 飞行中投射物的紧凑存储（SoA），供 ProjectileSystem 批量计算弹道。
+     *
+     * 通过注册表信号跟随 ProjectileComponent 的添加/移除自动维护（类似 RenderQueue）：
+     * 添加组件时从组件中复制起点、目标点、弧高与飞行时间，之后的飞行状态（已飞行时间、当前位置）只保存在这里。
+     * 条目在数组中连续存放，移除时用最后一个条目填补空位；实体到条目的映射按实体索引存放在稀疏数组中。
+     *
+     * advance() 每次处理 4 个投射物（SSE2，不支持时退回到逐个计算），正弦与反正切使用多项式近似：
+     * - sin(πt) 在 [0, 1] 上的误差小于 5e-5（弧高 100 像素时约 0.005 像素）；
+     * - 朝向角的误差小于 0.001 度。
+     *
+     * 信号回调与 advance() 都会修改存储，两者不能同时执行（信号只在主线程的事件处理与同步点中触发）。
+     */
+    class ProjectileStore final
+    {
+        static constexpr std::uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+        entt::registry &registry_;
+        std::vector<entt::entity> entities_;   ///< @brief 条目对应的实体
+        std::vector<float> start_x_;           ///< @brief 起点x
+        std::vector<float> start_y_;           ///< @brief 起点y
+        std::vector<float> delta_x_;           ///< @brief 目标点 - 起点（x）
+        std::vector<float> delta_y_;           ///< @brief 目标点 - 起点（y）
+        std::vector<float> arc_height_;        ///< @brief 弧线高度(即正弦函数振幅)
+        std::vector<float> flight_time_;       ///< @brief 总飞行时间
+        std::vector<float> inv_flight_time_;   ///< @brief 总飞行时间的倒数
+        std::vector<float> elapsed_;           ///< @brief 已飞行时间
+        std::vector<float> position_x_;        ///< @brief 当前位置x（也是计算下一次朝向用的上一位置）
+        std::vector<float> position_y_;        ///< @brief 当前位置y
+        std::vector<float> rotation_;          ///< @brief 朝向（角度）
+        std::vector<std::uint32_t> sparse_;    ///< @brief 实体索引 -> 条目索引
+
+    public:
+        explicit ProjectileStore(entt::registry &registry);
+        ~ProjectileStore();
+
+        ProjectileStore(const ProjectileStore &) = delete;
+        ProjectileStore &operator=(const ProjectileStore &) = delete;
+        ProjectileStore(ProjectileStore &&) = delete;
+        ProjectileStore &operator=(ProjectileStore &&) = delete;
+
+        /**
+         * @brief 推进所有投射物的飞行
+         * @param delta_time 时间步长（秒）
+         * @param hits 输出：本次飞行结束（命中）的条目索引（升序）。这些条目的位置与朝向保持不变，
+         *             调用者处理完后应调用 removeHits() 移除
+         */
+        void advance(float delta_time, std::vector<std::uint32_t> &hits);
+
+        /// @brief 移除命中的条目（hits 需要为 advance() 输出的升序索引）
+        void removeHits(const std::vector<std::uint32_t> &hits);
+
+        // --- getters ---
+        [[nodiscard]] std::size_t size() const { return entities_.size(); }
+        [[nodiscard]] entt::entity getEntity(std::uint32_t index) const { return entities_[index]; }
+        [[nodiscard]] float getPositionX(std::uint32_t index) const { return position_x_[index]; }
+        [[nodiscard]] float getPositionY(std::uint32_t index) const { return position_y_[index]; }
+        [[nodiscard]] float getRotation(std::uint32_t index) const { return rotation_[index]; }
+
+    private:
+        void onProjectileConstruct(entt::registry &registry, entt::entity entity); ///< @brief ProjectileComponent 添加时加入存储
+        void onProjectileDestroy(entt::registry &registry, entt::entity entity);   ///< @brief ProjectileComponent 移除时从存储中移除
+        void removeAt(std::uint32_t index);                                        ///< @brief 移除条目（用最后一个条目填补）
+    };
+
+} // namespace game::data
@@ -0,0 +1,78 @@
+#include "waypoint_graph.h"
+#include <algorithm>
+#include <spdlog/spdlog.h>
+
+namespace game::data
+{
+
+    bool WaypointGraph::build(const std::unordered_map<int, WaypointNode> &waypoint_nodes, const std::vector<int> &start_ids)
+    {
+        clear();
+
+        // 按ID升序编号，保证同一张地图每次编译得到的索引一致
+        node_ids_.reserve(waypoint_nodes.size());
+        for (const auto &[id, node] : waypoint_nodes)
+        {
+            node_ids_.push_back(id);
+        }
+        std::sort(node_ids_.begin(), node_ids_.end());
+
+        // 编译期使用的 ID -> 索引 映射，运行时不再需要
+        std::unordered_map<int, std::uint32_t> id_to_index;
+        id_to_index.reserve(node_ids_.size());
+        for (std::uint32_t i = 0; i < node_ids_.size(); ++i)
+        {
+            id_to_index[node_ids_[i]] = i;
+        }
+
+        position_x_.reserve(node_ids_.size());
+        position_y_.reserve(node_ids_.size());
+        next_offsets_.reserve(node_ids_.size() + 1);
+        next_offsets_.push_back(0);
+        for (auto id : node_ids_)
+        {
+            const auto &node = waypoint_nodes.at(id);
+            position_x_.push_back(node.position_.x);
+            position_y_.push_back(node.position_.y);
+            for (auto next_id : node.next_node_ids_)
+            {
+                auto it = id_to_index.find(next_id);
+                if (it == id_to_index.end())
+                {
+                    spdlog::error("路径节点 {} 引用了不存在的后继节点 {}", id, next_id);
+                    clear();
+                    return false;
+                }
+                next_indices_.push_back(it->second);
+            }
+            next_offsets_.push_back(static_cast<std::uint32_t>(next_indices_.size()));
+        }
+
+        start_indices_.reserve(start_ids.size());
+        for (auto start_id : start_ids)
+        {
+            auto it = id_to_index.find(start_id);
+            if (it == id_to_index.end())
+            {
+                spdlog::error("起点 {} 不是有效的路径节点", start_id);
+                clear();
+                return false;
+            }
+            start_indices_.push_back(it->second);
+        }
+
+        spdlog::info("路径图编译完成，节点数量: {}, 边数量: {}, 起点数量: {}", size(), next_indices_.size(), start_indices_.size());
+        return true;
+    }
+
+    void WaypointGraph::clear()
+    {
+        position_x_.clear();
+        position_y_.clear();
+        next_offsets_.clear();
+        next_indices_.clear();
+        node_ids_.clear();
+        start_indices_.clear();
+    }
+
+} // namespace game::data
@@ -0,0 +1,50 @@
+#pragma once
+#include "waypoint_node.h"
+#include <glm/vec2.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace game::data
+{
+
+    /**
+     * @brief 扁平化的路径图，由关卡加载得到的路径节点编译而成。
+     *
+     * 节点按ID升序重新编号为连续的索引（dense index），坐标以SoA方式存放，
+     * 后继节点以CSR（压缩稀疏行）方式存放：第i个节点的后继索引位于
+     * next_indices_[next_offsets_[i], next_offsets_[i + 1]) 区间内。
+     * 运行时只通过索引访问，不涉及哈希查找与内存分配。
+     */
+    class WaypointGraph
+    {
+        std::vector<float> position_x_;             ///< @brief 节点x坐标
+        std::vector<float> position_y_;             ///< @brief 节点y坐标
+        std::vector<std::uint32_t> next_offsets_;   ///< @brief 每个节点的后继在 next_indices_ 中的起始位置（长度为节点数量+1）
+        std::vector<std::uint32_t> next_indices_;   ///< @brief 所有节点的后继索引
+        std::vector<int> node_ids_;                 ///< @brief 索引到原始节点ID的映射（用于日志与调试）
+        std::vector<std::uint32_t> start_indices_;  ///< @brief 起点索引列表
+
+    public:
+        /**
+         * @brief 从路径节点编译路径图（会覆盖之前的数据）
+         * @param waypoint_nodes 路径节点ID到节点数据的映射
+         * @param start_ids 起点ID列表
+         * @return 是否编译成功（引用了不存在的节点时失败）
+         */
+        bool build(const std::unordered_map<int, WaypointNode> &waypoint_nodes, const std::vector<int> &start_ids);
+        void clear(); ///< @brief 清空路径图
+
+        // --- getters ---
+        [[nodiscard]] std::size_t size() const { return position_x_.size(); }
+        [[nodiscard]] bool empty() const { return position_x_.empty(); }
+        [[nodiscard]] glm::vec2 getPosition(std::uint32_t index) const { return {position_x_[index], position_y_[index]}; }
+        [[nodiscard]] std::uint32_t getNextCount(std::uint32_t index) const { return next_offsets_[index + 1] - next_offsets_[index]; }
+        [[nodiscard]] std::uint32_t getNext(std::uint32_t index, std::uint32_t n) const { return next_indices_[next_offsets_[index] + n]; }
+        [[nodiscard]] bool isEnd(std::uint32_t index) const { return getNextCount(index) == 0; }
+        [[nodiscard]] int getNodeId(std::uint32_t index) const { return node_ids_[index]; }
+        [[nodiscard]] const std::vector<std::uint32_t> &getStartIndices() const { return start_indices_; }
+    };
+
+} // namespace game::data
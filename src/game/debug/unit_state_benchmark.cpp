@@ -0,0 +1,166 @@
+#include "unit_state_benchmark.h"
+#include "../component/unit_state_component.h"
+#include "../utils/unit_state_view.h"
+#include <entt/entity/registry.hpp>
+#include <chrono>
+
+namespace game::debug
+{
+
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+        using game::component::UnitStateComponent;
+
+        // 与旧实现相同的标签组件（只在基准测试中使用）
+        struct ReadyTag
+        {
+        };
+        struct LockTag
+        {
+        };
+
+        /// @brief 攻击冷却（逐帧累加的计时器）
+        struct CooldownComponent
+        {
+            float interval_{};
+            float timer_{};
+        };
+
+        constexpr float DELTA_TIME = 1.0f / 60.0f;
+        constexpr std::size_t LOCK_FRAMES = 20; ///< @brief 动作锁定持续的帧数（模拟攻击动画的时长）
+
+        void populate(entt::registry &registry, std::size_t unit_count)
+        {
+            for (std::size_t i = 0; i < unit_count; ++i)
+            {
+                auto entity = registry.create();
+                // 攻击间隔与初始计时错开，使每帧都有一部分单位冷却完毕
+                registry.emplace<CooldownComponent>(entity, 0.5f + 0.25f * static_cast<float>(i % 7),
+                                                    static_cast<float>(i % 60) * DELTA_TIME);
+                registry.emplace<UnitStateComponent>(entity);
+            }
+        }
+
+        bool lockExpired(entt::entity entity, std::size_t frame)
+        {
+            return (static_cast<std::size_t>(entt::to_integral(entity)) + frame) % LOCK_FRAMES == 0;
+        }
+
+        /// @brief 标签组件实现：每次切换都是一次稀疏集合的插入/删除
+        std::size_t runTags(entt::registry &registry, std::size_t frames)
+        {
+            std::size_t toggles = 0;
+            for (std::size_t frame = 0; frame < frames; ++frame)
+            {
+                auto view_timer = registry.view<CooldownComponent>(entt::exclude<ReadyTag>);
+                for (auto entity : view_timer)
+                {
+                    auto &cooldown = view_timer.get<CooldownComponent>(entity);
+                    cooldown.timer_ += DELTA_TIME;
+                    if (cooldown.timer_ >= cooldown.interval_)
+                    {
+                        registry.emplace<ReadyTag>(entity);
+                        cooldown.timer_ = 0.0f;
+                        ++toggles;
+                    }
+                }
+                auto view_ready = registry.view<CooldownComponent, ReadyTag>();
+                for (auto entity : view_ready)
+                {
+                    registry.emplace_or_replace<LockTag>(entity);
+                    registry.remove<ReadyTag>(entity);
+                    toggles += 2;
+                }
+                auto view_lock = registry.view<LockTag>();
+                for (auto entity : view_lock)
+                {
+                    if (lockExpired(entity, frame))
+                    {
+                        registry.remove<LockTag>(entity);
+                        ++toggles;
+                    }
+                }
+            }
+            return toggles;
+        }
+
+        /// @brief 状态位实现：切换只修改 UnitStateComponent 中的一个字节
+        std::size_t runFlags(entt::registry &registry, std::size_t frames)
+        {
+            std::size_t toggles = 0;
+            for (std::size_t frame = 0; frame < frames; ++frame)
+            {
+                auto view = registry.view<CooldownComponent, UnitStateComponent>();
+                game::utils::forEachUnitState(view, {.none_of_ = UnitStateComponent::ATTACK_READY},
+                                              [&view, &toggles](auto entity, UnitStateComponent &state)
+                                              {
+                                                  auto &cooldown = view.get<CooldownComponent>(entity);
+                                                  cooldown.timer_ += DELTA_TIME;
+                                                  if (cooldown.timer_ >= cooldown.interval_)
+                                                  {
+                                                      state.set(UnitStateComponent::ATTACK_READY);
+                                                      cooldown.timer_ = 0.0f;
+                                                      ++toggles;
+                                                  }
+                                              });
+                game::utils::forEachUnitState(view, {.all_of_ = UnitStateComponent::ATTACK_READY},
+                                              [&toggles](auto, UnitStateComponent &state)
+                                              {
+                                                  state.set(UnitStateComponent::ACTION_LOCK);
+                                                  state.clear(UnitStateComponent::ATTACK_READY);
+                                                  toggles += 2;
+                                              });
+                game::utils::forEachUnitState(view, {.all_of_ = UnitStateComponent::ACTION_LOCK},
+                                              [&toggles, frame](auto entity, UnitStateComponent &state)
+                                              {
+                                                  if (lockExpired(entity, frame))
+                                                  {
+                                                      state.clear(UnitStateComponent::ACTION_LOCK);
+                                                      ++toggles;
+                                                  }
+                                              });
+            }
+            return toggles;
+        }
+
+        template <typename Func>
+        double measure(Func &&func)
+        {
+            const auto start = Clock::now();
+            func();
+            const std::chrono::duration<double, std::milli> elapsed = Clock::now() - start;
+            return elapsed.count();
+        }
+    }
+
+    std::vector<UnitStateBenchmarkResult> runUnitStateBenchmark(const std::vector<std::size_t> &unit_counts, std::size_t frames)
+    {
+        std::vector<UnitStateBenchmarkResult> results;
+        results.reserve(unit_counts.size());
+        for (auto unit_count : unit_counts)
+        {
+            UnitStateBenchmarkResult result;
+            result.unit_count_ = unit_count;
+            result.frames_ = frames;
+
+            std::size_t tag_toggles = 0;
+            {
+                entt::registry registry;
+                populate(registry, unit_count);
+                result.tag_ms_ = measure([&]
+                                         { tag_toggles = runTags(registry, frames); });
+            }
+            {
+                entt::registry registry;
+                populate(registry, unit_count);
+                result.flag_ms_ = measure([&]
+                                          { result.toggles_ = runFlags(registry, frames); });
+            }
+            result.consistent_ = tag_toggles == result.toggles_;
+            results.push_back(result);
+        }
+        return results;
+    }
+
+} // namespace game::debug
@@ -0,0 +1,32 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+namespace game::debug
+{
+
+    /// @brief 单次对比结果（同一单位数量下，标签组件与状态位两种实现的耗时）
+    struct UnitStateBenchmarkResult
+    {
+        std::size_t unit_count_{0};  ///< @brief 单位数量
+        std::size_t frames_{0};      ///< @brief 模拟帧数
+        std::size_t toggles_{0};     ///< @brief 状态切换总次数
+        bool consistent_{true};      ///< @brief 两种实现的状态切换次数是否一致（不一致时对比没有意义）
+        double tag_ms_{0.0};         ///< @brief 标签组件（稀疏集合插入/删除）总耗时
+        double flag_ms_{0.0};        ///< @brief 状态位（UnitStateComponent）总耗时
+
+        [[nodiscard]] double getSpeedup() const { return flag_ms_ > 0.0 ? tag_ms_ / flag_ms_ : 0.0; }
+    };
+
+    /**
+     * @brief 对比高频状态切换的两种存储方式：标签组件 vs UnitStateComponent 位标志。
+     *
+     * 每帧模拟 TimerSystem（冷却完毕时设置“可攻击”）、AttackStarterSystem（消耗“可攻击”并设置“动作锁定”）
+     * 与动画结束（解除“动作锁定”）三个步骤，攻击间隔按单位错开，使每帧都有一部分单位切换状态。
+     *
+     * @param unit_counts 要测试的单位数量
+     * @param frames 每组模拟的帧数
+     */
+    std::vector<UnitStateBenchmarkResult> runUnitStateBenchmark(const std::vector<std::size_t> &unit_counts, std::size_t frames);
+
+} // namespace game::debug
@@ -1,6 +1,8 @@
 #pragma once
 #include "../../engine/utils/math.h"
 #include <glm/vec2.hpp>
+#include <cstddef>
+#include <cstdint>
 
 namespace game::defs
 {
@@ -9,6 +11,14 @@ namespace game::defs
     constexpr float UNIT_RADIUS = 20.0f;  ///< @brief 角色自身半径（相当于碰撞盒，用于计算攻击范围）
     constexpr float PLACE_RADIUS = 40.0f; ///< @brief 放置区域半径（相当于碰撞盒，用于检测鼠标是否处在可放置位置）
 
+    constexpr float SPATIAL_CELL_SIZE = 64.0f;                 ///< @brief 空间网格单元格边长（与常见攻击范围同一量级）
+    constexpr std::uint32_t SPATIAL_MASK_PLAYER = 1u << 0;     ///< @brief 空间网格掩码：玩家角色
+    constexpr std::uint32_t SPATIAL_MASK_ENEMY = 1u << 1;      ///< @brief 空间网格掩码：敌人角色
+    constexpr std::uint32_t SPATIAL_MASK_BLOCKER = 1u << 2;    ///< @brief 空间网格掩码：阻挡者
+
+    constexpr std::size_t POOL_PREWARM_SHOTS_PER_SHOOTER = 2; ///< @brief 预热投射物池时，每个远程单位预计同时在空中的投射物数量
+    constexpr std::size_t POOL_PREWARM_MAX = 32;              ///< @brief 每个实体池预热数量的上限
+
     constexpr engine::utils::FColor RANGE_COLOR = {
         ///< @brief 攻击范围显示的颜色（RGBA）
         0.0f, 1.0f, 0.0f, 0.3f // 透明绿色
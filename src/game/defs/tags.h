@@ -23,21 +23,7 @@ namespace game::defs
     {
     }; ///< @brief 治疗单位标签
 
-    struct AttackReadyTag
-    {
-    }; ///< @brief “可攻击”标签，用于标记实体可以进行攻击（冷却完毕）
-
-    struct InjuredTag
-    {
-    }; ///< @brief 受伤标签，用于标记实体受伤（有HP损失）
-
-    struct ActionLockTag
-    {
-    }; ///< @brief 动作锁定标签，让角色播放完当前动画再进行下一步动作（硬直）
-
-    struct OneShotRemoveTag
-    {
-    }; ///< @brief 一次性移除标签，用于标记实体一次性移除（如死亡特效）
+    /* “可攻击”、“受伤”、“动作锁定”等高频切换的状态使用 UnitStateComponent 中的位标志 */
 
     struct HasHealthBarTag
     {
@@ -7,9 +7,15 @@
 #include "../../engine/component/animation_component.h"
 #include "../../engine/component/velocity_component.h"
 #include "../../engine/component/render_component.h"
+#include "../../engine/component/interpolation_component.h"
 #include "../defs/tags.h"
 #include "../../engine/component/audio_component.h"
+#include "../../engine/resource/resource_manager.h"
+#include "../../engine/resource/animation_library.h"
+#include "../../engine/core/entity_pool.h"
+#include "../../engine/system/particle_system.h"
 #include "../component/stats_component.h"
+#include "../component/unit_state_component.h"
 #include "../component/enemy_component.h"
 #include "../component/class_name_component.h"
 #include "../component/player_component.h"
@@ -26,9 +32,35 @@ using namespace entt::literals;
 
 namespace game::factory {
 
+namespace {
+    /// @brief 玩家职业与敌人类型的ID可能相同，动画集合键中加入种类区分
+    entt::id_type playerAnimationSetKey(entt::id_type class_id) {
+        return engine::resource::AnimationLibrary::combineKey(class_id, "player"_hs);
+    }
+    entt::id_type enemyAnimationSetKey(entt::id_type class_id) {
+        return engine::resource::AnimationLibrary::combineKey(class_id, "enemy"_hs);
+    }
+    /// @brief 实体池的键，同样加入种类区分
+    entt::id_type projectilePoolKey(entt::id_type id) {
+        return engine::resource::AnimationLibrary::combineKey(id, "projectile"_hs);
+    }
+    /// @brief 粒子特效的键
+    entt::id_type deadEffectKey(entt::id_type class_id) {
+        return engine::resource::AnimationLibrary::combineKey(class_id, "dead_effect"_hs);
+    }
+}
+
 EntityFactory::EntityFactory(entt::registry& registry, 
-    BlueprintManager& blueprint_manager)
-    : registry_(registry), blueprint_manager_(blueprint_manager) {}
+    BlueprintManager& blueprint_manager,
+    engine::resource::ResourceManager& resource_manager,
+    engine::core::EntityPool& entity_pool,
+    engine::system::ParticleSystem& particle_system)
+    : registry_(registry), blueprint_manager_(blueprint_manager), resource_manager_(resource_manager), entity_pool_(entity_pool),
+      particle_system_(particle_system) {
+    registerAnimationSets();
+    registerEntityPools();
+    registerParticleEffects();
+}
 
     entt::entity EntityFactory::createPlayerUnit(entt::id_type class_id, const glm::vec2& position, int level, int rarity) {
         auto entity = registry_.create();
@@ -41,7 +73,7 @@ EntityFactory::EntityFactory(entt::registry& registry,
         addSpriteComponent(entity, blueprint.sprite_);
     
         // 添加Animation组件
-        addAnimationComponent(entity, blueprint.animations_, blueprint.sprite_, "idle"_hs);
+        addAnimationComponent(entity, playerAnimationSetKey(class_id), "idle"_hs);
     
         // 添加Audio组件
         addAudioComponent(entity, blueprint.sounds_);
@@ -65,18 +97,20 @@ EntityFactory::EntityFactory(entt::registry& registry,
         return entity;
     }
 
-entt::entity EntityFactory::createEnemyUnit(entt::id_type class_id, const glm::vec2& position, int target_waypoint_id, int level, int rarity) {
+entt::entity EntityFactory::createEnemyUnit(entt::id_type class_id, const glm::vec2& position, std::uint32_t target_waypoint_index, int level, int rarity) {
     auto entity = registry_.create();
     const auto& blueprint = blueprint_manager_.getEnemyClassBlueprint(class_id);
     // --- 添加组件 ---
     // 添加Transform组件
     addTransformComponent(entity, position);
+    // 敌人会持续移动，添加渲染插值组件
+    registry_.emplace<engine::component::InterpolationComponent>(entity, position);
 
     // 添加Sprite组件
     addSpriteComponent(entity, blueprint.sprite_);
 
     // 添加Animation组件 (默认动画为“walk”)
-    addAnimationComponent(entity, blueprint.animations_, blueprint.sprite_, "walk"_hs);
+    addAnimationComponent(entity, enemyAnimationSetKey(class_id), "walk"_hs);
 
     // 添加Audio组件
     addAudioComponent(entity, blueprint.sounds_);
@@ -85,7 +119,7 @@ entt::entity EntityFactory::createEnemyUnit(entt::id_type class_id, const glm::v
     addStatsComponent(entity, blueprint.stats_, level, rarity);
     
     // 添加Enemy组件
-    addEnemyComponent(entity, blueprint.enemy_, target_waypoint_id);
+    addEnemyComponent(entity, blueprint.enemy_, target_waypoint_index);
 
     // 添加ProjectileID组件
     addProjectileIDComponent(entity, blueprint.projectile_id_);
@@ -101,26 +135,24 @@ entt::entity EntityFactory::createEnemyUnit(entt::id_type class_id, const glm::v
 }
 
 entt::entity EntityFactory::createProjectile(entt::id_type id, const glm::vec2& start_position, const glm::vec2& target_position, entt::entity target, float damage) {
-    // 创建投射物实体
-    auto entity = registry_.create();
     const auto& blueprint = blueprint_manager_.getProjectileBlueprint(id);
-    // --- 依次添加必要组件 ---
+    // 优先复用停用的投射物，池为空时新建
+    auto entity = entity_pool_.acquire(projectilePoolKey(id));
+    if (entity == entt::null) {
+        entity = buildProjectile(id);
+    }
+    // --- 就地重置保留的组件 ---
+    registry_.get<engine::component::TransformComponent>(entity) = engine::component::TransformComponent(start_position);
+    registry_.get<engine::component::InterpolationComponent>(entity).previous_position_ = start_position;
+    // --- 添加活动组件（停用时移除） ---
     // 添加ProjectileComponent
     registry_.emplace<game::component::ProjectileComponent>(entity, 
         target, 
         damage,
         start_position,
         target_position, 
-        start_position,
         blueprint.arc_height_, 
-        blueprint.total_flight_time_,
-        0.0f);
-    // 添加SpriteComponent
-    addSpriteComponent(entity, blueprint.sprite_);
-    // 添加TransformComponent
-    addTransformComponent(entity, start_position);
-    // 添加AudioComponent
-    addAudioComponent(entity, blueprint.sounds_);
+        blueprint.total_flight_time_);
     // 添加RenderComponent(让投射物位于主图层+1，即可以遮住角色)
     registry_.emplace<engine::component::RenderComponent>(entity, engine::component::RenderComponent::MAIN_LAYER + 1);
     return entity;
@@ -146,53 +178,85 @@ entt::entity EntityFactory::createUnitPrep(entt::id_type name_id, entt::id_type
     return entity;
 }
 
-entt::entity EntityFactory::createEnemyDeadEffect(entt::id_type class_id, const glm::vec2& position, const bool is_flipped) {
-    auto entity = registry_.create();
-    const auto& blueprint = blueprint_manager_.getEnemyClassBlueprint(class_id);
-    // 添加Transform组件
-    addTransformComponent(entity, position);
+void EntityFactory::createEnemyDeadEffect(entt::id_type class_id, const glm::vec2& position, const bool is_flipped) {
+    // 特效已在构造时登记，缓冲区满时粒子系统会覆盖最旧的粒子
+    particle_system_.emit(particle_system_.findEffect(deadEffectKey(class_id)), position, is_flipped);
+}
 
-    // 添加Sprite组件
-    addSpriteComponent(entity, blueprint.sprite_, is_flipped);
+void EntityFactory::prewarmProjectiles(entt::id_type id, std::size_t count) {
+    entity_pool_.prewarm(projectilePoolKey(id), count, [this, id] { return buildProjectile(id); });
+}
 
-    // 添加Animation组件(死亡动画名称为“damage”)
-    addOneAnimationComponent(entity, blueprint.animations_.at("damage"_hs), blueprint.sprite_, "damage"_hs);
+// --- 池化实体 ---
 
-    // 补充其他必要组件
-    registry_.emplace<engine::component::RenderComponent>(entity);
-    registry_.emplace<game::defs::OneShotRemoveTag>(entity);
+void EntityFactory::registerEntityPools() {
+    // 活动组件：投射物逻辑、渲染，以及命中后添加的死亡标签
+    for (const auto& [id, blueprint] : blueprint_manager_.projectile_blueprints_) {
+        entity_pool_.registerPool<game::component::ProjectileComponent,
+                                  engine::component::RenderComponent,
+                                  game::defs::DeadTag>(projectilePoolKey(id));
+    }
+}
+
+entt::entity EntityFactory::buildProjectile(entt::id_type id) {
+    const auto& blueprint = blueprint_manager_.getProjectileBlueprint(id);
+    auto entity = registry_.create();
+    entity_pool_.adopt(entity, projectilePoolKey(id));
+    // 添加SpriteComponent
+    addSpriteComponent(entity, blueprint.sprite_);
+    // 添加TransformComponent
+    addTransformComponent(entity, glm::vec2(0.0f));
+    registry_.emplace<engine::component::InterpolationComponent>(entity, glm::vec2(0.0f));
+    // 添加AudioComponent
+    addAudioComponent(entity, blueprint.sounds_);
     return entity;
 }
 
-// --- 组件创建函数 ---
+// --- 粒子特效 ---
 
-void EntityFactory::addTransformComponent(entt::entity entity, const glm::vec2& position, const glm::vec2& scale, float rotation) {
-    registry_.emplace<engine::component::TransformComponent>(entity, position, scale, rotation);
+void EntityFactory::registerParticleEffects() {
+    const auto& library = resource_manager_.getAnimationLibrary();
+    for (const auto& [class_id, blueprint] : blueprint_manager_.enemy_class_blueprints_) {
+        // 死亡特效：敌人的精灵 + 敌人动画集合中的“damage”动画（与敌人共享同一份动画，只播放一次）
+        const auto& sprite = blueprint.sprite_;
+        engine::system::ParticleEffectDesc desc;
+        desc.sprite_ = engine::component::Sprite(sprite.id_, sprite.src_rect_, false, resource_manager_.resolveTexture(sprite.id_, sprite.path_));
+        desc.size_ = sprite.size_;
+        desc.offset_ = sprite.offset_;
+        desc.clip_ = library.findClip(library.findSet(enemyAnimationSetKey(class_id)), "damage"_hs);
+        particle_system_.registerEffect(deadEffectKey(class_id), desc);
+    }
 }
 
-void EntityFactory::addSpriteComponent(entt::entity entity, const data::SpriteBlueprint& sprite, const bool is_flipped) {
-    registry_.emplace<engine::component::SpriteComponent>(entity, 
-        engine::component::Sprite(sprite.path_, 
-                                  sprite.src_rect_,
-                                  is_flipped),
-        sprite.size_,
-        sprite.offset_);
-    // 如果图片朝左就添加FaceLeftTag
-    if (!sprite.face_right_) {
-        registry_.emplace<game::defs::FaceLeftTag>(entity);
+// --- 动画登记 ---
+
+void EntityFactory::registerAnimationSets() {
+    // 在创建实体之前一次性登记，游戏运行期间动画库保持只读（AnimationSystem 会并行读取）
+    for (const auto& [class_id, blueprint] : blueprint_manager_.player_class_blueprints_) {
+        registerAnimationSet(playerAnimationSetKey(class_id), blueprint.animations_, blueprint.sprite_);
+    }
+    for (const auto& [class_id, blueprint] : blueprint_manager_.enemy_class_blueprints_) {
+        registerAnimationSet(enemyAnimationSetKey(class_id), blueprint.animations_, blueprint.sprite_);
     }
+    const auto& library = resource_manager_.getAnimationLibrary();
+    spdlog::info("动画库: {} 个动画集合, {} 个动画片段, 约 {} KB", 
+                 library.getSetCount(), library.getClipCount(), library.getMemoryUsage() / 1024);
 }
 
-void EntityFactory::addAnimationComponent(entt::entity entity, 
+void EntityFactory::registerAnimationSet(entt::id_type set_key,
         const std::unordered_map<entt::id_type, data::AnimationBlueprint>& animation_blueprints,
-        const data::SpriteBlueprint& sprite_blueprint,
-        entt::id_type default_animation_id) {
-    // 先创建map容器  
-    std::unordered_map<entt::id_type, engine::component::Animation> animations;
+        const data::SpriteBlueprint& sprite_blueprint) {
+    auto& library = resource_manager_.getAnimationLibrary();
+    // 场景重新加载时蓝图不变，已登记的集合直接复用
+    if (library.findSet(set_key) != engine::resource::INVALID_ANIMATION_ID) {
+        return;
+    }
+    auto set_id = library.createSet(set_key);
     // 针对每一个动画，
     for (const auto& [anim_id, anim_blueprint] : animation_blueprints) {
         // 创建动画帧容器
         std::vector<engine::component::AnimationFrame> frames;
+        frames.reserve(anim_blueprint.frames_.size());
         // 依次读取蓝图中的每一个帧索引
         for (const auto& frame_index : anim_blueprint.frames_) {
             engine::utils::Rect source_rect = sprite_blueprint.src_rect_;
@@ -202,33 +266,41 @@ void EntityFactory::addAnimationComponent(entt::entity entity,
             // 创建动画帧并插入动画帧容器
             frames.emplace_back(source_rect, anim_blueprint.ms_per_frame_);
         }
-        // 将创建好的动画帧容器插入动画map容器 (可直接使用蓝图中的事件信息)
-        animations.emplace(anim_id, engine::component::Animation(std::move(frames), anim_blueprint.events_));
+        // 将创建好的动画片段登记到集合中 (可直接使用蓝图中的事件信息)
+        library.addClip(set_id, anim_id, engine::component::Animation(std::move(frames), anim_blueprint.events_));
+    }
+}
+
+// --- 组件创建函数 ---
+
+void EntityFactory::addTransformComponent(entt::entity entity, const glm::vec2& position, const glm::vec2& scale, float rotation) {
+    registry_.emplace<engine::component::TransformComponent>(entity, position, scale, rotation);
+}
+
+void EntityFactory::addSpriteComponent(entt::entity entity, const data::SpriteBlueprint& sprite, const bool is_flipped) {
+    // 创建时解析纹理句柄（必要时加载纹理），绘制时直接使用句柄
+    registry_.emplace<engine::component::SpriteComponent>(entity, 
+        engine::component::Sprite(sprite.id_, 
+                                  sprite.src_rect_,
+                                  is_flipped,
+                                  resource_manager_.resolveTexture(sprite.id_, sprite.path_)),
+        sprite.size_,
+        sprite.offset_);
+    // 如果图片朝左就添加FaceLeftTag
+    if (!sprite.face_right_) {
+        registry_.emplace<game::defs::FaceLeftTag>(entity);
     }
-    // 通过动画map容器创建动画组件
-    registry_.emplace<engine::component::AnimationComponent>(entity, std::move(animations), default_animation_id);
 }
 
-void EntityFactory::addOneAnimationComponent(entt::entity entity, 
-                                             const data::AnimationBlueprint& animation_blueprint, 
-                                             const data::SpriteBlueprint& sprite_blueprint,
-                                             entt::id_type animation_id,
-                                             bool loop) {
-    // 创建动画帧容器
-    std::vector<engine::component::AnimationFrame> frames;
-    // 依次读取动画蓝图中每一个动画帧，并插入容器
-    for (const auto& frame_index : animation_blueprint.frames_) {
-        engine::utils::Rect source_rect = sprite_blueprint.src_rect_;
-        source_rect.position.x += frame_index * source_rect.size.x;
-        source_rect.position.y += animation_blueprint.row_ * source_rect.size.y;
-        frames.emplace_back(source_rect, animation_blueprint.ms_per_frame_);
+void EntityFactory::addAnimationComponent(entt::entity entity, entt::id_type set_key, entt::id_type animation_id, bool loop) {
+    const auto& library = resource_manager_.getAnimationLibrary();
+    auto set_id = library.findSet(set_key);
+    auto clip_id = library.findClip(set_id, animation_id);
+    if (clip_id == engine::resource::INVALID_ANIMATION_ID) {
+        spdlog::error("动画集合中没有动画 {}，实体 {} 的动画不会播放", animation_id, entt::to_integral(entity));
     }
-    // 创建动画map容器
-    std::unordered_map<entt::id_type, engine::component::Animation> animations;
-    // 将创建好的动画帧容器插入动画map容器 (只有一个动画)
-    animations.emplace(animation_id, engine::component::Animation(std::move(frames), animation_blueprint.events_, loop));
-    // 通过动画map容器创建动画组件
-    registry_.emplace<engine::component::AnimationComponent>(entity, std::move(animations), animation_id);
+    // 组件只保存集合与片段索引
+    registry_.emplace<engine::component::AnimationComponent>(entity, set_id, animation_id, clip_id, loop);
 }
 
 void EntityFactory::addStatsComponent(entt::entity entity, const data::StatsBlueprint& stats, int level, int rarity) {
@@ -244,9 +316,10 @@ void EntityFactory::addStatsComponent(entt::entity entity, const data::StatsBlue
         def, 
         stats.range_,
         stats.atk_interval_,
-        0.0f,
         level,
         rarity);
+    // 有属性的单位都需要状态位（计时器、攻击启动、战斗结算依赖它）；重新设置属性时保留已有状态
+    registry_.get_or_emplace<game::component::UnitStateComponent>(entity);
 }
 
 void EntityFactory::addPlayerComponent(entt::entity entity, const data::PlayerBlueprint& player, int rarity) {
@@ -266,8 +339,8 @@ void EntityFactory::addPlayerComponent(entt::entity entity, const data::PlayerBl
     // TODO: 未来添加技能组件
 }
 
-void EntityFactory::addEnemyComponent(entt::entity entity, const data::EnemyBlueprint& enemy, int target_waypoint_id) {
-    registry_.emplace<game::component::EnemyComponent>(entity, target_waypoint_id, enemy.speed_);
+void EntityFactory::addEnemyComponent(entt::entity entity, const data::EnemyBlueprint& enemy, std::uint32_t target_waypoint_index) {
+    registry_.emplace<game::component::EnemyComponent>(entity, target_waypoint_index, enemy.speed_);
     registry_.emplace<engine::component::VelocityComponent>(entity, glm::vec2(0, 0));
     if (enemy.ranged_) {    // 添加远程或近战标签备用
         registry_.emplace<game::defs::RangedUnitTag>(entity);
@@ -1,9 +1,26 @@
 #pragma once
 #include "../data/entity_blueprint.h"
 #include <entt/entity/fwd.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <unordered_map>
 #include <nlohmann/json.hpp>
 
+namespace engine::resource
+{
+    class ResourceManager;
+}
+
+namespace engine::core
+{
+    class EntityPool;
+}
+
+namespace engine::system
+{
+    class ParticleSystem;
+}
+
 namespace game::factory
 {
 
@@ -18,10 +35,14 @@ namespace game::factory
     private:
         entt::registry &registry_;
         BlueprintManager &blueprint_manager_;
+        engine::resource::ResourceManager &resource_manager_; ///< @brief 资源管理器（创建精灵时解析纹理句柄、引用共享动画）
+        engine::core::EntityPool &entity_pool_;               ///< @brief 实体池（投射物等短命实体复用）
+        engine::system::ParticleSystem &particle_system_;     ///< @brief 粒子系统（死亡特效等不创建实体）
 
     public:
-        /// @brief 实体工厂构造函数, 需要传入注册表和蓝图管理器。通过蓝图数据创建不同实体
-        EntityFactory(entt::registry &registry, BlueprintManager &blueprint_manager);
+        /// @brief 实体工厂构造函数, 需要传入注册表、蓝图管理器、资源管理器、实体池和粒子系统。通过蓝图数据创建不同实体
+        EntityFactory(entt::registry &registry, BlueprintManager &blueprint_manager, engine::resource::ResourceManager &resource_manager,
+                      engine::core::EntityPool &entity_pool, engine::system::ParticleSystem &particle_system);
 
         /**
          * @brief 创建玩家单位
@@ -37,15 +58,15 @@ namespace game::factory
          * @brief 创建敌人单位
          * @param class_id 敌人类型ID
          * @param position 位置
-         * @param target_waypoint_id 目标路径点ID
+         * @param target_waypoint_index 目标路径点在路径图中的索引
          * @param level 等级
          * @param rarity 稀有度
          * @return 敌人单位实体
          */
-        entt::entity createEnemyUnit(entt::id_type class_id, const glm::vec2 &position, int target_waypoint_id, int level = 1, int rarity = 1);
+        entt::entity createEnemyUnit(entt::id_type class_id, const glm::vec2 &position, std::uint32_t target_waypoint_index, int level = 1, int rarity = 1);
 
         /**
-         * @brief 创建投射物
+         * @brief 创建投射物（优先复用实体池中停用的同类投射物）
          * @param id 投射物ID
          * @param start_position 起始位置
          * @param target_position 目标位置
@@ -66,32 +87,44 @@ namespace game::factory
         entt::entity createUnitPrep(entt::id_type name_id, entt::id_type class_id, int cost, const glm::vec2 &position);
 
         /**
-         * @brief 创建敌人死亡特效
+         * @brief 创建敌人死亡特效（发射一个粒子，不创建实体）
          * @note 敌人死亡特效直接从敌人蓝图中获取，对应的动画名称必须为“damage”。
          * @param class_id 敌人ID
          * @param position 位置
          * @param is_flipped 是否翻转
-         * @return 敌人死亡特效实体
          */
-        entt::entity createEnemyDeadEffect(entt::id_type class_id, const glm::vec2 &position, const bool is_flipped = false);
+        void createEnemyDeadEffect(entt::id_type class_id, const glm::vec2 &position, const bool is_flipped = false);
+
+        void prewarmProjectiles(entt::id_type id, std::size_t count); ///< @brief 预热投射物池，使池中至少有 count 个停用的投射物
         // TODO: 未来添加其他实体的创建函数
 
     private:
+        // --- 池化实体 ---
+        void registerEntityPools();                     ///< @brief 为每种投射物登记实体池（声明活动组件）
+        entt::entity buildProjectile(entt::id_type id); ///< @brief 新建投射物实体，只添加复用时保留的组件
+
+        // --- 粒子特效 ---
+        void registerParticleEffects(); ///< @brief 把每种敌人的死亡特效登记到粒子系统（需要在动画登记之后）
+
+        // --- 动画登记 ---
+        void registerAnimationSets(); ///< @brief 把所有玩家/敌人蓝图的动画登记到共享动画库（每类单位一份，已登记的跳过）
+        void registerAnimationSet(entt::id_type set_key,
+                                  const std::unordered_map<entt::id_type, data::AnimationBlueprint> &animation_blueprints,
+                                  const data::SpriteBlueprint &sprite_blueprint);
+
         // --- 组件创建函数 ---
         void addTransformComponent(entt::entity entity, const glm::vec2 &position, const glm::vec2 &scale = glm::vec2(1.0f), float rotation = 0.0f);
         void addSpriteComponent(entt::entity entity, const data::SpriteBlueprint &sprite, const bool is_flipped = false);
-        void addAnimationComponent(entt::entity entity, ///< @brief 正常动画组件添加（多个动画）
-                                   const std::unordered_map<entt::id_type, data::AnimationBlueprint> &animation_blueprints,
-                                   const data::SpriteBlueprint &sprite_blueprint,
-                                   entt::id_type default_animation_id);
-        void addOneAnimationComponent(entt::entity entity, ///< @brief 单个动画组件添加（组件中只包含一个动画），用于创建特效
-                                      const data::AnimationBlueprint &animation_blueprint,
-                                      const data::SpriteBlueprint &sprite_blueprint,
-                                      entt::id_type animation_id,
-                                      bool loop = false);
+        /**
+         * @brief 添加动画组件（动画片段已在构造时登记到共享动画库，组件只引用索引）
+         * @param set_key 动画集合键（见 playerAnimationSetKey / enemyAnimationSetKey）
+         * @param animation_id 初始播放的动画ID
+         * @param loop 初始动画是否循环
+         */
+        void addAnimationComponent(entt::entity entity, entt::id_type set_key, entt::id_type animation_id, bool loop = true);
         void addStatsComponent(entt::entity entity, const data::StatsBlueprint &stats, int level = 1, int rarity = 1);
         void addPlayerComponent(entt::entity entity, const data::PlayerBlueprint &player, int rarity);
-        void addEnemyComponent(entt::entity entity, const data::EnemyBlueprint &enemy, int target_waypoint_id);
+        void addEnemyComponent(entt::entity entity, const data::EnemyBlueprint &enemy, std::uint32_t target_waypoint_index);
         void addAudioComponent(entt::entity entity, const data::SoundBlueprint &sounds);
         void addProjectileIDComponent(entt::entity entity, entt::id_type id);
         // TODO: 未来添加其他组件创建函数
@@ -1,6 +1,9 @@
 #include "game_scene.h"
 #include "../component/player_component.h"
 #include "../component/stats_component.h"
+#include "../component/unit_state_component.h"
+#include "../component/projectile_component.h"
+#include "../component/enemy_component.h"
 #include "../factory/entity_factory.h"
 #include "../factory/blueprint_manager.h"
 #include "../loader/entity_builder_mw.h"
@@ -21,22 +24,36 @@
 #include "../system/game_rule_system.h"
 #include "../system/place_unit_system.h"
 #include "../system/render_range_system.h"
+#include "../system/spatial_index_system.h"
 #include "../ui/units_portrait_ui.h"
 #include "../defs/tags.h"
+#include "../defs/constants.h"
 #include "../../engine/input/input_manager.h"
 #include "../../engine/core/context.h"
+#include "../../engine/core/config.h"
+#include "../../engine/core/command_buffer.h"
+#include "../../engine/core/timer_scheduler.h"
+#include "../../engine/core/entity_pool.h"
 #include "../../engine/core/game_state.h"
 #include "../../engine/render/camera.h"
+#include "../../engine/core/time.h"
 #include "../../engine/system/render_system.h"
+#include "../../engine/system/interpolation_system.h"
 #include "../../engine/system/movement_system.h"
 #include "../../engine/system/animation_system.h"
 #include "../../engine/system/ysort_system.h"
 #include "../../engine/system/audio_system.h"
+#include "../../engine/system/system_scheduler.h"
+#include "../../engine/system/particle_system.h"
 #include "../../engine/loader/level_loader.h"
+#include "../../engine/spatial/spatial_grid.h"
 #include "../../engine/ui/ui_manager.h"
+#include "../../engine/debug/profiler.h"
+#include "../../engine/component/render_component.h"
 #include <entt/core/hashed_string.hpp>
 #include <entt/signal/sigh.hpp>
 #include <spdlog/spdlog.h>
+#include <algorithm>
 
 using namespace entt::literals;
 
@@ -90,6 +107,11 @@ namespace game::scene
             spdlog::error("初始化实体工厂失败");
             return;
         }
+        if (!initEntityPool())
+        {
+            spdlog::error("初始化实体池失败");
+            return;
+        }
         if (!initRegistryContext())
         {
             spdlog::error("初始化注册表上下文失败");
@@ -110,35 +132,47 @@ namespace game::scene
             spdlog::error("初始化敌人生成器失败");
             return;
         }
+        if (!initSystemScheduler())
+        {
+            spdlog::error("初始化系统调度器失败");
+            return;
+        }
 
         Scene::init();
     }
 
     void GameScene::update(float delta_time)
     {
-        auto &dispatcher = context_.getDispatcher();
+        // 系统的执行顺序与并行由调度器根据各系统声明的读写集合与顺序约束决定（见 initSystemScheduler）
+        system_scheduler_->run(delta_time);
 
-        // 每一帧最先清理死亡实体(要在dispatcher处理完事件后再清理，因此放在下一帧开头)
-        remove_dead_system_->update(registry_);
-
-        // 注意系统更新的顺序
-        timer_system_->update(registry_, delta_time);
-        game_rule_system_->update(delta_time);
-        block_system_->update(registry_, dispatcher);
-        set_target_system_->update(registry_);
-        follow_path_system_->update(registry_, dispatcher, waypoint_nodes_);
-        orientation_system_->update(registry_); // 调用顺序要在Block、SetTarget、FollowPath之后
-        attack_starter_system_->update(registry_, dispatcher);
-        projectile_system_->update(delta_time);
-        movement_system_->update(registry_, delta_time);
-        animation_system_->update(delta_time);
-        place_unit_system_->update(delta_time);
-        ysort_system_->update(registry_); // 调用顺序要在MovementSystem之后
-
-        // 场景中其他更新函数
-        enemy_spawner_->update(delta_time);
-        units_portrait_ui_->update(delta_time);
-        Scene::update(delta_time);
+        // 更新分析器中的实体计数
+        if (auto *profiler = engine::debug::Profiler::current())
+        {
+            profiler->setCounter("Enemies", static_cast<std::int64_t>(registry_.storage<game::component::EnemyComponent>().size()));
+            profiler->setCounter("Players", static_cast<std::int64_t>(registry_.storage<game::component::PlayerComponent>().size()));
+            profiler->setCounter("Projectiles", static_cast<std::int64_t>(registry_.storage<game::component::ProjectileComponent>().size()));
+            profiler->setCounter("Renderables", static_cast<std::int64_t>(registry_.storage<engine::component::RenderComponent>().size()));
+            // 本帧执行的延迟命令数（一帧内的多个tick累加）
+            const auto command_stats = command_buffer_->takeStats();
+            profiler->addCounter("Cmd emplace", static_cast<std::int64_t>(command_stats.emplaces_));
+            profiler->addCounter("Cmd remove", static_cast<std::int64_t>(command_stats.removes_));
+            profiler->addCounter("Cmd destroy", static_cast<std::int64_t>(command_stats.destroys_));
+            profiler->setCounter("Timers pending", static_cast<std::int64_t>(timer_scheduler_->getPendingCount()));
+            profiler->addCounter("Timers fired", static_cast<std::int64_t>(timer_system_->getLastFiredCount())); // 一帧内的多个tick累加
+            // 本帧结算的战斗事件数与涉及的目标数（一帧内的多个tick累加）
+            const auto &combat_stats = combat_resolve_system_->getLastStats();
+            profiler->addCounter("Combat events", static_cast<std::int64_t>(combat_stats.events_));
+            profiler->addCounter("Combat targets", static_cast<std::int64_t>(combat_stats.targets_));
+            // 实体池累计命中/未命中与当前停用的实体数
+            const auto pool_stats = entity_pool_->getStats();
+            profiler->setCounter("Pool hits", static_cast<std::int64_t>(pool_stats.hits_));
+            profiler->setCounter("Pool misses", static_cast<std::int64_t>(pool_stats.misses_));
+            profiler->setCounter("Pool free", static_cast<std::int64_t>(pool_stats.free_));
+            // 存活的粒子数与累计因容量已满被覆盖的粒子数
+            profiler->setCounter("Particles", static_cast<std::int64_t>(particle_system_->size()));
+            profiler->setCounter("Particles evicted", static_cast<std::int64_t>(particle_system_->getStats().evicted_));
+        }
     }
 
     void GameScene::render()
@@ -147,11 +181,25 @@ namespace game::scene
         auto &camera = context_.getCamera();
 
         // 注意渲染顺序，保证正确的遮盖关系
-        render_system_->update(registry_, renderer, camera);
-        health_bar_system_->update(registry_, renderer, camera);
-        render_range_system_->update(registry_, renderer, camera);
+        // 固定步长模拟时，动态实体绘制在上一个与当前tick的位置之间
+        const auto alpha = context_.getTime().getInterpolationAlpha();
+        {
+            ENGINE_PROFILE_SCOPE("RenderSystem");
+            render_system_->update(renderer, camera, alpha);
+        }
+        {
+            ENGINE_PROFILE_SCOPE("HealthBarSystem");
+            health_bar_system_->update(registry_, renderer, camera, alpha);
+        }
+        {
+            ENGINE_PROFILE_SCOPE("RenderRangeSystem");
+            render_range_system_->update(registry_, renderer, camera);
+        }
 
-        Scene::render();
+        {
+            ENGINE_PROFILE_SCOPE("UIManager::render");
+            Scene::render();
+        }
     }
 
     void GameScene::clean()
@@ -162,6 +210,18 @@ namespace game::scene
         dispatcher.disconnect(this);
         // 断开输入信号连接
         input_manager.onAction("pause"_hs).disconnect<&GameScene::onClearAllPlayers>(this);
+        if (entity_pool_)
+        {
+            const auto pool_stats = entity_pool_->getStats();
+            spdlog::info("实体池统计: 命中 {}, 未命中 {} (命中率 {:.1f}%), 归还 {}, 预热 {}",
+                         pool_stats.hits_, pool_stats.misses_, pool_stats.getHitRate() * 100.0, pool_stats.releases_, pool_stats.prewarmed_);
+        }
+        if (particle_system_)
+        {
+            const auto &particle_stats = particle_system_->getStats();
+            spdlog::info("粒子统计: 发射 {}, 播放完毕 {}, 因容量覆盖 {} (容量 {})",
+                         particle_stats.emitted_, particle_stats.expired_, particle_stats.evicted_, particle_system_->capacity());
+        }
         Scene::clean();
     }
 
@@ -212,13 +272,16 @@ namespace game::scene
 
     bool GameScene::loadLevel()
     {
+        // 路径节点只在加载阶段使用，加载完成后编译为扁平化的路径图
+        std::unordered_map<int, game::data::WaypointNode> waypoint_nodes;
+        std::vector<int> start_points;
         engine::loader::LevelLoader level_loader;
         // 设置拓展的构建器EntityBuilderMW
         level_loader.setEntityBuilder(std::make_unique<game::loader::EntityBuilderMW>(level_loader,
                                                                                       context_,
                                                                                       registry_,
-                                                                                      waypoint_nodes_,
-                                                                                      start_points_));
+                                                                                      waypoint_nodes,
+                                                                                      start_points));
         // 获取关卡地图路径
         auto map_path = level_config_->getMapPath(level_number_);
         if (!level_loader.loadLevel(map_path, this))
@@ -226,6 +289,11 @@ namespace game::scene
             spdlog::error("加载关卡失败");
             return false;
         }
+        if (!waypoint_graph_.build(waypoint_nodes, start_points))
+        {
+            spdlog::error("编译路径图失败");
+            return false;
+        }
         return true;
     }
 
@@ -256,11 +324,48 @@ namespace game::scene
                 return false;
             }
         }
-        entity_factory_ = std::make_unique<game::factory::EntityFactory>(registry_, *blueprint_manager_);
+        entity_pool_ = std::make_unique<engine::core::EntityPool>(registry_);
+        particle_system_ = std::make_unique<engine::system::ParticleSystem>(context_.getResourceManager().getAnimationLibrary(),
+                                                                            static_cast<std::size_t>(context_.getConfig().particle_capacity_));
+        entity_factory_ = std::make_unique<game::factory::EntityFactory>(registry_, *blueprint_manager_, context_.getResourceManager(),
+                                                                         *entity_pool_, *particle_system_);
         spdlog::info("entity_factory_ 加载完成");
         return true;
     }
 
+    bool GameScene::initEntityPool()
+    {
+        // 按本关的预计数量预热投射物：会射击的敌人按单波最多的数量，玩家远程单位按每个单位同时在空中的投射物估算
+        // （死亡特效由粒子系统绘制，不需要预热）
+        std::unordered_map<entt::id_type, std::size_t> enemy_max_per_wave;
+        std::unordered_map<entt::id_type, std::size_t> projectiles;
+        auto waves = waves_.waves_; // 拷贝，不改动实际的波次队列
+        while (!waves.empty())
+        {
+            for (const auto &[class_id, count] : waves.front().enemy_types_)
+            {
+                auto &max_count = enemy_max_per_wave[class_id];
+                max_count = std::max(max_count, static_cast<std::size_t>(count));
+            }
+            waves.pop();
+        }
+        for (const auto &[class_id, count] : enemy_max_per_wave)
+        {
+            if (auto projectile_id = blueprint_manager_->getEnemyClassBlueprint(class_id).projectile_id_; projectile_id != entt::null)
+                projectiles[projectile_id] += count * game::defs::POOL_PREWARM_SHOTS_PER_SHOOTER;
+        }
+        for (const auto &[name_id, unit] : session_data_->getUnitMap())
+        {
+            if (auto projectile_id = blueprint_manager_->getPlayerClassBlueprint(unit.class_id_).projectile_id_; projectile_id != entt::null)
+                projectiles[projectile_id] += game::defs::POOL_PREWARM_SHOTS_PER_SHOOTER;
+        }
+
+        for (const auto &[projectile_id, count] : projectiles)
+            entity_factory_->prewarmProjectiles(projectile_id, std::min(count, game::defs::POOL_PREWARM_MAX));
+        spdlog::info("实体池预热完成: {} 个实体", entity_pool_->getStats().prewarmed_);
+        return true;
+    }
+
     bool GameScene::initRegistryContext()
     {
         // 让注册表存储一些数据类型实例作为上下文，方便使用
@@ -268,8 +373,7 @@ namespace game::scene
         registry_.ctx().emplace<std::shared_ptr<game::data::SessionData>>(session_data_);
         registry_.ctx().emplace<std::shared_ptr<game::data::UIConfig>>(ui_config_);
         registry_.ctx().emplace<std::shared_ptr<game::data::LevelConfig>>(level_config_);
-        registry_.ctx().emplace<std::unordered_map<int, game::data::WaypointNode> &>(waypoint_nodes_);
-        registry_.ctx().emplace<std::vector<int> &>(start_points_);
+        registry_.ctx().emplace<game::data::WaypointGraph &>(waypoint_graph_);
         registry_.ctx().emplace<game::data::GameStats &>(game_stats_);
         registry_.ctx().emplace<game::data::Waves &>(waves_);
         registry_.ctx().emplace<int &>(level_number_);
@@ -295,28 +399,37 @@ namespace game::scene
     {
         auto &dispatcher = context_.getDispatcher();
         // 系统初始化需要在可能的依赖模块(如实体工厂)初始化之后
-        render_system_ = std::make_unique<engine::system::RenderSystem>();
+        command_buffer_ = std::make_unique<engine::core::CommandBuffer>(context_.getJobSystem());
+        timer_scheduler_ = std::make_unique<engine::core::TimerScheduler>();
+        render_system_ = std::make_unique<engine::system::RenderSystem>(registry_);
+        // 粒子绘制在主图层的实体之后（血条、攻击范围之前）
+        render_system_->addLayerOverlay(engine::component::RenderComponent::MAIN_LAYER,
+                                        [this](engine::render::Renderer &renderer, const engine::render::Camera &camera)
+                                        { particle_system_->render(renderer, camera); });
         movement_system_ = std::make_unique<engine::system::MovementSystem>();
-        animation_system_ = std::make_unique<engine::system::AnimationSystem>(registry_, dispatcher);
+        animation_system_ = std::make_unique<engine::system::AnimationSystem>(registry_, context_);
         ysort_system_ = std::make_unique<engine::system::YSortSystem>();
         audio_system_ = std::make_unique<engine::system::AudioSystem>(registry_, context_);
+        interpolation_system_ = std::make_unique<engine::system::InterpolationSystem>();
 
         follow_path_system_ = std::make_unique<game::system::FollowPathSystem>();
-        remove_dead_system_ = std::make_unique<game::system::RemoveDeadSystem>();
+        remove_dead_system_ = std::make_unique<game::system::RemoveDeadSystem>(*entity_pool_);
         block_system_ = std::make_unique<game::system::BlockSystem>();
         set_target_system_ = std::make_unique<game::system::SetTargetSystem>();
         attack_starter_system_ = std::make_unique<game::system::AttackStarterSystem>();
-        timer_system_ = std::make_unique<game::system::TimerSystem>();
+        timer_system_ = std::make_unique<game::system::TimerSystem>(registry_, *timer_scheduler_);
         orientation_system_ = std::make_unique<game::system::OrientationSystem>();
         animation_state_system_ = std::make_unique<game::system::AnimationStateSystem>(registry_, dispatcher);
         animation_event_system_ = std::make_unique<game::system::AnimationEventSystem>(registry_, dispatcher);
-        combat_resolve_system_ = std::make_unique<game::system::CombatResolveSystem>(registry_, dispatcher);
-        projectile_system_ = std::make_unique<game::system::ProjectileSystem>(registry_, dispatcher, *entity_factory_);
+        combat_resolve_system_ = std::make_unique<game::system::CombatResolveSystem>(registry_, dispatcher, context_.getEventStager());
+        projectile_system_ = std::make_unique<game::system::ProjectileSystem>(registry_, dispatcher, context_.getEventStager(), *command_buffer_, *entity_factory_);
         effect_system_ = std::make_unique<game::system::EffectSystem>(registry_, dispatcher, *entity_factory_);
         health_bar_system_ = std::make_unique<game::system::HealthBarSystem>();
         game_rule_system_ = std::make_unique<game::system::GameRuleSystem>(registry_, dispatcher);
         place_unit_system_ = std::make_unique<game::system::PlaceUnitSystem>(registry_, *entity_factory_, context_);
         render_range_system_ = std::make_unique<game::system::RenderRangeSystem>();
+        spatial_index_system_ = std::make_unique<game::system::SpatialIndexSystem>();
+        spatial_grid_ = std::make_unique<engine::spatial::SpatialGrid>(game::defs::SPATIAL_CELL_SIZE);
         spdlog::info("系统初始化完成");
         return true;
     }
@@ -328,6 +441,150 @@ namespace game::scene
         return true;
     }
 
+    bool GameScene::initSystemScheduler()
+    {
+        // 每个系统声明读写的组件与资源，冲突的系统之间用 after() 明确先后顺序；
+        // 会创建/销毁实体或操作UI的系统声明为 exclusive，作为前后系统的分界。
+        // 调度器中的系统通过 EventStager 发送事件（dispatcher 不是线程安全的），不需要为此声明资源；
+        // 添加/移除组件记录在 CommandBuffer 中，只在 "CommandBuffer::apply" 同步点（exclusive）统一执行，
+        // 因此只记录命令的组件不需要声明为 writes，同步点之后的系统能看到之前记录的修改。
+        auto &events = context_.getEventStager();
+        auto &commands = *command_buffer_;
+        system_scheduler_ = std::make_unique<engine::system::SystemScheduler>(context_.getJobSystem());
+        auto &scheduler = *system_scheduler_;
+
+        // 执行上一帧事件回调（如战斗结算）中记录的命令
+        scheduler.add("CommandBuffer::apply (events)", [this](float)
+                      { command_buffer_->apply(registry_); })
+            .exclusive();
+        // 一次性结算本tick分发的所有攻击/治疗事件（死亡标签直接添加，下面的 RemoveDeadSystem 随即清理）
+        scheduler.add("CombatResolveSystem", [this](float)
+                      { combat_resolve_system_->update(); })
+            .exclusive();
+        // 每一帧最先清理死亡实体(要在dispatcher处理完事件后再清理，因此放在下一帧开头)
+        scheduler.add("RemoveDeadSystem", [this](float)
+                      { remove_dead_system_->update(registry_); })
+            .exclusive();
+
+        // --- 互不冲突的系统可以并行 ---
+        scheduler.add("InterpolationSystem", [this](float)
+                      { interpolation_system_->update(registry_); })
+            .reads<engine::component::TransformComponent>()
+            .writes<engine::component::InterpolationComponent>();
+        scheduler.add("GameRuleSystem", [this](float delta_time)
+                      { game_rule_system_->update(delta_time); })
+            .writesResource("game_stats");
+        scheduler.add("SpatialIndexSystem", [this](float)
+                      { spatial_index_system_->update(registry_, *spatial_grid_); })
+            .reads<engine::component::TransformComponent, game::component::PlayerComponent,
+                   game::component::BlockerComponent, game::component::EnemyComponent>()
+            .writesResource("spatial_grid");
+        scheduler.add("BlockSystem", [this, &events, &commands](float)
+                      { block_system_->update(registry_, events, commands, *spatial_grid_); })
+            .reads<game::component::EnemyComponent, engine::component::TransformComponent, game::component::BlockedByComponent>()
+            .writes<game::component::BlockerComponent, engine::component::VelocityComponent, game::component::UnitStateComponent>()
+            .readsResource("spatial_grid")
+            .after("SpatialIndexSystem");
+        scheduler.add("SetTargetSystem", [this, &commands](float)
+                      { set_target_system_->update(registry_, commands, *spatial_grid_); })
+            .reads<engine::component::TransformComponent, game::component::StatsComponent,
+                   game::component::PlayerComponent, game::component::EnemyComponent, game::component::TargetComponent,
+                   game::component::UnitStateComponent, game::defs::HealerTag, game::defs::RangedUnitTag>()
+            .readsResource("spatial_grid")
+            .after("BlockSystem");
+        scheduler.add("TimerSystem", [this](float delta_time)
+                      { timer_system_->update(delta_time); })
+            .reads<game::component::StatsComponent>()
+            .writes<game::component::UnitStateComponent>()
+            .writesResource("timer_scheduler")
+            .after("SetTargetSystem");
+
+        // 同步点：目标与阻挡组件在后续系统执行前生效
+        scheduler.add("CommandBuffer::apply (targeting)", [this](float)
+                      { command_buffer_->apply(registry_); })
+            .exclusive();
+
+        scheduler.add("FollowPathSystem", [this, &events, &commands](float)
+                      { follow_path_system_->update(registry_, events, commands, waypoint_graph_); })
+            .reads<engine::component::TransformComponent, game::component::BlockedByComponent, game::component::UnitStateComponent>()
+            .writes<engine::component::VelocityComponent, game::component::EnemyComponent>()
+            .readsResource("waypoint_graph");
+        scheduler.add("OrientationSystem", [this](float)
+                      { orientation_system_->update(registry_); })
+            .reads<game::component::TargetComponent, engine::component::TransformComponent,
+                   game::component::BlockedByComponent, engine::component::VelocityComponent,
+                   game::component::EnemyComponent, game::component::UnitStateComponent, game::defs::FaceLeftTag>()
+            .writes<engine::component::SpriteComponent>()
+            .after("FollowPathSystem");
+        scheduler.add("AttackStarterSystem", [this, &events](float)
+                      { attack_starter_system_->update(registry_, events); })
+            .reads<game::component::EnemyComponent, game::component::PlayerComponent, game::component::BlockedByComponent,
+                   game::component::TargetComponent, game::defs::HealerTag>()
+            .writes<engine::component::VelocityComponent, game::component::UnitStateComponent>()
+            .after("OrientationSystem");
+        scheduler.add("ProjectileSystem", [this](float delta_time)
+                      { projectile_system_->update(delta_time); })
+            .reads<game::component::ProjectileComponent>()
+            .writes<engine::component::TransformComponent>()
+            .after("OrientationSystem");
+        scheduler.add("MovementSystem", [this](float delta_time)
+                      { movement_system_->update(registry_, delta_time); })
+            .reads<engine::component::VelocityComponent>()
+            .writes<engine::component::TransformComponent>()
+            .after("AttackStarterSystem")
+            .after("ProjectileSystem");
+        scheduler.add("AnimationSystem", [this](float delta_time)
+                      { animation_system_->update(delta_time); })
+            .writes<engine::component::AnimationComponent, engine::component::SpriteComponent>()
+            .readsResource("animation_library")
+            .after("OrientationSystem");
+        scheduler.add("ParticleSystem", [this](float delta_time)
+                      { particle_system_->update(delta_time); })
+            .readsResource("animation_library")
+            .writesResource("particles");
+        scheduler.add("PlaceUnitSystem", [this](float delta_time)
+                      { place_unit_system_->update(delta_time); })
+            .reads<game::component::UnitPrepComponent, game::component::PlaceOccupiedComponent, engine::component::SpriteComponent,
+                   game::defs::MeleePlaceTag, game::defs::RangedPlaceTag>()
+            .writes<engine::component::TransformComponent, engine::component::RenderComponent>()
+            .readsResource("input")
+            .readsResource("camera")
+            .mainThread()
+            .after("MovementSystem")
+            .after("AnimationSystem");
+        scheduler.add("YSortSystem", [this](float)
+                      { ysort_system_->update(registry_); })
+            .reads<engine::component::TransformComponent, engine::component::StaticRenderTag>()
+            .writes<engine::component::RenderComponent>()
+            .after("PlaceUnitSystem");
+
+        // 同步点：本帧记录的其余命令（如死亡标签）在分发事件之前生效
+        scheduler.add("CommandBuffer::apply (end)", [this](float)
+                      { command_buffer_->apply(registry_); })
+            .exclusive();
+
+        // --- 场景中其他更新函数 ---
+        scheduler.add("EnemySpawner", [this](float delta_time)
+                      { enemy_spawner_->update(delta_time); })
+            .exclusive()
+            .mainThread();
+        scheduler.add("UnitsPortraitUI", [this](float delta_time)
+                      { units_portrait_ui_->update(delta_time); })
+            .exclusive()
+            .mainThread();
+        scheduler.add("UIManager::update", [this](float delta_time)
+                      { Scene::update(delta_time); })
+            .exclusive()
+            .mainThread();
+
+        if (!scheduler.build(registry_))
+        {
+            spdlog::warn("系统依赖图构建失败，将串行执行所有系统");
+        }
+        spdlog::info("系统调度器初始化完成");
+        return true;
+    }
+
     // --- 测试函数 ---
     bool GameScene::onClearAllPlayers()
     {
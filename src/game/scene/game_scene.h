@@ -1,5 +1,5 @@
 #pragma once
-#include "../data/waypoint_node.h"
+#include "../data/waypoint_graph.h"
 #include "../data/session_data.h"
 #include "../data/ui_config.h"
 #include "../data/game_stats.h"
@@ -16,6 +16,18 @@ namespace engine::ui
     class UIElement;
 }
 
+namespace engine::spatial
+{
+    class SpatialGrid;
+}
+
+namespace engine::core
+{
+    class CommandBuffer;
+    class TimerScheduler;
+    class EntityPool;
+}
+
 namespace game::ui
 {
     class UnitsPortraitUI;
@@ -43,6 +55,7 @@ namespace game::scene
         std::unique_ptr<engine::system::AnimationSystem> animation_system_;
         std::unique_ptr<engine::system::YSortSystem> ysort_system_;
         std::unique_ptr<engine::system::AudioSystem> audio_system_;
+        std::unique_ptr<engine::system::InterpolationSystem> interpolation_system_;
 
         std::unique_ptr<game::system::FollowPathSystem> follow_path_system_;
         std::unique_ptr<game::system::RemoveDeadSystem> remove_dead_system_;
@@ -60,15 +73,22 @@ namespace game::scene
         std::unique_ptr<game::system::GameRuleSystem> game_rule_system_;
         std::unique_ptr<game::system::PlaceUnitSystem> place_unit_system_;
         std::unique_ptr<game::system::RenderRangeSystem> render_range_system_;
+        std::unique_ptr<game::system::SpatialIndexSystem> spatial_index_system_;
+
+        std::unique_ptr<engine::system::SystemScheduler> system_scheduler_; // 系统调度器，按声明的读写集合并行执行各系统
+        std::unique_ptr<engine::core::CommandBuffer> command_buffer_;       // 命令缓冲，系统中的结构性修改延迟到同步点执行
+        std::unique_ptr<engine::core::TimerScheduler> timer_scheduler_;     // 定时器调度器，按模拟时间触发攻击冷却等定时事件
 
         std::unique_ptr<game::spawner::EnemySpawner> enemy_spawner_;   // 敌人生成器，负责生成敌人
         std::unique_ptr<game::ui::UnitsPortraitUI> units_portrait_ui_; // 封装的单位肖像UI，负责管理单位肖像UI的创建、更新和排列
+        std::unique_ptr<engine::spatial::SpatialGrid> spatial_grid_;   // 空间网格，每帧重建，用于敌我双方的邻近查询
 
-        std::unordered_map<int, game::data::WaypointNode> waypoint_nodes_; // 路径节点ID到节点数据的映射
-        std::vector<int> start_points_;                                    // 起点ID列表
-        game::data::GameStats game_stats_;                                 // 关卡内游戏统计数据
-        game::data::Waves waves_;                                          // 关卡波次数据
+        game::data::WaypointGraph waypoint_graph_; // 扁平化的路径图（由关卡中的路径节点编译而成）
+        game::data::GameStats game_stats_;         // 关卡内游戏统计数据
+        game::data::Waves waves_;                  // 关卡波次数据
 
+        std::unique_ptr<engine::core::EntityPool> entity_pool_;        // 实体池，复用投射物等短命实体
+        std::unique_ptr<engine::system::ParticleSystem> particle_system_; // 粒子系统，死亡特效等短命视觉效果（不创建实体）
         std::unique_ptr<game::factory::EntityFactory> entity_factory_; // 实体工厂，负责创建和管理实体
 
         // 管理数据的实例很可能同时被多个场景使用，因此使用共享指针
@@ -89,6 +109,8 @@ namespace game::scene
         void render() override;
         void clean() override;
 
+        const game::data::GameStats &getGameStats() const { return game_stats_; } ///< @brief 获取关卡内游戏统计数据（无头模拟报告使用）
+
     private:
         [[nodiscard]] bool initSessionData();
         [[nodiscard]] bool initLevelConfig();
@@ -97,10 +119,12 @@ namespace game::scene
         [[nodiscard]] bool initEventConnections();
         [[nodiscard]] bool initInputConnections();
         [[nodiscard]] bool initEntityFactory();
+        [[nodiscard]] bool initEntityPool();
         [[nodiscard]] bool initRegistryContext();
         [[nodiscard]] bool initSystems();
         [[nodiscard]] bool initEnemySpawner();
         [[nodiscard]] bool initUnitsPortraitUI();
+        [[nodiscard]] bool initSystemScheduler();
 
         // 测试函数
         bool onClearAllPlayers();
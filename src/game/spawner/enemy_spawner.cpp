@@ -1,9 +1,10 @@
 #include "enemy_spawner.h"
 #include "../data/level_data.h"
-#include "../data/waypoint_node.h"
+#include "../data/waypoint_graph.h"
 #include "../data/level_config.h"
 #include "../factory/entity_factory.h"
 #include "../../engine/utils/math.h"
+#include "../../engine/debug/log.h"
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
 #include <spdlog/spdlog.h>
@@ -65,15 +66,20 @@ namespace game::spawner
     void EnemySpawner::spawnEnemy()
     {
         // 获取上下文数据
-        auto &start_points = registry_.ctx().get<std::vector<int> &>();
-        auto &waypoint_nodes = registry_.ctx().get<std::unordered_map<int, game::data::WaypointNode> &>();
+        auto &waypoint_graph = registry_.ctx().get<game::data::WaypointGraph &>();
         auto &level_config = registry_.ctx().get<std::shared_ptr<game::data::LevelConfig> &>();
         auto &level_number = registry_.ctx().get<int &>();
 
         // 随机选择起点
-        auto random_index = engine::utils::randomInt(0, start_points.size() - 1);
-        auto start_index = start_points[random_index];
-        auto position = waypoint_nodes[start_index].position_;
+        const auto &start_indices = waypoint_graph.getStartIndices();
+        if (start_indices.empty())
+        {
+            spdlog::error("路径图中没有起点，无法生成敌人");
+            return;
+        }
+        auto random_index = engine::utils::randomInt(0, static_cast<int>(start_indices.size()) - 1);
+        auto start_index = start_indices[random_index];
+        auto position = waypoint_graph.getPosition(start_index);
         auto level = level_config->getEnemyLevel(level_number);
         auto rarity = level_config->getEnemyRarity(level_number);
 
@@ -83,7 +89,7 @@ namespace game::spawner
 
         // 创建敌人
         entity_factory_.createEnemyUnit(enemy_type, position, start_index, level, rarity);
-        spdlog::info("创建敌人: 位置: {}, {}", position.x, position.y);
+        ENGINE_LOG_INFO("创建敌人: 位置: {}, {}", position.x, position.y);
     }
 
 } // namespace game::spawner
\ No newline at end of file
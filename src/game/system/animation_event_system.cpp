@@ -8,6 +8,7 @@
 #include "../defs/tags.h"
 #include "../defs/events.h"
 #include "../../engine/component/transform_component.h"
+#include "../../engine/debug/profiler.h"
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
 #include <entt/core/hashed_string.hpp>
@@ -31,6 +32,7 @@ namespace game::system
 
     void AnimationEventSystem::onAnimationEvent(const engine::utils::AnimationEvent &event)
     {
+        ENGINE_PROFILE_SCOPE("AnimationEventSystem::onAnimationEvent");
         if (!registry_.valid(event.entity_))
             return;
         // 根据不同的事件id，调用不同的处理函数
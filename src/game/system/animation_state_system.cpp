@@ -2,11 +2,12 @@
 #include "../component/enemy_component.h"
 #include "../component/player_component.h"
 #include "../component/blocked_by_component.h"
-#include "../defs/tags.h"
+#include "../component/unit_state_component.h"
+#include "../../engine/debug/log.h"
+#include "../../engine/debug/profiler.h"
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
 #include <entt/core/hashed_string.hpp>
-#include <spdlog/spdlog.h>
 
 using namespace entt::literals;
 
@@ -26,6 +27,7 @@ namespace game::system
 
     void AnimationStateSystem::onAnimationFinishedEvent(const engine::utils::AnimationFinishedEvent &event)
     {
+        ENGINE_PROFILE_SCOPE("AnimationStateSystem::onAnimationFinishedEvent");
 
         if (!registry_.valid(event.entity_))
             return;
@@ -36,16 +38,17 @@ namespace game::system
             if (auto blocked_by = registry_.try_get<game::component::BlockedByComponent>(event.entity_); blocked_by)
             {
                 dispatcher_.enqueue(engine::utils::PlayAnimationEvent{event.entity_, "idle"_hs, true});
-                spdlog::info("敌人行动动画结束, 返回idle动画, ID: {}", entt::to_integral(event.entity_));
+                ENGINE_LOG_INFO("敌人行动动画结束, 返回idle动画, ID: {}", entt::to_integral(event.entity_));
                 // 如果没有被阻挡，则返回walk动画
             }
             else
             {
                 dispatcher_.enqueue(engine::utils::PlayAnimationEvent{event.entity_, "walk"_hs, true});
-                spdlog::info("敌人行动动画结束, 没有BlockedBy组件, 返回walk动画, ID: {}", entt::to_integral(event.entity_));
+                ENGINE_LOG_INFO("敌人行动动画结束, 没有BlockedBy组件, 返回walk动画, ID: {}", entt::to_integral(event.entity_));
             }
-            // 移除动作锁定（硬直）标签
-            registry_.remove<game::defs::ActionLockTag>(event.entity_);
+            // 解除动作锁定（硬直）状态
+            if (auto *state = registry_.try_get<game::component::UnitStateComponent>(event.entity_); state)
+                state->clear(game::component::UnitStateComponent::ACTION_LOCK);
             return;
         }
 
@@ -53,14 +56,7 @@ namespace game::system
         if (registry_.all_of<game::component::PlayerComponent>(event.entity_))
         {
             dispatcher_.enqueue(engine::utils::PlayAnimationEvent{event.entity_, "idle"_hs, true});
-            spdlog::info("玩家动画结束, 返回idle动画, ID: {}", entt::to_integral(event.entity_));
-            return;
-        }
-
-        // 如果是一次性动画实体（例如死亡特效），则标记死亡待移除
-        if (registry_.all_of<game::defs::OneShotRemoveTag>(event.entity_))
-        {
-            registry_.emplace_or_replace<game::defs::DeadTag>(event.entity_);
+            ENGINE_LOG_INFO("玩家动画结束, 返回idle动画, ID: {}", entt::to_integral(event.entity_));
             return;
         }
     }
@@ -1,6 +1,10 @@
 #pragma once
 #include <entt/entity/fwd.hpp>
-#include <entt/signal/fwd.hpp>
+
+namespace engine::core
+{
+    class EventStager;
+}
 
 namespace game::system
 {
@@ -11,13 +15,13 @@ namespace game::system
     class AttackStarterSystem
     {
     public:
-        void update(entt::registry &registry, entt::dispatcher &dispatcher);
+        void update(entt::registry &registry, engine::core::EventStager &events);
 
     private:
         // 拆分逻辑的函数，在update中调用
-        void updateEnemyBlocked(entt::registry &registry, entt::dispatcher &dispatcher); ///< @brief 处理被阻挡敌人
-        void updateEnemyRanged(entt::registry &registry, entt::dispatcher &dispatcher);  ///< @brief 处理敌人远程
-        void updatePlayer(entt::registry &registry, entt::dispatcher &dispatcher);       ///< @brief 处理玩家
+        void updateEnemyBlocked(entt::registry &registry, engine::core::EventStager &events); ///< @brief 处理被阻挡敌人
+        void updateEnemyRanged(entt::registry &registry, engine::core::EventStager &events);  ///< @brief 处理敌人远程
+        void updatePlayer(entt::registry &registry, engine::core::EventStager &events);       ///< @brief 处理玩家
     };
 
 } // namespace game::system
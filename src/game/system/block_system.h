@@ -1,7 +1,17 @@
 #pragma once
 
 #include <entt/entity/registry.hpp>
-#include <entt/signal/dispatcher.hpp>
+
+namespace engine::spatial
+{
+    class SpatialGrid;
+}
+
+namespace engine::core
+{
+    class EventStager;
+    class CommandBuffer;
+}
 
 namespace game::system
 {
@@ -13,7 +23,14 @@ namespace game::system
     class BlockSystem
     {
     public:
-        void update(entt::registry &registry, entt::dispatcher &dispatcher);
+        /**
+         * @brief 更新阻挡状态
+         * @param registry entt注册表
+         * @param events 事件暂存区（可能在工作线程中执行，不能直接使用 dispatcher）
+         * @param commands 命令缓冲，阻挡组件的添加/移除在下一个同步点生效
+         * @param grid 本帧已经重建好的空间网格，用于查找附近的阻挡者
+         */
+        void update(entt::registry &registry, engine::core::EventStager &events, engine::core::CommandBuffer &commands, const engine::spatial::SpatialGrid &grid);
     };
 
 } // namespace game::system
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "combat_resolve_system.h"
 #include "../component/stats_component.h"
+#include "../component/unit_state_component.h"
 #include "../component/player_component.h"
 #include "../component/enemy_component.h"
 #include "../component/blocked_by_component.h"
@@ -10,18 +11,21 @@
 #include "../../engine/component/sprite_component.h"
 #include "../defs/tags.h"
 #include "../defs/events.h"
+#include "../../engine/core/event_stager.h"
+#include "../../engine/debug/log.h"
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
 #include <glm/common.hpp>
 #include <spdlog/spdlog.h>
+#include <algorithm>
 
 using namespace entt::literals;
 
 namespace game::system
 {
 
-    CombatResolveSystem::CombatResolveSystem(entt::registry &registry, entt::dispatcher &dispatcher)
-        : registry_(registry), dispatcher_(dispatcher)
+    CombatResolveSystem::CombatResolveSystem(entt::registry &registry, entt::dispatcher &dispatcher, engine::core::EventStager &event_stager)
+        : registry_(registry), dispatcher_(dispatcher), event_stager_(event_stager)
     {
         dispatcher_.sink<game::defs::AttackEvent>().connect<&CombatResolveSystem::onAttackEvent>(this);
         dispatcher_.sink<game::defs::HealEvent>().connect<&CombatResolveSystem::onHealEvent>(this);
@@ -34,101 +38,118 @@ namespace game::system
 
     void CombatResolveSystem::onAttackEvent(const game::defs::AttackEvent &event)
     {
-        // 如果目标无效或标记死亡，直接返回
-        if (!registry_.valid(event.target_) || registry_.all_of<game::defs::DeadTag>(event.target_))
+        pending_.push_back({event.target_, event.damage_, false});
+    }
+
+    void CombatResolveSystem::onHealEvent(const game::defs::HealEvent &event)
+    {
+        pending_.push_back({event.target_, event.amount_, true});
+    }
+
+    void CombatResolveSystem::update()
+    {
+        last_stats_ = {};
+        if (pending_.empty())
             return;
-        // 根据伤害公式，让目标扣血
-        auto &target_stats = registry_.get<game::component::StatsComponent>(event.target_);
-        float damage = calculateEffectiveDamage(event.damage_, target_stats.def_);
-        target_stats.hp_ -= damage;
+        last_stats_.events_ = pending_.size();
 
-        // 如果目标是玩家
-        if (registry_.all_of<game::component::PlayerComponent>(event.target_))
+        // 按目标归并（稳定排序，同一目标的事件保持到达顺序），之后每个目标只处理一次
+        std::stable_sort(pending_.begin(), pending_.end(), [](const Impact &a, const Impact &b)
+                         { return entt::to_integral(a.target_) < entt::to_integral(b.target_); });
+        const std::span<const Impact> impacts{pending_};
+        for (std::size_t begin = 0; begin < impacts.size();)
         {
-            spdlog::info("玩家 ID: {} 受到 ID: {} 的伤害, 剩余生命值: {}",
-                         entt::to_integral(event.target_), entt::to_integral(event.attacker_), target_stats.hp_);
-            // 死亡情况
-            if (target_stats.hp_ <= 0)
-            {
-                target_stats.hp_ = 0;
-                // 发送移除单位事件
-                dispatcher_.enqueue(game::defs::RemovePlayerUnitEvent{event.target_});
-                spdlog::info("玩家 ID: {} 死亡", entt::to_integral(event.target_));
-                // NOTE: 可添加死亡特效, 统计信息等
-                // 受伤情况
-            }
-            else if (target_stats.hp_ < target_stats.max_hp_)
-            {
-                registry_.emplace_or_replace<game::defs::InjuredTag>(event.target_);
-            }
+            const auto target = impacts[begin].target_;
+            auto end = begin + 1;
+            while (end < impacts.size() && impacts[end].target_ == target)
+                ++end;
+            resolveTarget(target, impacts.subspan(begin, end - begin));
+            ++last_stats_.targets_;
+            begin = end;
+        }
+        pending_.clear(); // 保留容量，下一tick复用
+        ENGINE_LOG_DEBUG("战斗结算: {} 个事件, {} 个目标, {} 个死亡", last_stats_.events_, last_stats_.targets_, last_stats_.deaths_);
+    }
+
+    void CombatResolveSystem::resolveTarget(entt::entity target, std::span<const Impact> impacts)
+    {
+        // 如果目标无效或已经标记死亡，忽略所有事件
+        if (!registry_.valid(target) || registry_.all_of<game::defs::DeadTag>(target))
             return;
+        auto *target_stats = registry_.try_get<game::component::StatsComponent>(target);
+        // 生命值已经为0的玩家单位正在等待移除（RemovePlayerUnitEvent 已发送），不再重复结算
+        if (!target_stats || target_stats->hp_ <= 0.0f)
+            return;
+        const bool is_player = registry_.all_of<game::component::PlayerComponent>(target);
+        const bool is_enemy = !is_player && registry_.all_of<game::component::EnemyComponent>(target);
+        if (!is_player && !is_enemy)
+            return;
+
+        // 累计伤害（按伤害公式逐次计算）与治疗（只对玩家有效）
+        float damage = 0.0f;
+        float heal = 0.0f;
+        for (const auto &impact : impacts)
+        {
+            if (!impact.is_heal_)
+                damage += calculateEffectiveDamage(impact.amount_, target_stats->def_);
+            else if (is_player)
+                heal += impact.amount_;
         }
+        if (damage <= 0.0f && heal <= 0.0f)
+            return;
+        target_stats->hp_ = std::min(target_stats->hp_ - damage + heal, target_stats->max_hp_);
 
-        // 如果目标是敌人
-        if (registry_.all_of<game::component::EnemyComponent>(event.target_))
+        auto &unit_state = registry_.get<game::component::UnitStateComponent>(target);
+        // 未死亡：根据结算后的生命值设置/清除受伤状态
+        if (target_stats->hp_ > 0.0f)
         {
-            spdlog::info("敌人 ID: {} 受到 ID: {} 的伤害, 剩余生命值: {}",
-                         entt::to_integral(event.target_), entt::to_integral(event.attacker_), target_stats.hp_);
-            // 死亡情况
-            if (target_stats.hp_ <= 0)
-            {
-                target_stats.hp_ = 0;
-                registry_.emplace_or_replace<game::defs::DeadTag>(event.target_);
-                spdlog::info("敌人 ID: {} 死亡", entt::to_integral(event.target_));
-
-                // 发送死亡特效事件，需要先获取class_id、位置和是否翻转
-                const auto [class_name, transform, sprite] = registry_.get<game::component::ClassNameComponent,
-                                                                           engine::component::TransformComponent,
-                                                                           engine::component::SpriteComponent>(event.target_);
-                dispatcher_.enqueue(game::defs::EnemyDeadEffectEvent{class_name.class_id_, transform.position_, sprite.sprite_.is_flipped_});
-
-                // 更新统计信息
-                auto &game_stats = registry_.ctx().get<game::data::GameStats &>();
-                game_stats.enemy_killed_count_++; // 敌人击杀数量+1
-                if ((game_stats.enemy_killed_count_ + game_stats.enemy_arrived_count_) >= game_stats.enemy_count_)
-                {
-                    spdlog::warn("敌人全部死亡");
-                    // TODO: 切换场景逻辑
-                }
-
-                // 如果敌人被阻挡，减少阻挡者的阻挡计数
-                if (auto blocked_by = registry_.try_get<game::component::BlockedByComponent>(event.target_); blocked_by)
-                {
-                    auto blocker_entity = blocked_by->entity_;
-                    if (registry_.valid(blocker_entity))
-                    {
-                        auto &blocker = registry_.get<game::component::BlockerComponent>(blocker_entity);
-                        blocker.current_count_ = glm::max(0, blocker.current_count_ - 1);
-                    }
-                }
-                // 受伤情况
-            }
-            else if (target_stats.hp_ < target_stats.max_hp_)
-            {
-                registry_.emplace_or_replace<game::defs::InjuredTag>(event.target_);
-            }
+            if (target_stats->hp_ < target_stats->max_hp_)
+                unit_state.set(game::component::UnitStateComponent::INJURED);
+            else
+                unit_state.clear(game::component::UnitStateComponent::INJURED);
             return;
         }
-    }
 
-    void CombatResolveSystem::onHealEvent(const game::defs::HealEvent &event)
-    {
-        if (!registry_.valid(event.target_))
-            return;
-        if (!registry_.all_of<game::component::PlayerComponent>(event.target_))
+        // 死亡情况
+        target_stats->hp_ = 0.0f;
+        ++last_stats_.deaths_;
+        if (is_player)
+        {
+            // 发送移除单位事件
+            event_stager_.enqueue(game::defs::RemovePlayerUnitEvent{target});
+            ENGINE_LOG_INFO("玩家 ID: {} 死亡", entt::to_integral(target));
+            // NOTE: 可添加死亡特效, 统计信息等
             return;
-        // 根据治疗量，让目标回血
-        auto &target_stats = registry_.get<game::component::StatsComponent>(event.target_);
-        target_stats.hp_ += event.amount_;
-        spdlog::info("治疗者 ID: {}, 治疗目标 ID: {}, 治疗量: {}",
-                     entt::to_integral(event.healer_), entt::to_integral(event.target_), event.amount_);
-        // 如果治疗后满血，移除受伤标签
-        if (target_stats.hp_ >= target_stats.max_hp_)
+        }
+
+        registry_.emplace_or_replace<game::defs::DeadTag>(target);
+        ENGINE_LOG_INFO("敌人 ID: {} 死亡", entt::to_integral(target));
+
+        // 发送死亡特效事件，需要先获取class_id、位置和是否翻转
+        const auto [class_name, transform, sprite] = registry_.get<game::component::ClassNameComponent,
+                                                                   engine::component::TransformComponent,
+                                                                   engine::component::SpriteComponent>(target);
+        event_stager_.enqueue(game::defs::EnemyDeadEffectEvent{class_name.class_id_, transform.position_, sprite.sprite_.is_flipped_});
+
+        // 更新统计信息
+        auto &game_stats = registry_.ctx().get<game::data::GameStats &>();
+        game_stats.enemy_killed_count_++; // 敌人击杀数量+1
+        if ((game_stats.enemy_killed_count_ + game_stats.enemy_arrived_count_) >= game_stats.enemy_count_)
         {
-            target_stats.hp_ = target_stats.max_hp_;
-            registry_.remove<game::defs::InjuredTag>(event.target_);
+            spdlog::warn("敌人全部死亡");
+            // TODO: 切换场景逻辑
+        }
+
+        // 如果敌人被阻挡，减少阻挡者的阻挡计数
+        if (auto blocked_by = registry_.try_get<game::component::BlockedByComponent>(target); blocked_by)
+        {
+            auto blocker_entity = blocked_by->entity_;
+            if (registry_.valid(blocker_entity))
+            {
+                auto &blocker = registry_.get<game::component::BlockerComponent>(blocker_entity);
+                blocker.current_count_ = glm::max(0, blocker.current_count_ - 1);
+            }
         }
-        // TODO: 添加治疗特效
     }
 
     // --- 辅助函数 ---
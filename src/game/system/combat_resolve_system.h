@@ -2,6 +2,14 @@
 #include <entt/entity/fwd.hpp>
 #include <entt/signal/fwd.hpp>
 #include "../defs/events.h"
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace engine::core
+{
+    class EventStager;
+}
 
 namespace game::system
 {
@@ -9,22 +17,53 @@ namespace game::system
     /**
      * @brief 战斗结算系统，用于处理战斗结算
      *
-     * 根据接受到的事件（攻击/治疗），执行相应的结算操作。
+     * 攻击/治疗事件到达时只记录下来，update() 中一次性结算本tick收到的所有事件：
+     * 按目标归并后，每个目标只校验、读取组件一次，累计伤害与治疗后一次性修改生命值；
+     * 死亡与受伤状态的变化每个目标最多处理一次（而不是每次命中处理一次）。
+     * 同一目标在一次结算中的治疗与伤害合并计算：生命值 = min(原生命值 - 总伤害 + 总治疗, 最大生命值)。
      */
     class CombatResolveSystem
     {
+    public:
+        /// @brief 最近一次结算的统计数据
+        struct Stats
+        {
+            std::size_t events_{0};  ///< @brief 结算的攻击与治疗事件数
+            std::size_t targets_{0}; ///< @brief 涉及的目标数
+            std::size_t deaths_{0};  ///< @brief 死亡的目标数
+        };
+
+    private:
+        /// @brief 单次攻击或治疗（归并排序用）
+        struct Impact
+        {
+            entt::entity target_;
+            float amount_;  ///< @brief 原始伤害或治疗量
+            bool is_heal_;
+        };
+
         entt::registry &registry_;
         entt::dispatcher &dispatcher_;
+        engine::core::EventStager &event_stager_; ///< @brief 结算中发送的事件（死亡、特效）先暂存，update 可以在工作线程中执行
+        std::vector<Impact> pending_;             ///< @brief 本tick收到、尚未结算的事件（复用容量）
+        Stats last_stats_;
 
     public:
-        CombatResolveSystem(entt::registry &registry, entt::dispatcher &dispatcher);
+        CombatResolveSystem(entt::registry &registry, entt::dispatcher &dispatcher, engine::core::EventStager &event_stager);
         ~CombatResolveSystem();
 
+        void update(); ///< @brief 结算所有记录的攻击与治疗事件
+
+        [[nodiscard]] const Stats &getLastStats() const { return last_stats_; } ///< @brief 获取最近一次结算的统计数据
+
     private:
-        // 事件回调函数
+        // 事件回调函数（只记录）
         void onAttackEvent(const game::defs::AttackEvent &event);
         void onHealEvent(const game::defs::HealEvent &event);
 
+        /// @brief 结算同一目标的所有事件
+        void resolveTarget(entt::entity target, std::span<const Impact> impacts);
+
         /**
          * @brief 计算最终伤害（公式可修改）
          * 当前计算公式：攻击力 - 防御力，最小伤害为攻击力的10%
@@ -32,4 +71,4 @@ namespace game::system
         float calculateEffectiveDamage(float attacker_atk, float target_def);
     };
 
-} // namespace game::system
\ No newline at end of file
+} // namespace game::system
@@ -2,6 +2,7 @@
 #include "../defs/tags.h"
 #include "../defs/events.h"
 #include "../factory/entity_factory.h"
+#include "../../engine/debug/profiler.h"
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
 
@@ -21,6 +22,7 @@ namespace game::system
 
     void EffectSystem::onEnemyDeadEffectEvent(const game::defs::EnemyDeadEffectEvent &event)
     {
+        ENGINE_PROFILE_SCOPE("EffectSystem::onEnemyDeadEffectEvent");
         entity_factory_.createEnemyDeadEffect(event.class_id_, event.position_, event.is_flipped_);
     }
 
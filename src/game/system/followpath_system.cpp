@@ -1,58 +1,62 @@
 #include "followpath_system.h"
-#include "../data/waypoint_node.h"
+#include "../data/waypoint_graph.h"
 #include "../component/enemy_component.h"
 #include "../component/blocked_by_component.h"
+#include "../component/unit_state_component.h"
 #include "../defs/tags.h"
 #include "../defs/events.h"
 #include "../../engine/component/velocity_component.h"
 #include "../../engine/component/transform_component.h"
 #include "../../engine/utils/math.h"
-#include <entt/signal/dispatcher.hpp>
+#include "../../engine/core/event_stager.h"
+#include "../../engine/core/command_buffer.h"
+#include "../../engine/debug/log.h"
 #include <entt/entity/registry.hpp>
 #include <glm/geometric.hpp>
-#include <spdlog/spdlog.h>
+#include <cstdint>
 
 namespace game::system
 {
 
-    void FollowPathSystem::update(entt::registry &registry, entt::dispatcher &dispatcher, std::unordered_map<int, game::data::WaypointNode> &waypoint_nodes)
+    void FollowPathSystem::update(entt::registry &registry, engine::core::EventStager &events, engine::core::CommandBuffer &commands, const game::data::WaypointGraph &waypoint_graph)
     {
-        spdlog::trace("FollowPathSystem::update");
+        ENGINE_LOG_TRACE("FollowPathSystem::update");
+        // 切换节点的距离阈值（阈值不要太小，不然敌人速度快的话可能造成震荡）
+        constexpr float arrive_threshold_squared = 5.0f * 5.0f;
         // 筛选依据：速度组件、变换组件、敌人组件，排除“被阻挡的敌人”和“动作锁定敌人”
         auto view = registry.view<engine::component::VelocityComponent,
                                   engine::component::TransformComponent,
-                                  game::component::EnemyComponent>(entt::exclude<game::component::BlockedByComponent, game::defs::ActionLockTag>);
+                                  game::component::EnemyComponent,
+                                  game::component::UnitStateComponent>(entt::exclude<game::component::BlockedByComponent>);
         for (auto entity : view)
         {
+            if (view.get<game::component::UnitStateComponent>(entity).has(game::component::UnitStateComponent::ACTION_LOCK))
+                continue;
             auto &velocity = view.get<engine::component::VelocityComponent>(entity);
             auto &transform = view.get<engine::component::TransformComponent>(entity);
             auto &enemy = view.get<game::component::EnemyComponent>(entity);
 
-            // 获取目标节点
-            auto target_node = waypoint_nodes.at(enemy.target_waypoint_id_);
+            // 计算当前位置到目标节点的向量（按索引直接读取，不涉及查找与拷贝）
+            glm::vec2 direction = waypoint_graph.getPosition(enemy.target_waypoint_index_) - transform.position_;
 
-            // 计算当前位置到目标位置的向量
-            glm::vec2 direction = target_node.position_ - transform.position_;
-
-            // 如果距离小于阈值，则切换到下一个节点（阈值不要太小，不然敌人速度快的话可能造成震荡）
-            if (glm::length(direction) < 5.0f)
+            // 如果距离小于阈值，则切换到下一个节点
+            if (glm::dot(direction, direction) < arrive_threshold_squared)
             {
-                // 如果下一个节点ID列表为空，代表到达终点。则发送信号并添加删除标记
-                auto size = target_node.next_node_ids_.size();
-                if (size == 0)
+                // 如果没有后继节点，代表到达终点。则发送信号并添加删除标记
+                auto next_count = waypoint_graph.getNextCount(enemy.target_waypoint_index_);
+                if (next_count == 0)
                 {
-                    spdlog::info("到达终点");
+                    ENGINE_LOG_INFO("到达终点");
                     // 发送信号并添加删除标记
-                    dispatcher.enqueue<game::defs::EnemyArriveHomeEvent>(); // 具体做什么，由回调函数决定
-                    registry.emplace<game::defs::DeadTag>(entity);          // 用于延迟删除
+                    events.enqueue<game::defs::EnemyArriveHomeEvent>();     // 具体做什么，由回调函数决定
+                    commands.emplace<game::defs::DeadTag>(entity);          // 用于延迟删除
                     continue;
                 }
                 // 随机选择下一个节点
-                auto target_index = engine::utils::randomInt(0, size - 1);
-                enemy.target_waypoint_id_ = target_node.next_node_ids_[target_index];
-                // 更新目标节点与方向矢量
-                target_node = waypoint_nodes.at(enemy.target_waypoint_id_);
-                direction = target_node.position_ - transform.position_;
+                auto n = static_cast<std::uint32_t>(engine::utils::randomInt(0, static_cast<int>(next_count) - 1));
+                enemy.target_waypoint_index_ = waypoint_graph.getNext(enemy.target_waypoint_index_, n);
+                // 更新方向矢量
+                direction = waypoint_graph.getPosition(enemy.target_waypoint_index_) - transform.position_;
             }
 
             // 更新速度组件：velocity = 方向矢量 * speed
@@ -1,19 +1,26 @@
 #pragma once
-#include "../data/waypoint_node.h"
 #include <entt/entity/fwd.hpp>
-#include <entt/signal/fwd.hpp>
-#include <unordered_map>
+
+namespace engine::core {
+class EventStager;
+class CommandBuffer;
+}
+
+namespace game::data {
+class WaypointGraph;
+}
 
 namespace game::system {
 /**
  * @brief 路径跟随系统。
- * 根据路径节点更新敌人实体的速度和目标节点。
+ * 根据路径图更新敌人实体的速度和目标节点。
  */
 class FollowPathSystem {
 public:
     void update(entt::registry& registry, 
-        entt::dispatcher& dispatcher, 
-        std::unordered_map<int, game::data::WaypointNode>& waypoint_nodes);
+        engine::core::EventStager& events, 
+        engine::core::CommandBuffer& commands, 
+        const game::data::WaypointGraph& waypoint_graph);
 };
 
-} // namespace game::system
\ No newline at end of file
+} // namespace game::system
@@ -19,5 +19,6 @@ namespace game::system
     class GameRuleSystem;
     class PlaceUnitSystem;
     class RenderRangeSystem;
+    class SpatialIndexSystem;
 
 } // namespace game::system
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "game_rule_system.h"
 #include "../data/game_stats.h"
+#include "../../engine/debug/log.h"
+#include "../../engine/debug/profiler.h"
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
 #include <spdlog/spdlog.h>
@@ -8,9 +10,15 @@ namespace game::system
 {
 
     GameRuleSystem::GameRuleSystem(entt::registry &registry, entt::dispatcher &dispatcher)
-        : registry_(registry), dispatcher_(dispatcher) {}
+        : registry_(registry), dispatcher_(dispatcher)
+    {
+        dispatcher_.sink<game::defs::EnemyArriveHomeEvent>().connect<&GameRuleSystem::onEnemyArriveHome>(this);
+    }
 
-    GameRuleSystem::~GameRuleSystem() {}
+    GameRuleSystem::~GameRuleSystem()
+    {
+        dispatcher_.disconnect(this);
+    }
 
     void GameRuleSystem::update(float delta_time)
     {
@@ -22,7 +30,8 @@ namespace game::system
 
     void GameRuleSystem::onEnemyArriveHome(const game::defs::EnemyArriveHomeEvent &)
     {
-        spdlog::info("敌人到达基地");
+        ENGINE_PROFILE_SCOPE("GameRuleSystem::onEnemyArriveHome");
+        ENGINE_LOG_INFO("敌人到达基地");
         auto &game_stats = registry_.ctx().get<game::data::GameStats &>();
         game_stats.enemy_arrived_count_++; // 敌人到达数量+1
         game_stats.home_hp_ -= 1;          // 基地血量-1
@@ -1,31 +1,40 @@
 #include "health_bar_system.h"
 #include "../component/stats_component.h"
+#include "../component/unit_state_component.h"
 #include "../../engine/component/transform_component.h"
+#include "../../engine/component/interpolation_component.h"
 #include "../defs/tags.h"
 #include "../defs/constants.h"
 #include "../../engine/render/renderer.h"
 #include "../../engine/render/camera.h"
 #include "../../engine/utils/math.h"
 #include <entt/entity/registry.hpp>
+#include <glm/common.hpp>
 
 namespace game::system
 {
 
-    void HealthBarSystem::update(entt::registry &registry, engine::render::Renderer &renderer, engine::render::Camera &camera)
+    void HealthBarSystem::update(entt::registry &registry, engine::render::Renderer &renderer, engine::render::Camera &camera, float alpha)
     {
         // 只有受伤的实体才显示血量标签
         auto view = registry.view<engine::component::TransformComponent,
                                   game::component::StatsComponent,
-                                  game::defs::HasHealthBarTag,
-                                  game::defs::InjuredTag>();
+                                  game::component::UnitStateComponent,
+                                  game::defs::HasHealthBarTag>();
+        const auto &interpolation_storage = registry.storage<engine::component::InterpolationComponent>();
 
         for (auto entity : view)
         {
+            if (!view.get<game::component::UnitStateComponent>(entity).has(game::component::UnitStateComponent::INJURED))
+                continue;
             const auto [transform, stats] = view.get<engine::component::TransformComponent, game::component::StatsComponent>(entity);
 
             auto size = game::defs::HEALTH_BAR_SIZE;
             // 血量条位置 = 角色位置 + 偏移量
-            auto position = transform.position_ + glm::vec2(-size.x / 2.0f, game::defs::HEALTH_BAR_OFFSET_Y);
+            auto position = transform.position_;
+            if (interpolation_storage.contains(entity))
+                position = glm::mix(interpolation_storage.get(entity).previous_position_, transform.position_, alpha);
+            position += glm::vec2(-size.x / 2.0f, game::defs::HEALTH_BAR_OFFSET_Y);
 
             // 根据血量百分比确定颜色
             auto health_percent = static_cast<float>(stats.hp_) / static_cast<float>(stats.max_hp_);
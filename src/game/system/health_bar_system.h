@@ -16,7 +16,11 @@ namespace game::system
     class HealthBarSystem
     {
     public:
-        void update(entt::registry &registry, engine::render::Renderer &renderer, engine::render::Camera &camera);
+        /**
+         * @brief 绘制血量条
+         * @param alpha 渲染插值系数，与RenderSystem保持一致，使血量条跟随插值后的角色位置
+         */
+        void update(entt::registry &registry, engine::render::Renderer &renderer, engine::render::Camera &camera, float alpha = 1.0f);
     };
 
 } // namespace game::system
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "../component/enemy_component.h"
 #include "../component/target_component.h"
 #include "../component/blocked_by_component.h"
+#include "../component/unit_state_component.h"
 #include "../defs/tags.h"
 #include "../../engine/component/velocity_component.h"
 #include "../../engine/component/sprite_component.h"
@@ -73,9 +74,13 @@ namespace game::system
         // 移动中的敌人角色，面朝移动方向
         auto view_moving = registry.view<engine::component::VelocityComponent,
                                          game::component::EnemyComponent,
-                                         engine::component::SpriteComponent>(entt::exclude<game::component::BlockedByComponent, game::defs::ActionLockTag>);
+                                         engine::component::SpriteComponent,
+                                         game::component::UnitStateComponent>(entt::exclude<game::component::BlockedByComponent>);
         for (auto entity : view_moving)
         {
+            // 动作锁定（硬直）中的敌人保持当前朝向
+            if (view_moving.get<game::component::UnitStateComponent>(entity).has(game::component::UnitStateComponent::ACTION_LOCK))
+                continue;
             const auto &velocity = view_moving.get<engine::component::VelocityComponent>(entity);
             auto &sprite = view_moving.get<engine::component::SpriteComponent>(entity);
             // 根据速度的 x 分量符号判断朝向
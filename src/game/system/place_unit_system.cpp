@@ -14,6 +14,7 @@
 #include "../../engine/component/sprite_component.h"
 #include "../../engine/component/name_component.h"
 #include "../../engine/component/render_component.h"
+#include "../../engine/debug/profiler.h"
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
 #include <entt/core/hashed_string.hpp>
@@ -118,6 +119,7 @@ namespace game::system
 
     void PlaceUnitSystem::onPrepUnitEvent(const game::defs::PrepUnitEvent &event)
     {
+        ENGINE_PROFILE_SCOPE("PlaceUnitSystem::onPrepUnitEvent");
         // 如果cost资源不够，直接返回
         auto &game_stats = registry_.ctx().get<game::data::GameStats &>();
         if (game_stats.cost_ < event.cost_)
@@ -135,6 +137,7 @@ namespace game::system
 
     void PlaceUnitSystem::onRemoveUnitEvent(const game::defs::RemovePlayerUnitEvent &event)
     {
+        ENGINE_PROFILE_SCOPE("PlaceUnitSystem::onRemoveUnitEvent");
         // 标记该单位为死亡
         registry_.emplace_or_replace<game::defs::DeadTag>(event.entity_);
         // 检查所有被占用的地点，如果占用者是移除事件中的单位，则移除占用组件
@@ -3,22 +3,25 @@
 #include "../defs/tags.h"
 #include "../defs/events.h"
 #include "../factory/entity_factory.h"
+#include "../data/projectile_store.h"
 #include "../../engine/component/transform_component.h"
 #include "../../engine/utils/events.h"
+#include "../../engine/core/event_stager.h"
+#include "../../engine/core/command_buffer.h"
+#include "../../engine/debug/log.h"
+#include "../../engine/debug/profiler.h"
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
-#include <glm/gtc/constants.hpp>
-#include <glm/common.hpp>
-#include <glm/trigonometric.hpp>
-#include <spdlog/spdlog.h>
 
 using namespace entt::literals;
 
 namespace game::system
 {
 
-    ProjectileSystem::ProjectileSystem(entt::registry &registry, entt::dispatcher &dispatcher, game::factory::EntityFactory &entity_factory)
-        : registry_(registry), dispatcher_(dispatcher), entity_factory_(entity_factory)
+    ProjectileSystem::ProjectileSystem(entt::registry &registry, entt::dispatcher &dispatcher, engine::core::EventStager &event_stager,
+                                       engine::core::CommandBuffer &command_buffer, game::factory::EntityFactory &entity_factory)
+        : registry_(registry), dispatcher_(dispatcher), event_stager_(event_stager), command_buffer_(command_buffer),
+          entity_factory_(entity_factory), store_(std::make_unique<game::data::ProjectileStore>(registry))
     {
         dispatcher_.sink<game::defs::EmitProjectileEvent>().connect<&ProjectileSystem::onEmitProjectileEvent>(this);
     }
@@ -30,49 +33,46 @@ namespace game::system
 
     void ProjectileSystem::update(float delta_time)
     {
-        // 获取所有投射物
-        auto view = registry_.view<game::component::ProjectileComponent, engine::component::TransformComponent>();
-        for (auto entity : view)
+        // 批量推进所有投射物（弹道、朝向），命中的条目记录在 hits_ 中
+        store_->advance(delta_time, hits_);
+
+        // 把新的位置与朝向写回变换组件（命中的投射物保持不变）
+        auto &transforms = registry_.storage<engine::component::TransformComponent>();
+        auto next_hit = hits_.begin();
+        const auto count = static_cast<std::uint32_t>(store_->size());
+        for (std::uint32_t i = 0; i < count; ++i)
         {
-            auto &projectile = registry_.get<game::component::ProjectileComponent>(entity);
-            auto &transform = registry_.get<engine::component::TransformComponent>(entity);
-            // 更新飞行时间
-            projectile.current_flight_time_ += delta_time;
-            // 如果飞行时间超过总飞行时间，则命中目标（发送攻击事件以及播放音效）并销毁
-            if (projectile.current_flight_time_ >= projectile.total_flight_time_)
+            if (next_hit != hits_.end() && *next_hit == i)
             {
-                dispatcher_.enqueue(game::defs::AttackEvent{entity, projectile.target_, projectile.damage_});
-                dispatcher_.enqueue(engine::utils::PlaySoundEvent{entity, "hit"_hs});
-                registry_.emplace<game::defs::DeadTag>(entity);
+                ++next_hit;
                 continue;
             }
-            // 计算飞行进度 (t 从 0 到 1)
-            float t = projectile.current_flight_time_ / projectile.total_flight_time_;
-            t = glm::clamp(t, 0.0f, 1.0f); // 确保 t 在 [0, 1] 区间
-
-            // 1. 计算水平位置 (线性插值)
-            glm::vec2 horizontal_pos = glm::mix(projectile.start_position_, projectile.target_position_, t);
-
-            // 2. 计算垂直方向的弧线偏移
-            // 使用 sin 函数可以轻松创建弧线: sin(0)=0, sin(PI/2)=1, sin(PI)=0
-            float arc_offset = glm::sin(t * glm::pi<float>()) * projectile.arc_height_;
-
-            // 3. 合成最终位置
-            transform.position_ = horizontal_pos;
-            transform.position_.y -= arc_offset; // Y轴向下为正，所以减去偏移使其向上拱起
-
-            // 4. 根据上一帧的位置计算朝向，并更新TransformComponent的旋转参数
-            auto direction = transform.position_ - projectile.previous_position_;
-            transform.rotation_ = glm::atan(direction.y, direction.x) * 180.0f / glm::pi<float>();
+            auto &transform = transforms.get(store_->getEntity(i));
+            transform.position_ = {store_->getPositionX(i), store_->getPositionY(i)};
+            transform.rotation_ = store_->getRotation(i);
+        }
 
-            // 5. 更新上一帧的位置
-            projectile.previous_position_ = transform.position_;
+        // 命中目标：统一发送攻击事件、播放音效，并标记死亡
+        if (hits_.empty())
+        {
+            return;
+        }
+        const auto &projectiles = registry_.storage<game::component::ProjectileComponent>();
+        for (auto index : hits_)
+        {
+            const auto entity = store_->getEntity(index);
+            const auto &projectile = projectiles.get(entity);
+            event_stager_.enqueue(game::defs::AttackEvent{entity, projectile.target_, projectile.damage_});
+            event_stager_.enqueue(engine::utils::PlaySoundEvent{entity, "hit"_hs});
+            command_buffer_.emplace<game::defs::DeadTag>(entity);
         }
+        store_->removeHits(hits_);
     }
 
     void ProjectileSystem::onEmitProjectileEvent(const game::defs::EmitProjectileEvent &event)
     {
-        spdlog::info("发射投射物: {}", event.id_);
+        ENGINE_PROFILE_SCOPE("ProjectileSystem::onEmitProjectileEvent");
+        ENGINE_LOG_INFO("发射投射物: {}", event.id_);
         entity_factory_.createProjectile(event.id_,
                                          event.start_position_,
                                          event.target_position_,
@@ -2,28 +2,50 @@
 #include "../defs/events.h"
 #include <entt/entity/fwd.hpp>
 #include <entt/signal/fwd.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
 
 namespace game::factory
 {
     class EntityFactory;
 }
 
+namespace game::data
+{
+    class ProjectileStore;
+}
+
+namespace engine::core
+{
+    class EventStager;
+    class CommandBuffer;
+}
+
 namespace game::system
 {
 
     /**
      * @brief 投射物系统
      * 1. 相响应投射物创建事件，创建投射物实体
-     * 2. 更新投射物的飞行状态，并发送攻击事件和播放音效
+     * 2. 更新投射物的飞行状态，并发送攻击事件和播放音效（通过事件暂存区，update 可以在工作线程中执行）
+     *
+     * 飞行状态保存在 ProjectileStore（SoA）中，弹道与朝向批量计算后写回 TransformComponent；
+     * 命中的投射物在计算完成后统一处理（发送事件、添加死亡标签）。
      */
     class ProjectileSystem
     {
         entt::registry &registry_;
         entt::dispatcher &dispatcher_;
+        engine::core::EventStager &event_stager_;      ///< @brief update 中发送的事件先暂存，在同步点合并进 dispatcher
+        engine::core::CommandBuffer &command_buffer_;  ///< @brief update 中的结构性修改（死亡标签）延迟到同步点执行
         game::factory::EntityFactory &entity_factory_; ///< @brief 需要传入实体工厂引用，负责创建投射物实体
+        std::unique_ptr<game::data::ProjectileStore> store_; ///< @brief 飞行中投射物的紧凑存储
+        std::vector<std::uint32_t> hits_;                     ///< @brief 本次更新命中的条目（复用，避免每帧分配）
 
     public:
-        ProjectileSystem(entt::registry &registry, entt::dispatcher &dispatcher, game::factory::EntityFactory &entity_factory);
+        ProjectileSystem(entt::registry &registry, entt::dispatcher &dispatcher, engine::core::EventStager &event_stager,
+                         engine::core::CommandBuffer &command_buffer, game::factory::EntityFactory &entity_factory);
         ~ProjectileSystem();
 
         void update(float delta_time);
@@ -1,17 +1,24 @@
 #include "remove_dead_system.h"
 #include "../defs/tags.h"
+#include "../../engine/core/entity_pool.h"
+#include "../../engine/debug/log.h"
 #include <entt/entity/registry.hpp>
-#include <spdlog/spdlog.h>
 
 namespace game::system {
 
+RemoveDeadSystem::RemoveDeadSystem(engine::core::EntityPool& entity_pool) : entity_pool_(entity_pool) {}
+
 void RemoveDeadSystem::update(entt::registry& registry) {
     // 标签本质上是空的组件，因此操作逻辑和组件一样
     auto view = registry.view<game::defs::DeadTag>();
     for (auto entity : view) {
+        // 池化的实体停用（会移除 DeadTag）后归还，不销毁
+        if (entity_pool_.release(entity)) {
+            continue;
+        }
         registry.destroy(entity);
-        spdlog::info("RemoveDeadSystem::update 清理了死亡实体: {}", entt::to_integral(entity));
+        ENGINE_LOG_INFO("RemoveDeadSystem::update 清理了死亡实体: {}", entt::to_integral(entity));
     }
 }
 
-} // namespace game::system
\ No newline at end of file
+} // namespace game::system
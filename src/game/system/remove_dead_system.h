@@ -1,13 +1,22 @@
 #pragma once
 #include <entt/entity/fwd.hpp>
 
+namespace engine::core {
+class EntityPool;
+}
+
 namespace game::system {
 
 /**
  * @brief 清理死亡实体的系统
+ * @note 池化的实体（投射物、死亡特效等）停用后归还到实体池，其余实体直接销毁
  */
 class RemoveDeadSystem {
+    engine::core::EntityPool& entity_pool_;
+
 public:
+    explicit RemoveDeadSystem(engine::core::EntityPool& entity_pool);
+
     void update(entt::registry& registry);
 };
 
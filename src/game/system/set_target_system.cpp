@@ -1,27 +1,30 @@
 #include "set_target_system.h"
 #include "../component/target_component.h"
 #include "../component/stats_component.h"
+#include "../component/unit_state_component.h"
 #include "../component/player_component.h"
 #include "../component/enemy_component.h"
 #include "../defs/tags.h"
 #include "../defs/constants.h"
 #include "../../engine/component/transform_component.h"
 #include "../../engine/utils/math.h"
+#include "../../engine/spatial/spatial_grid.h"
+#include "../../engine/core/command_buffer.h"
+#include "../../engine/debug/log.h"
 #include <entt/entity/registry.hpp>
-#include <spdlog/spdlog.h>
 
 namespace game::system
 {
 
-    void SetTargetSystem::update(entt::registry &registry)
+    void SetTargetSystem::update(entt::registry &registry, engine::core::CommandBuffer &commands, const engine::spatial::SpatialGrid &grid)
     {
-        updateHasTarget(registry);
-        updateNoTargetPlayer(registry);
-        updateNoTargetEnemy(registry);
-        updateHealer(registry);
+        updateHasTarget(registry, commands);
+        updateNoTargetPlayer(registry, commands, grid);
+        updateNoTargetEnemy(registry, commands, grid);
+        updateHealer(registry, commands, grid);
     }
 
-    void SetTargetSystem::updateHasTarget(entt::registry &registry)
+    void SetTargetSystem::updateHasTarget(entt::registry &registry, engine::core::CommandBuffer &commands)
     {
         // 筛选条件：敌我双方所有攻击型角色（排除治疗者，治疗者是另外逻辑）
         auto view_has_target = registry.view<engine::component::TransformComponent,
@@ -37,10 +40,10 @@ namespace game::system
             if (!registry.valid(target.entity_))
             {
                 // 如果目标实体无效，则清除目标
-                registry.remove<game::component::TargetComponent>(entity);
-                spdlog::info("ID: {}, 目标: ID: {}, 无效, 清除目标",
-                             entt::to_integral(entity),
-                             entt::to_integral(target.entity_));
+                commands.remove<game::component::TargetComponent>(entity);
+                ENGINE_LOG_INFO("ID: {}, 目标: ID: {}, 无效, 清除目标",
+                                entt::to_integral(entity),
+                                entt::to_integral(target.entity_));
                 continue;
             }
             // 检查目标是否还在攻击范围之内（检测半径 = 角色攻击范围 + 目标角色半径）
@@ -49,73 +52,61 @@ namespace game::system
             if (engine::utils::distanceSquared(transform.position_, target_transform.position_) > range_radius * range_radius)
             {
                 // 如果在攻击范围外，则清除目标
-                registry.remove<game::component::TargetComponent>(entity);
-                spdlog::info("ID: {}, 目标: ID: {}, 不在攻击范围之内, 清除目标", entt::to_integral(entity), entt::to_integral(target.entity_));
+                commands.remove<game::component::TargetComponent>(entity);
+                ENGINE_LOG_INFO("ID: {}, 目标: ID: {}, 不在攻击范围之内, 清除目标", entt::to_integral(entity), entt::to_integral(target.entity_));
                 continue;
             }
         }
     }
 
-    void SetTargetSystem::updateNoTargetPlayer(entt::registry &registry)
+    void SetTargetSystem::updateNoTargetPlayer(entt::registry &registry, engine::core::CommandBuffer &commands, const engine::spatial::SpatialGrid &grid)
     {
         // 筛选条件：没有目标的玩家攻击型角色
         auto view_player_no_target = registry.view<engine::component::TransformComponent,
                                                    game::component::StatsComponent,
                                                    game::component::PlayerComponent>(entt::exclude<game::component::TargetComponent, game::defs::HealerTag>);
-        // 获取所有敌方角色用于检测
-        auto view_enemy = registry.view<engine::component::TransformComponent, game::component::EnemyComponent>();
         // 遍历每一个没有目标的玩家攻击型角色
         for (auto player_entity : view_player_no_target)
         {
             const auto &player_transform = view_player_no_target.get<engine::component::TransformComponent>(player_entity);
             const auto &player_stats = view_player_no_target.get<game::component::StatsComponent>(player_entity);
-            // 检查敌人是否在攻击范围之内
-            for (auto enemy_entity : view_enemy)
+            // 通过空间网格找出攻击范围之内距离最近的敌人
+            auto range_radius = player_stats.range_ + game::defs::UNIT_RADIUS;
+            auto enemy_entity = grid.findNearest(player_transform.position_, range_radius, game::defs::SPATIAL_MASK_ENEMY);
+            if (enemy_entity != entt::null)
             {
-                const auto &enemy_transform = view_enemy.get<engine::component::TransformComponent>(enemy_entity);
-                auto range_radius = player_stats.range_ + game::defs::UNIT_RADIUS;
-                if (engine::utils::distanceSquared(player_transform.position_, enemy_transform.position_) <= range_radius * range_radius)
-                {
-                    // 如果敌人在攻击范围之内，则设置目标
-                    registry.emplace<game::component::TargetComponent>(player_entity, enemy_entity);
-                    spdlog::info("玩家: ID: {}, 设置目标: ID: {}", entt::to_integral(player_entity), entt::to_integral(enemy_entity));
-                    break; // 设置一个目标敌人就停止检查
-                }
+                // 如果敌人在攻击范围之内，则设置目标
+                commands.emplace<game::component::TargetComponent>(player_entity, enemy_entity);
+                ENGINE_LOG_INFO("玩家: ID: {}, 设置目标: ID: {}", entt::to_integral(player_entity), entt::to_integral(enemy_entity));
             }
         }
     }
 
-    void SetTargetSystem::updateNoTargetEnemy(entt::registry &registry)
+    void SetTargetSystem::updateNoTargetEnemy(entt::registry &registry, engine::core::CommandBuffer &commands, const engine::spatial::SpatialGrid &grid)
     {
         // 筛选条件：没有目标的敌人角色（只考虑远程型，近战敌人的目标就是阻挡者）
         auto view_enemy_no_target = registry.view<game::component::EnemyComponent,
                                                   engine::component::TransformComponent,
                                                   game::component::StatsComponent,
                                                   game::defs::RangedUnitTag>(entt::exclude<game::component::TargetComponent>);
-        // 获取所有玩家角色用于检测
-        auto view_player = registry.view<engine::component::TransformComponent, game::component::PlayerComponent>();
         // 遍历每一个没有目标的敌人角色
         for (auto enemy_entity : view_enemy_no_target)
         {
             const auto &enemy_transform = view_enemy_no_target.get<engine::component::TransformComponent>(enemy_entity);
             const auto &enemy_stats = view_enemy_no_target.get<game::component::StatsComponent>(enemy_entity);
-            // 检查玩家角色是否在攻击范围之内
-            for (auto player_entity : view_player)
+            // 通过空间网格找出攻击范围之内距离最近的玩家角色
+            auto range_radius = enemy_stats.range_ + game::defs::UNIT_RADIUS;
+            auto player_entity = grid.findNearest(enemy_transform.position_, range_radius, game::defs::SPATIAL_MASK_PLAYER);
+            if (player_entity != entt::null)
             {
-                const auto &player_transform = view_player.get<engine::component::TransformComponent>(player_entity);
-                auto range_radius = enemy_stats.range_ + game::defs::UNIT_RADIUS;
-                if (engine::utils::distanceSquared(enemy_transform.position_, player_transform.position_) <= range_radius * range_radius)
-                {
-                    // 如果玩家角色在攻击范围之内，则设置目标
-                    registry.emplace<game::component::TargetComponent>(enemy_entity, player_entity);
-                    spdlog::info("敌人: ID: {}, 设置目标: ID: {}", entt::to_integral(enemy_entity), entt::to_integral(player_entity));
-                    break; // 设置一个目标玩家角色就停止检查
-                }
+                // 如果玩家角色在攻击范围之内，则设置目标
+                commands.emplace<game::component::TargetComponent>(enemy_entity, player_entity);
+                ENGINE_LOG_INFO("敌人: ID: {}, 设置目标: ID: {}", entt::to_integral(enemy_entity), entt::to_integral(player_entity));
             }
         }
     }
 
-    void SetTargetSystem::updateHealer(entt::registry &registry)
+    void SetTargetSystem::updateHealer(entt::registry &registry, engine::core::CommandBuffer &commands, const engine::spatial::SpatialGrid &grid)
     {
         // --- 检查治疗者(玩家角色)的目标，选择血量百分比最低的受伤玩家角色作为目标 ---
         // 筛选条件：玩家治疗者角色
@@ -123,11 +114,6 @@ namespace game::system
                                          game::component::PlayerComponent,
                                          engine::component::TransformComponent,
                                          game::component::StatsComponent>();
-        // 获取所有受伤玩家角色用于检测
-        auto view_injured_player = registry.view<game::component::PlayerComponent,
-                                                 game::component::StatsComponent,
-                                                 game::defs::InjuredTag,
-                                                 engine::component::TransformComponent>();
         // 遍历每一个治疗者
         for (auto healer_entity : view_healer)
         {
@@ -136,34 +122,37 @@ namespace game::system
             // ---获取血量百分比最低的玩家角色---
             float lowest_hp_percent = 1.0f;             // 保存最低血量百分比（初始为100%）
             entt::entity lowest_hp_player = entt::null; // 保存最低血量百分比的玩家角色（初始为空）
-            // 遍历每一个受伤玩家角色
-            for (auto player_entity : view_injured_player)
-            {
-                // 如果处于治疗者攻击范围内
-                const auto &player_transform = view_injured_player.get<engine::component::TransformComponent>(player_entity);
-                auto range_radius = healer_stats.range_ + game::defs::UNIT_RADIUS;
-                if (engine::utils::distanceSquared(healer_transform.position_, player_transform.position_) < range_radius * range_radius)
-                {
-                    // 计算血量百分比并更新最低百分比和目标角色
-                    const auto &player_stats = view_injured_player.get<game::component::StatsComponent>(player_entity);
-                    auto hp_percent = static_cast<float>(player_stats.hp_) / static_cast<float>(player_stats.max_hp_);
-                    if (hp_percent < lowest_hp_percent)
-                    {
-                        lowest_hp_percent = hp_percent;
-                        lowest_hp_player = player_entity;
-                    }
-                }
-            }
+            // 只遍历治疗范围附近的玩家角色
+            auto range_radius = healer_stats.range_ + game::defs::UNIT_RADIUS;
+            grid.forEachInRadius(healer_transform.position_, range_radius, game::defs::SPATIAL_MASK_PLAYER,
+                                 [&](entt::entity player_entity, const glm::vec2 &, float distance_squared)
+                                 {
+                                     // 只考虑受伤且严格处于治疗范围内的角色
+                                     if (distance_squared >= range_radius * range_radius)
+                                         return true;
+                                     const auto *state = registry.try_get<game::component::UnitStateComponent>(player_entity);
+                                     if (!state || !state->has(game::component::UnitStateComponent::INJURED))
+                                         return true;
+                                     // 计算血量百分比并更新最低百分比和目标角色
+                                     const auto &player_stats = registry.get<game::component::StatsComponent>(player_entity);
+                                     auto hp_percent = static_cast<float>(player_stats.hp_) / static_cast<float>(player_stats.max_hp_);
+                                     if (hp_percent < lowest_hp_percent)
+                                     {
+                                         lowest_hp_percent = hp_percent;
+                                         lowest_hp_player = player_entity;
+                                     }
+                                     return true;
+                                 });
             // 如果找到了最低血量百分比的玩家角色，则设置目标
             if (lowest_hp_player != entt::null)
             {
                 // 设置（更新）目标
-                registry.emplace_or_replace<game::component::TargetComponent>(healer_entity, lowest_hp_player);
+                commands.emplace<game::component::TargetComponent>(healer_entity, lowest_hp_player);
             }
             // 否则移除目标(即使没有组件，也可以安全调用remove)
             else
             {
-                registry.remove<game::component::TargetComponent>(healer_entity);
+                commands.remove<game::component::TargetComponent>(healer_entity);
             }
         }
     }
@@ -1,23 +1,40 @@
 #pragma once
 #include <entt/entity/fwd.hpp>
 
+namespace engine::spatial
+{
+    class SpatialGrid;
+}
+
+namespace engine::core
+{
+    class CommandBuffer;
+}
+
 namespace game::system
 {
 
     /**
      * @brief 设置目标系统，用于设置角色的攻击目标。
+     * 目标组件的添加/移除记录在命令缓冲中，在下一个同步点生效。
      */
     class SetTargetSystem
     {
     public:
-        void update(entt::registry &registry);
+        /**
+         * @brief 更新所有角色的目标
+         * @param registry entt注册表
+         * @param commands 命令缓冲，用于延迟添加/移除目标组件
+         * @param grid 本帧已经重建好的空间网格，用于邻近查询
+         */
+        void update(entt::registry &registry, engine::core::CommandBuffer &commands, const engine::spatial::SpatialGrid &grid);
 
     private:
         // 拆分逻辑的函数，在update中调用
-        void updateHasTarget(entt::registry &registry);      ///< @brief 处理有目标的角色
-        void updateNoTargetPlayer(entt::registry &registry); ///< @brief 处理没有目标的玩家攻击型角色
-        void updateNoTargetEnemy(entt::registry &registry);  ///< @brief 处理没有目标的敌人角色
-        void updateHealer(entt::registry &registry);         ///< @brief 处理治疗者
+        void updateHasTarget(entt::registry &registry, engine::core::CommandBuffer &commands);                                                ///< @brief 处理有目标的角色
+        void updateNoTargetPlayer(entt::registry &registry, engine::core::CommandBuffer &commands, const engine::spatial::SpatialGrid &grid); ///< @brief 处理没有目标的玩家攻击型角色
+        void updateNoTargetEnemy(entt::registry &registry, engine::core::CommandBuffer &commands, const engine::spatial::SpatialGrid &grid);  ///< @brief 处理没有目标的敌人角色
+        void updateHealer(entt::registry &registry, engine::core::CommandBuffer &commands, const engine::spatial::SpatialGrid &grid);         ///< @brief 处理治疗者
     };
 
 } // namespace game::system
\ No newline at end of file
@@ -0,0 +1,43 @@
+#include "spatial_index_system.h"
+#include "../component/player_component.h"
+#include "../component/enemy_component.h"
+#include "../component/blocker_component.h"
+#include "../defs/constants.h"
+#include "../../engine/component/transform_component.h"
+#include "../../engine/spatial/spatial_grid.h"
+#include "../../engine/debug/log.h"
+#include <entt/entity/registry.hpp>
+
+namespace game::system
+{
+
+    void SpatialIndexSystem::update(entt::registry &registry, engine::spatial::SpatialGrid &grid)
+    {
+        ENGINE_LOG_TRACE("SpatialIndexSystem::update");
+        grid.clear();
+
+        // 玩家角色，能阻挡的额外标记为阻挡者
+        auto view_player = registry.view<engine::component::TransformComponent, game::component::PlayerComponent>();
+        for (auto entity : view_player)
+        {
+            const auto &transform = view_player.get<engine::component::TransformComponent>(entity);
+            auto mask = game::defs::SPATIAL_MASK_PLAYER;
+            if (registry.all_of<game::component::BlockerComponent>(entity))
+            {
+                mask |= game::defs::SPATIAL_MASK_BLOCKER;
+            }
+            grid.insert(entity, transform.position_, mask);
+        }
+
+        // 敌人角色
+        auto view_enemy = registry.view<engine::component::TransformComponent, game::component::EnemyComponent>();
+        for (auto entity : view_enemy)
+        {
+            const auto &transform = view_enemy.get<engine::component::TransformComponent>(entity);
+            grid.insert(entity, transform.position_, game::defs::SPATIAL_MASK_ENEMY);
+        }
+
+        grid.build();
+    }
+
+} // namespace game::system
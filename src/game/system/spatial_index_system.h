@@ -0,0 +1,23 @@
+#pragma once
+#include <entt/entity/fwd.hpp>
+
+namespace engine::spatial
+{
+    class SpatialGrid;
+}
+
+namespace game::system
+{
+
+    /**
+     * @brief 空间索引系统，每帧把敌我双方角色的位置写入空间网格，供邻近查询使用。
+     *
+     * 需要在所有使用空间网格的系统（如BlockSystem、SetTargetSystem）之前调用。
+     */
+    class SpatialIndexSystem
+    {
+    public:
+        void update(entt::registry &registry, engine::spatial::SpatialGrid &grid);
+    };
+
+} // namespace game::system
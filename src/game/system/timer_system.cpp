@@ -1,31 +1,98 @@
 #include "timer_system.h"
 #include "../component/stats_component.h"
-#include "../defs/tags.h"
+#include "../component/unit_state_component.h"
+#include "../../engine/core/timer_scheduler.h"
 #include <entt/entity/registry.hpp>
+#include <entt/core/hashed_string.hpp>
+#include <algorithm>
+
+using namespace entt::literals;
 
 namespace game::system
 {
 
-    void TimerSystem::update(entt::registry &registry, float delta_time)
+    namespace
+    {
+        constexpr entt::id_type ATTACK_READY_TIMER = "attack_ready"_hs; ///< @brief 攻击冷却定时器的种类
+    }
+
+    TimerSystem::TimerSystem(entt::registry &registry, engine::core::TimerScheduler &scheduler)
+        : registry_(registry), scheduler_(scheduler)
+    {
+        registry_.on_construct<game::component::StatsComponent>().connect<&TimerSystem::onStatsConstruct>(this);
+        // 系统创建前已经存在的单位
+        for (auto entity : registry_.view<game::component::StatsComponent>())
+        {
+            new_units_.push_back(entity);
+        }
+    }
+
+    TimerSystem::~TimerSystem()
     {
-        updateAttackTimer(registry, delta_time);
+        registry_.on_construct<game::component::StatsComponent>().disconnect<&TimerSystem::onStatsConstruct>(this);
     }
 
-    void TimerSystem::updateAttackTimer(entt::registry &registry, float delta_time)
+    void TimerSystem::update(float delta_time)
     {
-        // 筛选条件：有StatsComponent组件，但没有AttackReadyTag标签（即攻击正在冷却）
-        auto view_unit = registry.view<game::component::StatsComponent>(entt::exclude<game::defs::AttackReadyTag>);
-        for (auto entity : view_unit)
+        updateAttackTimer();
+        // 推进模拟时间，只处理到期的定时器
+        last_fired_count_ = scheduler_.advance(delta_time, [this](const engine::core::TimerScheduler::Timer &timer)
+                                               {
+                                                   if (timer.kind_ == ATTACK_READY_TIMER)
+                                                       onAttackTimer(timer.entity_);
+                                               });
+    }
+
+    void TimerSystem::updateAttackTimer()
+    {
+        using game::component::UnitStateComponent;
+        // 冷却从上一个tick结束的时刻开始计时（与逐帧累加 delta_time 的结果一致）
+        const auto now = scheduler_.getTime();
+
+        for (auto entity : new_units_)
         {
-            auto &stats = view_unit.get<game::component::StatsComponent>(entity);
-            stats.atk_timer_ += delta_time; // 推进计时器
-            // 如果攻击计时器大于等于攻击间隔，代表冷却结束。添加“可攻击”标签，并重置攻击计时器
-            if (stats.atk_timer_ >= stats.atk_interval_)
-            {
-                registry.emplace_or_replace<game::defs::AttackReadyTag>(entity);
-                stats.atk_timer_ = 0.0f;
-            }
+            scheduleAttackTimer(entity, now);
         }
+        new_units_.clear();
+
+        // 检查处于“可攻击”状态的单位：状态已被消耗（刚攻击过）的重新登记冷却，仍未攻击的继续等待
+        std::erase_if(ready_units_, [this, now](entt::entity entity)
+                      {
+                          const auto *state = registry_.valid(entity) ? registry_.try_get<UnitStateComponent>(entity) : nullptr;
+                          if (!state)
+                              return true;
+                          if (state->has(UnitStateComponent::ATTACK_READY))
+                              return false;
+                          scheduleAttackTimer(entity, now);
+                          return true; });
+    }
+
+    void TimerSystem::scheduleAttackTimer(entt::entity entity, double start_time)
+    {
+        if (!registry_.valid(entity))
+            return;
+        if (const auto *stats = registry_.try_get<game::component::StatsComponent>(entity); stats)
+        {
+            scheduler_.scheduleAt(start_time + stats->atk_interval_, entity, ATTACK_READY_TIMER);
+        }
+    }
+
+    void TimerSystem::onAttackTimer(entt::entity entity)
+    {
+        using game::component::UnitStateComponent;
+        if (!registry_.valid(entity))
+            return;
+        // 冷却结束，设置“可攻击”状态
+        if (auto *state = registry_.try_get<UnitStateComponent>(entity); state)
+        {
+            state->set(UnitStateComponent::ATTACK_READY);
+            ready_units_.push_back(entity);
+        }
+    }
+
+    void TimerSystem::onStatsConstruct(entt::registry &, entt::entity entity)
+    {
+        new_units_.push_back(entity);
     }
 
-} // namespace game::system
\ No newline at end of file
+} // namespace game::system
@@ -1,22 +1,49 @@
 #pragma once
 #include <entt/entity/fwd.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace engine::core
+{
+    class TimerScheduler;
+}
 
 namespace game::system
 {
 
     /**
-     * @brief 计时器系统，用于更新所有包含计时器的组件，
-     * 并在满足条件时添加必要的标签，（如攻击冷却完成后，添加“可攻击”标签）。
+     * @brief 计时器系统，通过定时器调度器（按模拟时间排序的最小堆）管理单位的计时，
+     * 并在到期时设置必要的状态，（如攻击冷却完成后，设置“可攻击”状态）。
+     *
+     * 每帧只处理到期的定时器与当前处于“可攻击”状态的单位，而不是遍历所有单位累加计时：
+     * - 新单位（构造 StatsComponent 时）登记首次攻击冷却；
+     * - 定时器到期时设置“可攻击”状态，并记录该单位；
+     * - 记录的单位被攻击启动系统消耗“可攻击”状态后，下一次 update 从消耗时刻重新登记冷却。
      */
     class TimerSystem
     {
+        entt::registry &registry_;
+        engine::core::TimerScheduler &scheduler_;
+        std::vector<entt::entity> new_units_;   ///< @brief 新建的单位，下一次 update 时登记首次攻击冷却
+        std::vector<entt::entity> ready_units_; ///< @brief 处于“可攻击”状态、等待被消耗的单位
+        std::size_t last_fired_count_{0};       ///< @brief 上一次 update 触发的定时器数量
+
     public:
-        void update(entt::registry &registry, float delta_time);
+        TimerSystem(entt::registry &registry, engine::core::TimerScheduler &scheduler);
+        ~TimerSystem();
+
+        void update(float delta_time);
+
+        [[nodiscard]] std::size_t getLastFiredCount() const { return last_fired_count_; } ///< @brief 上一次 update 触发的定时器数量
 
     private:
         // 拆分逻辑的函数，在update中调用
-        void updateAttackTimer(entt::registry &registry, float delta_time); ///< @brief 处理攻击计时器
-        // TODO: 处理其他计时器
+        void updateAttackTimer();                                                    ///< @brief 为新单位与刚攻击过的单位登记攻击冷却
+        void scheduleAttackTimer(entt::entity entity, double start_time);           ///< @brief 登记从 start_time 开始的一次攻击冷却
+        void onAttackTimer(entt::entity entity);                                     ///< @brief 攻击冷却到期
+        // TODO: 处理其他计时器（技能、增益、波次……）
+
+        void onStatsConstruct(entt::registry &registry, entt::entity entity); ///< @brief StatsComponent 构造时的回调
     };
 
-}
\ No newline at end of file
+}
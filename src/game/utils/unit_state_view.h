@@ -0,0 +1,55 @@
+#pragma once
+#include "../component/unit_state_component.h"
+#include <cstddef>
+#include <utility>
+
+namespace game::utils
+{
+
+    /**
+     * @brief 单位状态过滤条件：all_of_ 中的状态必须全部存在，none_of_ 中的状态必须全部不存在。
+     *
+     * 相当于标签组件 view 中的 get<Tag...> 与 exclude<Tag...>。
+     */
+    struct UnitStateFilter
+    {
+        game::component::UnitStateFlags all_of_{0};
+        game::component::UnitStateFlags none_of_{0};
+
+        [[nodiscard]] constexpr bool matches(game::component::UnitStateFlags flags) const
+        {
+            return (flags & all_of_) == all_of_ && (flags & none_of_) == 0;
+        }
+    };
+
+    /**
+     * @brief 遍历 view 中状态满足过滤条件的实体
+     * @param view 包含 UnitStateComponent 的 entt view（其余组件与 exclude 条件照常声明）
+     * @param filter 状态过滤条件
+     * @param func 回调 void(entt::entity, UnitStateComponent&)，其余组件通过 view.get 获取
+     */
+    template <typename View, typename Func>
+    void forEachUnitState(View &view, UnitStateFilter filter, Func &&func)
+    {
+        for (auto entity : view)
+        {
+            auto &state = view.template get<game::component::UnitStateComponent>(entity);
+            if (filter.matches(state.flags_))
+                func(entity, state);
+        }
+    }
+
+    /// @brief 统计 view 中状态满足过滤条件的实体数量
+    template <typename View>
+    [[nodiscard]] std::size_t countUnitState(View &view, UnitStateFilter filter)
+    {
+        std::size_t count = 0;
+        for (auto entity : view)
+        {
+            if (filter.matches(view.template get<game::component::UnitStateComponent>(entity).flags_))
+                ++count;
+        }
+        return count;
+    }
+
+} // namespace game::utils
@@ -1,10 +1,15 @@
 #include "engine/core/game_app.h"
 #include "engine/core/context.h"
 #include "game/scene/game_scene.h"
+#include "game/data/game_stats.h"
+#include "game/debug/unit_state_benchmark.h"
 #include "engine/utils/events.h"
 #include <spdlog/spdlog.h>
 #include <SDL3/SDL_main.h>
 #include <entt/signal/dispatcher.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
 
 void setupInitialScene(engine::core::Context& context) {
     // GameApp在调用run方法之前，先创建并设置初始场景
@@ -12,12 +17,54 @@ void setupInitialScene(engine::core::Context& context) {
     context.getDispatcher().trigger<engine::utils::PushSceneEvent>(engine::utils::PushSceneEvent{std::move(game_scene)});
 }
 
+/// @brief 无头模拟结束后，把统计结果输出到标准输出（方便构建服务器上的脚本收集）
+void printHeadlessReport(const engine::core::HeadlessReport& report) {
+    auto* game_scene = dynamic_cast<game::scene::GameScene*>(report.scene_);
+    if (game_scene) {
+        const auto& stats = game_scene->getGameStats();
+        std::printf("kills=%d arrivals=%d home_hp=%d enemies=%d\n",
+                    stats.enemy_killed_count_, stats.enemy_arrived_count_, stats.home_hp_, stats.enemy_count_);
+    } else {
+        std::printf("kills=- arrivals=- home_hp=- enemies=-\n");
+    }
+    std::printf("ticks=%llu sim_seconds=%.2f wall_seconds=%.3f ticks_per_second=%.0f\n",
+                static_cast<unsigned long long>(report.ticks_), report.simulated_seconds_,
+                report.wall_seconds_, report.ticks_per_second_);
+}
 
-int main(int /* argc */, char* /* argv */[]) {
+/**
+ * 用法：
+ *   MonsterWar                          正常运行
+ *   MonsterWar --headless [ticks] [dt]  无头模拟：不创建窗口、不绘制、静音，以固定步长 dt（默认1/60秒）
+ *                                       不限速地运行 ticks 个tick（默认18000，即5分钟游戏时间，0 表示不限制）
+ *   MonsterWar --bench-unit-state [frames]
+ *                                       对比高频状态切换的两种存储方式（标签组件 / UnitStateComponent 状态位），
+ *                                       1k 与 10k 单位各模拟 frames 帧（默认600），结果输出到标准输出
+ */
+int main(int argc, char* argv[]) {
     spdlog::set_level(spdlog::level::info);
 
+    if (argc > 1 && std::string_view(argv[1]) == "--bench-unit-state") {
+        std::size_t frames = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 600;
+        for (const auto& result : game::debug::runUnitStateBenchmark({1000, 10000}, frames)) {
+            std::printf("units=%zu frames=%zu toggles=%zu tags_ms=%.3f flags_ms=%.3f speedup=%.2fx%s\n",
+                        result.unit_count_, result.frames_, result.toggles_, result.tag_ms_, result.flag_ms_,
+                        result.getSpeedup(), result.consistent_ ? "" : " (MISMATCH)");
+        }
+        return 0;
+    }
+
     engine::core::GameApp app;
     app.registerSceneSetup(setupInitialScene);
+
+    if (argc > 1 && std::string_view(argv[1]) == "--headless") {
+        std::uint64_t max_ticks = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 18000;
+        float delta_time = argc > 3 ? std::strtof(argv[3], nullptr) : 1.0f / 60.0f;
+        spdlog::set_level(spdlog::level::warn);     // 批量模拟时只保留警告和错误
+        app.setHeadless(max_ticks, delta_time);
+        app.registerHeadlessReport(printHeadlessReport);
+    }
+
     app.run();
     return 0;
-}
\ No newline at end of file
+}
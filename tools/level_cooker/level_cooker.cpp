@@ -0,0 +1,603 @@
+#include "../../src/engine/loader/cooked_level_format.h"
+#include "../../src/engine/loader/cooked_level.h"
+#include "../../src/engine/utils/math.h"
+#include <entt/core/hashed_string.hpp>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * 关卡烘焙工具：把 Tiled 地图（.tmj）及其引用的图块集（.tsj）转换为烘焙关卡文件（.mwl，格式见 cooked_level_format.h），
+ * 游戏加载关卡时直接映射该文件，不再解析 JSON、也不再逐个瓦片解析路径。
+ *
+ * 用法：
+ *   level_cooker <地图.tmj>...   每个地图输出到同一目录下的同名 .mwl 文件
+ *
+ * 地图路径需要与游戏中使用的路径一致（相对于游戏的工作目录，即项目根目录，如 assets/maps/level1.tmj），
+ * 文件中的纹理路径与纹理ID都由它推导。解析规则与 LevelLoader 读取 JSON 时相同。
+ */
+
+namespace cooked = engine::loader::cooked;
+
+namespace
+{
+
+    /// @brief 一个地图的烘焙过程（解析 JSON，生成各段的数据）
+    class LevelCooker final
+    {
+        /// @brief 已加载的图块集
+        struct Tileset
+        {
+            std::uint32_t first_gid_{0};
+            std::string path_;
+            nlohmann::json json_;
+        };
+
+        std::string map_path_;
+        cooked::Header header_;
+        std::vector<Tileset> tilesets_; ///< @brief 按 firstgid 升序
+
+        // --- 各段的数据 ---
+        std::vector<char> strings_;
+        std::vector<cooked::Source> sources_;
+        std::vector<cooked::Texture> textures_;
+        std::vector<cooked::Tile> tiles_;
+        std::vector<cooked::Frame> frames_;
+        std::vector<cooked::Property> properties_;
+        std::vector<cooked::Layer> layers_;
+        std::vector<std::uint32_t> cells_;
+        std::vector<cooked::Object> objects_;
+
+        // --- 去重用的查找表 ---
+        std::unordered_map<std::string, cooked::StringRef> string_lookup_;
+        std::unordered_map<std::string, std::uint32_t> texture_lookup_;
+        std::unordered_map<std::uint32_t, std::uint32_t> tile_lookup_; ///< @brief gid（含翻转标志） -> TILES 下标（或 NONE）
+
+    public:
+        explicit LevelCooker(std::string map_path) : map_path_(std::move(map_path)) {}
+
+        /// @brief 读取地图与图块集并生成烘焙数据
+        [[nodiscard]] bool cook();
+
+        /// @brief 写出烘焙关卡文件
+        [[nodiscard]] bool write(const std::string &output_path) const;
+
+        [[nodiscard]] std::size_t getTileCount() const { return tiles_.size(); }
+        [[nodiscard]] std::size_t getLayerCount() const { return layers_.size(); }
+        [[nodiscard]] std::size_t getObjectCount() const { return objects_.size(); }
+
+    private:
+        void cookLayer(const nlohmann::json &layer_json);
+        bool loadTileset(const std::string &tileset_path, std::uint32_t first_gid);
+
+        /// @brief 把 gid 解析为瓦片描述（结果会缓存），无法解析时返回 NONE
+        std::uint32_t resolveTile(std::uint32_t gid);
+        std::uint32_t buildTile(std::uint32_t gid);
+
+        cooked::StringRef addString(std::string_view text);
+        void addSource(const std::string &path, const std::string &content); ///< @brief 记录源文件（路径、大小与内容哈希）
+        std::uint32_t addTexture(const std::string &path);
+        cooked::Range addProperties(const nlohmann::json &json); ///< @brief 转换 json 中的 "properties" 数组
+
+        static bool readFile(const std::string &path, std::string &content); ///< @brief 以二进制方式读取整个文件
+        static std::string resolvePath(std::string_view relative_path, std::string_view file_path);
+        static cooked::TileType getTileType(const nlohmann::json &tile_json);
+        static void getTextureRect(const nlohmann::json &tileset_json, int local_id, float (&rect)[4]);
+    };
+
+    bool LevelCooker::cook()
+    {
+        std::string content;
+        if (!readFile(map_path_, content))
+        {
+            spdlog::error("无法打开关卡文件: {}", map_path_);
+            return false;
+        }
+        nlohmann::json json_data;
+        try
+        {
+            json_data = nlohmann::json::parse(content);
+        }
+        catch (const nlohmann::json::parse_error &e)
+        {
+            spdlog::error("解析 JSON 数据失败: {}", e.what());
+            return false;
+        }
+        addSource(std::filesystem::path(map_path_).lexically_normal().generic_string(), content);
+
+        header_.map_width_ = json_data.value("width", 0);
+        header_.map_height_ = json_data.value("height", 0);
+        header_.tile_width_ = json_data.value("tilewidth", 0);
+        header_.tile_height_ = json_data.value("tileheight", 0);
+        if (json_data.contains("backgroundcolor"))
+        {
+            auto color = engine::utils::parseHexColor(json_data["backgroundcolor"].get<std::string>());
+            header_.has_background_color_ = 1;
+            header_.background_color_[0] = color.r;
+            header_.background_color_[1] = color.g;
+            header_.background_color_[2] = color.b;
+            header_.background_color_[3] = color.a;
+        }
+
+        if (json_data.contains("tilesets") && json_data["tilesets"].is_array())
+        {
+            for (const auto &tileset_json : json_data["tilesets"])
+            {
+                if (!tileset_json.contains("source") || !tileset_json["source"].is_string() ||
+                    !tileset_json.contains("firstgid") || !tileset_json["firstgid"].is_number_integer())
+                {
+                    spdlog::error("tilesets 对象中缺少有效 'source' 或 'firstgid' 字段。");
+                    continue;
+                }
+                auto tileset_path = resolvePath(tileset_json["source"].get<std::string>(), map_path_);
+                if (!loadTileset(tileset_path, tileset_json["firstgid"].get<std::uint32_t>()))
+                    return false;
+            }
+        }
+        std::sort(tilesets_.begin(), tilesets_.end(), [](const Tileset &a, const Tileset &b)
+                  { return a.first_gid_ < b.first_gid_; });
+
+        if (!json_data.contains("layers") || !json_data["layers"].is_array())
+        {
+            spdlog::error("地图文件 '{}' 中缺少或无效的 'layers' 数组。", map_path_);
+            return false;
+        }
+        for (const auto &layer_json : json_data["layers"])
+        {
+            if (!layer_json.value("visible", true))
+            {
+                spdlog::info("图层 '{}' 不可见，不会烘焙。", layer_json.value("name", "Unnamed"));
+                continue;
+            }
+            cookLayer(layer_json);
+        }
+        return true;
+    }
+
+    void LevelCooker::cookLayer(const nlohmann::json &layer_json)
+    {
+        cooked::Layer layer;
+        layer.type_ = cooked::LayerType::EMPTY;
+        const std::string layer_name = layer_json.value("name", "Unnamed");
+        layer.name_ = addString(layer_name);
+        if (layer_json.contains("properties"))
+        {
+            for (const auto &property : layer_json["properties"])
+            {
+                if (property.value("name", "") == "order")
+                {
+                    layer.order_ = property["value"].get<int>();
+                    layer.has_order_ = 1;
+                }
+                else if (property.value("name", "") == "bake")
+                {
+                    layer.bake_ = property["value"].get<bool>() ? 1 : 0;
+                }
+            }
+        }
+
+        const std::string layer_type = layer_json.value("type", "none");
+        if (layer_type == "imagelayer")
+        {
+            const std::string image_path = layer_json.value("image", "");
+            if (image_path.empty())
+            {
+                spdlog::error("图层 '{}' 缺少 'image' 属性。", layer_name);
+            }
+            else
+            {
+                layer.type_ = cooked::LayerType::IMAGE;
+                layer.texture_ = addTexture(resolvePath(image_path, map_path_));
+                layer.offset_[0] = layer_json.value("offsetx", 0.0f);
+                layer.offset_[1] = layer_json.value("offsety", 0.0f);
+                layer.parallax_[0] = layer_json.value("parallaxx", 1.0f);
+                layer.parallax_[1] = layer_json.value("parallaxy", 1.0f);
+                layer.repeat_x_ = layer_json.value("repeatx", false) ? 1 : 0;
+                layer.repeat_y_ = layer_json.value("repeaty", false) ? 1 : 0;
+            }
+        }
+        else if (layer_type == "tilelayer")
+        {
+            const auto cell_count = static_cast<std::size_t>(header_.map_width_) * static_cast<std::size_t>(header_.map_height_);
+            if (!layer_json.contains("data") || !layer_json["data"].is_array())
+            {
+                spdlog::error("图层 '{}' 缺少 'data' 属性。", layer_name);
+            }
+            else if (layer_json["data"].size() != cell_count)
+            {
+                spdlog::error("图层 '{}' 的瓦片数量 {} 与地图尺寸不一致。", layer_name, layer_json["data"].size());
+            }
+            else
+            {
+                layer.type_ = cooked::LayerType::TILE;
+                layer.cells_.first_ = static_cast<std::uint32_t>(cells_.size());
+                for (const auto &gid : layer_json["data"])
+                {
+                    const auto value = gid.get<std::uint32_t>();
+                    cells_.push_back(value == 0 ? cooked::NONE : resolveTile(value));
+                }
+                layer.cells_.count_ = static_cast<std::uint32_t>(cell_count);
+            }
+        }
+        else if (layer_type == "objectgroup")
+        {
+            if (!layer_json.contains("objects") || !layer_json["objects"].is_array())
+            {
+                spdlog::error("对象图层 '{}' 缺少 'objects' 属性。", layer_name);
+            }
+            else
+            {
+                layer.type_ = cooked::LayerType::OBJECT;
+                layer.objects_.first_ = static_cast<std::uint32_t>(objects_.size());
+                for (const auto &object_json : layer_json["objects"])
+                {
+                    cooked::Object object;
+                    const auto gid = object_json.value("gid", 0u);
+                    if (gid != 0)
+                    {
+                        object.tile_ = resolveTile(gid);
+                        if (object.tile_ == cooked::NONE)
+                        {
+                            spdlog::warn("对象图层 '{}' 中的对象缺少有效的 'gid' 或瓦片信息。", layer_name);
+                            continue;
+                        }
+                    }
+                    object.id_ = object_json.value("id", 0);
+                    object.name_ = addString(object_json.value("name", ""));
+                    object.x_ = object_json.value("x", 0.0f);
+                    object.y_ = object_json.value("y", 0.0f);
+                    object.width_ = object_json.value("width", 0.0f);
+                    object.height_ = object_json.value("height", 0.0f);
+                    object.rotation_ = object_json.value("rotation", 0.0f);
+                    object.is_point_ = object_json.value("point", false) ? 1 : 0;
+                    object.properties_ = addProperties(object_json);
+                    objects_.push_back(object);
+                }
+                layer.objects_.count_ = static_cast<std::uint32_t>(objects_.size()) - layer.objects_.first_;
+            }
+        }
+        else
+        {
+            spdlog::warn("不支持的图层类型: {}", layer_type);
+        }
+        layers_.push_back(layer);
+    }
+
+    bool LevelCooker::loadTileset(const std::string &tileset_path, std::uint32_t first_gid)
+    {
+        std::string content;
+        if (!readFile(tileset_path, content))
+        {
+            spdlog::error("无法打开 Tileset 文件: {}", tileset_path);
+            return false;
+        }
+        Tileset tileset{first_gid, tileset_path, {}};
+        try
+        {
+            tileset.json_ = nlohmann::json::parse(content);
+        }
+        catch (const nlohmann::json::parse_error &e)
+        {
+            spdlog::error("解析 Tileset JSON 文件 '{}' 失败: {} (at byte {})", tileset_path, e.what(), e.byte);
+            return false;
+        }
+        addSource(tileset_path, content);
+        tilesets_.push_back(std::move(tileset));
+        return true;
+    }
+
+    std::uint32_t LevelCooker::resolveTile(std::uint32_t gid)
+    {
+        if (auto it = tile_lookup_.find(gid); it != tile_lookup_.end())
+            return it->second;
+        const auto index = buildTile(gid);
+        tile_lookup_.emplace(gid, index);
+        return index;
+    }
+
+    std::uint32_t LevelCooker::buildTile(std::uint32_t gid)
+    {
+        const bool is_flipped_horizontally = (gid & 0x80000000u) != 0;
+        const std::uint32_t id = gid & 0x1FFFFFFFu;
+
+        // 查找 firstgid 不大于 id 的最后一个图块集
+        auto tileset_it = std::upper_bound(tilesets_.begin(), tilesets_.end(), id, [](std::uint32_t value, const Tileset &tileset)
+                                           { return value < tileset.first_gid_; });
+        if (tileset_it == tilesets_.begin())
+        {
+            spdlog::error("gid为 {} 的瓦片未找到图块集。", id);
+            return cooked::NONE;
+        }
+        --tileset_it;
+        const auto &tileset = tileset_it->json_;
+        const auto &file_path = tileset_it->path_;
+        const int local_id = static_cast<int>(id - tileset_it->first_gid_);
+
+        cooked::Tile tile;
+        tile.is_flipped_ = is_flipped_horizontally ? 1 : 0;
+        tile.local_id_ = static_cast<std::uint32_t>(local_id);
+        tile.animation_set_ = entt::hashed_string(file_path.c_str());
+
+        // 在 tiles 数组中查找对应的瓦片（单一图片图块集中只有带动画或属性的瓦片才会出现在这里）
+        const nlohmann::json *tile_json = nullptr;
+        if (tileset.contains("tiles"))
+        {
+            for (const auto &entry : tileset["tiles"])
+            {
+                if (entry.value("id", 0) == local_id)
+                {
+                    tile_json = &entry;
+                    break;
+                }
+            }
+        }
+
+        const bool is_single_image = tileset.contains("image");
+        if (is_single_image)
+        {
+            getTextureRect(tileset, local_id, tile.src_rect_);
+            tile.texture_ = addTexture(resolvePath(tileset["image"].get<std::string>(), file_path));
+            tile.type_ = tile_json ? getTileType(*tile_json) : cooked::TileType::NORMAL;
+        }
+        else
+        {
+            if (!tileset.contains("tiles"))
+            {
+                spdlog::error("Tileset 文件 '{}' 缺少 'tiles' 属性。", file_path);
+                return cooked::NONE;
+            }
+            if (!tile_json || !tile_json->contains("image"))
+            {
+                spdlog::error("Tileset 文件 '{}' 中瓦片 {} 缺少 'image' 属性。", file_path, local_id);
+                return cooked::NONE;
+            }
+            const auto image_width = tile_json->value("imagewidth", 0);
+            const auto image_height = tile_json->value("imageheight", 0);
+            tile.src_rect_[0] = tile_json->value("x", 0.0f);
+            tile.src_rect_[1] = tile_json->value("y", 0.0f);
+            tile.src_rect_[2] = tile_json->value("width", static_cast<float>(image_width));
+            tile.src_rect_[3] = tile_json->value("height", static_cast<float>(image_height));
+            tile.texture_ = addTexture(resolvePath((*tile_json)["image"].get<std::string>(), file_path));
+            tile.type_ = getTileType(*tile_json);
+        }
+
+        if (tile_json)
+        {
+            // 动画（只支持单一图片图块集）
+            if (is_single_image && tile_json->contains("animation") && (*tile_json)["animation"].is_array())
+            {
+                tile.frames_.first_ = static_cast<std::uint32_t>(frames_.size());
+                for (const auto &frame_json : (*tile_json)["animation"])
+                {
+                    cooked::Frame frame;
+                    getTextureRect(tileset, frame_json.value("tileid", 0), frame.src_rect_);
+                    frame.duration_ms_ = frame_json.value("duration", 100.0f);
+                    frames_.push_back(frame);
+                }
+                tile.frames_.count_ = static_cast<std::uint32_t>(frames_.size()) - tile.frames_.first_;
+            }
+            tile.properties_ = addProperties(*tile_json);
+        }
+
+        tiles_.push_back(tile);
+        return static_cast<std::uint32_t>(tiles_.size() - 1);
+    }
+
+    cooked::StringRef LevelCooker::addString(std::string_view text)
+    {
+        std::string key(text);
+        if (auto it = string_lookup_.find(key); it != string_lookup_.end())
+            return it->second;
+        cooked::StringRef ref{static_cast<std::uint32_t>(strings_.size()), static_cast<std::uint32_t>(text.size())};
+        strings_.insert(strings_.end(), text.begin(), text.end());
+        string_lookup_.emplace(std::move(key), ref);
+        return ref;
+    }
+
+    void LevelCooker::addSource(const std::string &path, const std::string &content)
+    {
+        const auto hash = cooked::hashContent(reinterpret_cast<const unsigned char *>(content.data()), content.size());
+        sources_.push_back({addString(path), static_cast<std::uint32_t>(content.size()), hash});
+    }
+
+    std::uint32_t LevelCooker::addTexture(const std::string &path)
+    {
+        if (auto it = texture_lookup_.find(path); it != texture_lookup_.end())
+            return it->second;
+        const auto index = static_cast<std::uint32_t>(textures_.size());
+        textures_.push_back({entt::hashed_string(path.c_str()), addString(path)});
+        texture_lookup_.emplace(path, index);
+        return index;
+    }
+
+    cooked::Range LevelCooker::addProperties(const nlohmann::json &json)
+    {
+        cooked::Range range{static_cast<std::uint32_t>(properties_.size()), 0};
+        if (!json.contains("properties") || !json["properties"].is_array())
+            return range;
+        for (const auto &property_json : json["properties"])
+        {
+            if (!property_json.contains("value"))
+                continue;
+            cooked::Property property;
+            property.name_ = addString(property_json.value("name", ""));
+            const std::string type = property_json.value("type", "string");
+            const auto &value = property_json["value"];
+            if (type == "bool")
+            {
+                property.type_ = cooked::PropertyType::BOOL;
+                property.int_value_ = value.get<bool>() ? 1 : 0;
+            }
+            else if (type == "int" || type == "object")
+            {
+                property.type_ = type == "int" ? cooked::PropertyType::INT : cooked::PropertyType::OBJECT;
+                property.int_value_ = value.get<std::int32_t>();
+            }
+            else if (type == "float")
+            {
+                property.type_ = cooked::PropertyType::FLOAT;
+                property.float_value_ = value.get<float>();
+            }
+            else if (value.is_string())
+            {
+                property.type_ = type == "color" ? cooked::PropertyType::COLOR
+                                 : type == "file" ? cooked::PropertyType::FILE
+                                                  : cooked::PropertyType::STRING;
+                property.string_value_ = addString(value.get<std::string>());
+            }
+            else
+            {
+                spdlog::warn("不支持的属性类型 '{}'（属性 '{}'），不会烘焙。", type, property_json.value("name", ""));
+                continue;
+            }
+            properties_.push_back(property);
+        }
+        range.count_ = static_cast<std::uint32_t>(properties_.size()) - range.first_;
+        return range;
+    }
+
+    bool LevelCooker::readFile(const std::string &path, std::string &content)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open())
+            return false;
+        content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return !file.bad();
+    }
+
+    std::string LevelCooker::resolvePath(std::string_view relative_path, std::string_view file_path)
+    {
+        // 与 LevelLoader::resolvePath 相同，但只做词法上的规范化，结果保持为相对于工作目录的路径（可以在其它机器上使用）
+        auto map_dir = std::filesystem::path(file_path).parent_path();
+        return (map_dir / relative_path).lexically_normal().generic_string();
+    }
+
+    cooked::TileType LevelCooker::getTileType(const nlohmann::json &tile_json)
+    {
+        if (tile_json.contains("properties"))
+        {
+            for (const auto &property : tile_json["properties"])
+            {
+                if (property.value("name", "") == "solid")
+                    return property.value("value", false) ? cooked::TileType::SOLID : cooked::TileType::NORMAL;
+                if (property.value("name", "") == "hazard")
+                    return property.value("value", false) ? cooked::TileType::HAZARD : cooked::TileType::NORMAL;
+            }
+        }
+        return cooked::TileType::NORMAL;
+    }
+
+    void LevelCooker::getTextureRect(const nlohmann::json &tileset_json, int local_id, float (&rect)[4])
+    {
+        const auto columns = std::max(tileset_json.value("columns", 1), 1);
+        const auto tile_width = tileset_json.value("tilewidth", 0);
+        const auto tile_height = tileset_json.value("tileheight", 0);
+        rect[0] = static_cast<float>(local_id % columns * tile_width);
+        rect[1] = static_cast<float>(local_id / columns * tile_height);
+        rect[2] = static_cast<float>(tile_width);
+        rect[3] = static_cast<float>(tile_height);
+    }
+
+    bool LevelCooker::write(const std::string &output_path) const
+    {
+        // 计算各段的位置：紧跟在文件头之后依次排列，每段按 4 字节对齐
+        auto header = header_;
+        std::uint32_t offset = sizeof(cooked::Header);
+        auto place = [&](cooked::Section section, std::size_t count, std::size_t record_size)
+        {
+            offset = (offset + 3u) & ~3u;
+            header.sections_[section] = {offset, static_cast<std::uint32_t>(count)};
+            offset += static_cast<std::uint32_t>(count * record_size);
+        };
+        place(cooked::STRINGS, strings_.size(), sizeof(char));
+        place(cooked::SOURCES, sources_.size(), sizeof(cooked::Source));
+        place(cooked::TEXTURES, textures_.size(), sizeof(cooked::Texture));
+        place(cooked::TILES, tiles_.size(), sizeof(cooked::Tile));
+        place(cooked::FRAMES, frames_.size(), sizeof(cooked::Frame));
+        place(cooked::PROPERTIES, properties_.size(), sizeof(cooked::Property));
+        place(cooked::LAYERS, layers_.size(), sizeof(cooked::Layer));
+        place(cooked::CELLS, cells_.size(), sizeof(std::uint32_t));
+        place(cooked::OBJECTS, objects_.size(), sizeof(cooked::Object));
+
+        std::vector<char> buffer(offset, '\0');
+        auto copy = [&](cooked::Section section, const void *data, std::size_t bytes)
+        {
+            if (bytes > 0)
+                std::memcpy(buffer.data() + header.sections_[section].offset_, data, bytes);
+        };
+        std::memcpy(buffer.data(), &header, sizeof(header));
+        copy(cooked::STRINGS, strings_.data(), strings_.size());
+        copy(cooked::SOURCES, sources_.data(), sources_.size() * sizeof(cooked::Source));
+        copy(cooked::TEXTURES, textures_.data(), textures_.size() * sizeof(cooked::Texture));
+        copy(cooked::TILES, tiles_.data(), tiles_.size() * sizeof(cooked::Tile));
+        copy(cooked::FRAMES, frames_.data(), frames_.size() * sizeof(cooked::Frame));
+        copy(cooked::PROPERTIES, properties_.data(), properties_.size() * sizeof(cooked::Property));
+        copy(cooked::LAYERS, layers_.data(), layers_.size() * sizeof(cooked::Layer));
+        copy(cooked::CELLS, cells_.data(), cells_.size() * sizeof(std::uint32_t));
+        copy(cooked::OBJECTS, objects_.data(), objects_.size() * sizeof(cooked::Object));
+
+        std::ofstream file(output_path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            spdlog::error("无法写入烘焙关卡文件: {}", output_path);
+            return false;
+        }
+        file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        if (!file)
+        {
+            spdlog::error("写入烘焙关卡文件 '{}' 失败", output_path);
+            return false;
+        }
+        return true;
+    }
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr, "用法: level_cooker <地图.tmj>...\n");
+        return 1;
+    }
+
+    int failed = 0;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string map_path = argv[i];
+        const std::string output_path = std::filesystem::path(map_path).replace_extension(".mwl").generic_string();
+        const auto start = std::chrono::steady_clock::now();
+
+        LevelCooker cooker(map_path);
+        if (!cooker.cook() || !cooker.write(output_path))
+        {
+            spdlog::error("烘焙关卡失败: {}", map_path);
+            ++failed;
+            continue;
+        }
+        // 用游戏中的读取代码校验一遍输出
+        engine::loader::CookedLevel level;
+        if (!level.open(output_path))
+        {
+            spdlog::error("烘焙关卡文件 '{}' 校验失败: {}", output_path, level.getError());
+            ++failed;
+            continue;
+        }
+        const auto elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        spdlog::info("{} -> {}: {} 个图层, {} 种瓦片, {} 个对象, {} 字节 ({:.1f} ms)", map_path, output_path,
+                     cooker.getLayerCount(), cooker.getTileCount(), cooker.getObjectCount(),
+                     std::filesystem::file_size(output_path), elapsed_ms);
+    }
+    return failed == 0 ? 0 : 1;
+}